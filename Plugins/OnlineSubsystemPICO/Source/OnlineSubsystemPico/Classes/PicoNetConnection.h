@@ -6,6 +6,24 @@
 #include "PPF_Platform.h"
 #include "PicoNetConnection.generated.h"
 
+/**
+ * UTF-8 form of a peer id kept on the stack, so sending to a peer never allocates
+ */
+struct FPicoPeerIDString
+{
+	ANSICHAR Buffer[24];
+
+	explicit FPicoPeerIDString(ppfID InPeerID)
+	{
+		FCStringAnsi::Snprintf(Buffer, sizeof(Buffer), "%llu", static_cast<unsigned long long>(InPeerID));
+	}
+
+	const ANSICHAR* Get() const
+	{
+		return Buffer;
+	}
+};
+
 /**
  *
  */
@@ -17,6 +35,8 @@ class UPicoNetConnection : public UIpConnection
 private:
 	ppfID PeerID;
 	FString UserID;
+	/** UserID converted to UTF-8 once, passed to ppf_Net_SendPacket without per-packet conversion */
+	TArray<ANSICHAR> UserIDUTF8;
 	/** Should this net connection behave as a passthrough to normal IP */
 	bool bIsPassThrough;
 
@@ -29,9 +49,18 @@ public:
 	virtual void LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
 	FString LowLevelGetRemoteAddress(bool bAppendPort = false) override;
 	FString LowLevelDescribe() override;
+	virtual void CleanUp() override;
 	virtual void FinishDestroy() override;
 
 	virtual FString RemoteAddressToString() override;
 	// End NetConnection Interface
 
+	ppfID GetPeerID() const
+	{
+		return PeerID;
+	}
+
+private:
+	void SetUserID(const FString& InUserID);
+
 };
@@ -4,11 +4,13 @@
 
 #include "CoreMinimal.h"
 #include "PicoNetConnection.h"
+#include "PicoPacketTransport.h"
 #include "IpNetDriver.h"
 #include "IPAddress.h"
 #include "PicoNetDriver.generated.h"
 
 class FOnlineSessionPico;
+class FInternetAddr;
 
 /**
  *
@@ -20,18 +22,91 @@ class UPicoNetDriver : public UIpNetDriver
 
 private:
 
-	bool AddNewClientConnection(const FString& UserID);
+	bool AddNewClientConnection(ppfID PeerID);
 	/** Should this net driver behave as a passthrough to normal IP */
 	bool bIsPassthrough;
 
-	// todo
-	//TMap<uint64, EConnectionState> PendingClientConnections;
-	TMap<FString, EConnectionState> PendingClientConnections;
+	TMap<ppfID, EConnectionState> PendingClientConnections;
+
+	/** Session interface resolved once instead of looking up the subsystem on every send */
+	TWeakPtr<FOnlineSessionPico, ESPMode::ThreadSafe> CachedSessionInterface;
+
+	/** Returns the cached session interface if it is initialized, resolving it on first use */
+	TSharedPtr<FOnlineSessionPico, ESPMode::ThreadSafe> GetInitializedSessionInterface();
+
+	/** Extracts the peer id from an address without going through its string form */
+	static ppfID GetPeerID(const FInternetAddr& Address);
+
+	/** Aggregates the packets sent to each peer and tracks acknowledgements, null when bUsePacketTransport is off */
+	TUniquePtr<FPicoPacketTransport> PacketTransport;
+
+	enum class ETransportMode : uint8
+	{
+		/** The transport was offered to the peer, packets to it are held until it answers */
+		Offered,
+		Enabled,
+		Disabled,
+	};
+
+	struct FTransportPeer
+	{
+		ETransportMode Mode = ETransportMode::Disabled;
+		double OfferTime = 0.0;
+		TArray<TArray<uint8>> HeldPackets;
+	};
+
+	/** Packets held for a peer while the transport is offered, older ones are dropped beyond this */
+	static constexpr int32 MaxHeldPackets = 64;
+
+	/** Transport agreed with each peer, peers without an entry exchange plain packets */
+	TMap<ppfID, FTransportPeer> TransportPeers;
+
+	bool IsTransportEnabled(ppfID PeerID) const;
+	void SendPlainPacket(ppfID PeerID, const uint8* Data, int32 CountBytes);
+	void SendTransportControl(ppfID PeerID, EPicoTransportControl Control);
+	void ProcessTransportControl(ppfID PeerID, EPicoTransportControl Control, uint8 Version, double Now);
+	/** Ends the offer to a peer and sends the packets held meanwhile, framed or plain */
+	void ResolveTransportOffer(ppfID PeerID, FTransportPeer& Peer, bool bEnabled);
+	/** Falls back to plain packets with peers that did not answer the offer in time */
+	void ExpireTransportOffers(double Now);
+
+	/** Handles one packet received from a peer, after the transport has unpacked it */
+	void ProcessIncomingPacket(const ANSICHAR* SenderID, ppfID SenderPeerID, uint8* Data, int32 PacketSize);
 
 public:
-	// todo
-	//TMap<uint64, UPicoNetConnection*> Connections;
-	TMap<FString, UPicoNetConnection*> Connections;
+	TMap<ppfID, UPicoNetConnection*> Connections;
+
+	/**
+	 * Frame the packets of this driver with FPicoPacketTransport. Clients offer the transport when connecting and
+	 * only use it if the server accepts, so peers with and without the setting still connect with plain packets.
+	 */
+	UPROPERTY(Config)
+	bool bUsePacketTransport = false;
+
+	/** Seconds a client waits for the server to answer its transport offer before sending plain packets */
+	UPROPERTY(Config)
+	float TransportOfferTimeOut = 1.0f;
+
+	/** Largest frame the transport aggregates packets into, connections shrink their packets so that one fits with its framing */
+	UPROPERTY(Config)
+	int32 MaxTransportFrameSize = MAX_PACKET_SIZE;
+
+	/** Sends a packet to a peer, through the packet transport when it is enabled */
+	void SendToPeer(ppfID PeerID, const uint8* Data, int32 CountBytes);
+
+	bool HasPacketTransport() const
+	{
+		return PacketTransport.IsValid();
+	}
+
+	/** Forgets a closed connection and its transport state, unless its peer already has a newer connection */
+	void RemoveConnection(UPicoNetConnection* Connection);
+
+	/** Largest packet a connection may send through the packet transport, the frame size minus the framing */
+	int32 GetMaxTransportPacketSize() const;
+
+	/** Gets the transport counters and round trip / loss estimates of a peer, nullptr without transport or traffic */
+	const FPicoTransportStats* GetTransportStats(ppfID PeerID) const;
 
 	// Begin UNetDriver interface.
 	virtual bool IsAvailable() const override;
@@ -39,6 +114,7 @@ public:
 	virtual bool InitConnect(FNetworkNotify* InNotify, const FURL& ConnectURL, FString& Error) override;
 	virtual bool InitListen(FNetworkNotify* InNotify, FURL& LocalURL, bool bReuseAddressAndPort, FString& Error) override;
 	virtual void TickDispatch(float DeltaTime) override;
+	virtual void TickFlush(float DeltaSeconds) override;
 	virtual void LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits) override;
 	virtual void Shutdown() override;
 	virtual bool IsNetResourceValid() override;
@@ -5,6 +5,7 @@
 #include "OnlineSubsystemPicoPrivate.h"
 #include "OnlineError.h"
 #include "OnlineSubsystemPicoPackage.h"
+#include "Pico_User.h"
 
 const FString FOnlineFriendsPico::FriendsListInviteableUsers = TEXT("invitableUsers");
 void FOnlineFriendsPico::OnQueryFriendsComplete(ppfMessageHandle Message, bool bIsError, int32 LocalUserNum, const FString& ListName, TMap<FString, TSharedRef<FOnlineFriend>>& OutList, bool bAppendToExistingMap, const FOnReadFriendsListComplete& Delegate)
@@ -13,9 +14,9 @@ void FOnlineFriendsPico::OnQueryFriendsComplete(ppfMessageHandle Message, bool b
     FString ErrorStr;
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        auto ErrorMessage = ppf_Error_GetMessage(Error);
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        auto ErrorMessage = PicoErrorGetMessage(Error);
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         FString ErrorMessageStr = UTF8_TO_TCHAR(ErrorMessage) + FString(". Error Code: ") + ErrorCode;
         UE_LOG_ONLINE_FRIEND(Log, TEXT("PPF_GAME FOnlineFriendsPico::On Query Friends Complete Recive Failed :%s"), *ErrorMessageStr);
         ErrorStr = UTF8_TO_TCHAR(ErrorMessage);
@@ -35,30 +36,21 @@ void FOnlineFriendsPico::OnQueryFriendsComplete(ppfMessageHandle Message, bool b
         OutList.Empty(UserNum);
     }
 
-    for (size_t FriendIndex = 0; FriendIndex < UserNum; ++FriendIndex)
+    // Read each user once; the same profiles also refresh the shared user profile cache
+    TArray<FPicoUserProfile> Profiles;
+    FPicoUserProfile::InitArray(UserArray, Profiles);
+    if (PicoSubsystem.GetPicoUserInterface().IsValid())
     {
-        auto Friend = ppf_UserArray_GetElement(UserArray, FriendIndex);
-        FString FriendId = UTF8_TO_TCHAR(ppf_User_GetID(Friend));
-        FString FriendDisplayName = UTF8_TO_TCHAR(ppf_User_GetDisplayName(Friend));
-        auto FriendInviteToken = ppf_User_GetInviteToken(Friend);
-        FString FriendInviteTokenString(UTF8_TO_TCHAR((FriendInviteToken != nullptr) ? FriendInviteToken : ""));
-        FString SmallImageUrl = UTF8_TO_TCHAR(ppf_User_GetSmallImageUrl(Friend));
-        FString PresencePackage = UTF8_TO_TCHAR(ppf_User_GetPresencePackage(Friend));
-        FString ImageUrl = UTF8_TO_TCHAR(ppf_User_GetImageUrl(Friend));
-        ppfGender Gender = ppf_User_GetGender(Friend);
-        FString Presence = UTF8_TO_TCHAR(ppf_User_GetPresence(Friend));
-        FString PresenceDeeplinkMessage = UTF8_TO_TCHAR(ppf_User_GetPresenceDeeplinkMessage(Friend));
-        FString PresenceDestinationApiName = UTF8_TO_TCHAR(ppf_User_GetPresenceDestinationApiName(Friend));
-        FString PresenceLobbySessionId = UTF8_TO_TCHAR(ppf_User_GetPresenceLobbySessionId(Friend));
-        FString PresenceMatchSessionId = UTF8_TO_TCHAR(ppf_User_GetPresenceMatchSessionId(Friend));
-        auto FriendPresenceStatus = ppf_User_GetPresenceStatus(Friend);
-        FString PresenceExtra = ppf_User_GetPresenceExtra(Friend);
-        TSharedRef<FOnlinePicoFriend> OnlineFriend(new FOnlinePicoFriend(FriendId, FriendDisplayName, FriendPresenceStatus, FriendInviteTokenString,
-            ImageUrl, Gender, SmallImageUrl, PresencePackage, Presence, PresenceDeeplinkMessage, PresenceDestinationApiName, PresenceLobbySessionId,
-            PresenceMatchSessionId, PresenceExtra));
-
-        UE_LOG_ONLINE(Display, TEXT("PPF_GAME add friend in outlist: FriendId: %s, DisplayName: %s, InviteToken: %s"), *FriendId, *FriendDisplayName, *FriendInviteTokenString);
-        OutList.Add(FriendId, OnlineFriend);
+        PicoSubsystem.GetPicoUserInterface()->AddUserProfilesToCache(Profiles);
+    }
+    for (const FPicoUserProfile& Friend : Profiles)
+    {
+        TSharedRef<FOnlinePicoFriend> OnlineFriend(new FOnlinePicoFriend(Friend.ID, Friend.DisplayName, Friend.PresenceStatus, Friend.InviteToken,
+            Friend.ImageUrl, Friend.Gender, Friend.SmallImageUrl, Friend.PresencePackage, Friend.Presence, Friend.PresenceDeeplinkMessage, Friend.PresenceDestinationApiName, Friend.PresenceLobbySessionId,
+            Friend.PresenceMatchSessionId, Friend.PresenceExtra));
+
+        UE_LOG_ONLINE(Display, TEXT("PPF_GAME add friend in outlist: FriendId: %s, DisplayName: %s, InviteToken: %s"), *Friend.ID, *Friend.DisplayName, *Friend.InviteToken);
+        OutList.Add(Friend.ID, OnlineFriend);
     }
     bool bHasPaging = ppf_UserArray_HasNextPage(UserArray);
     if (bHasPaging)
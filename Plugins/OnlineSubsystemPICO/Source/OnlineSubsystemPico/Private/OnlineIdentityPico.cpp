@@ -385,7 +385,7 @@ void FOnlineIdentityPico::GetLinkedAccountAuthToken(int32 LocalUserNum, const FO
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
+                auto Error = PicoMessageGetError(Message);
                 FExternalAuthToken EmptyToken;
                 Delegate.ExecuteIfBound(LocalUserNum, false, EmptyToken);
             }
@@ -429,9 +429,9 @@ void FOnlineIdentityPico::GetLoginUserOpenID(FGetIDToken OnGetIdTokenDelegate)
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 OnGetIdTokenDelegate.ExecuteIfBound(true, ErrorMessage, FString());
             }
@@ -456,15 +456,18 @@ void FOnlineIdentityPico::OnLoginComplete(ppfMessageHandle Message, bool bIsErro
     UE_LOG_ONLINE_IDENTITY(Display, TEXT("FOnlineIdentityPico::OnLoginComplete"));
     if (!Message)
     {
+        // The request timed out, the login still has to report its failure
+        UE_LOG_ONLINE_IDENTITY(Warning, TEXT("Login timed out"));
+        TriggerOnLoginCompleteDelegates(LocalUserNum, false, *FUniqueNetIdPico::EmptyId(), TEXT("timeout"));
         return;
     }
     UE_LOG_ONLINE_IDENTITY(Log, TEXT("Login Complete!"));
     FString ErrorStr;
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        ErrorStr = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        ErrorStr = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorStr = ErrorStr + FString(". Error Code: ") + ErrorCode;
     }
     else
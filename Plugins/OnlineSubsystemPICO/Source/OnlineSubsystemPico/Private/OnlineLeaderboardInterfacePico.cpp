@@ -4,6 +4,7 @@
 #include "OnlineSubsystemPicoPrivate.h"
 #include "OnlineIdentityPico.h"
 #include "OnlineSubsystemPico.h"
+#include "Pico_Leaderboards.h"
 #include "OnlineSessionSettings.h"
 #include "Misc/FileHelper.h"
 
@@ -100,18 +101,22 @@ bool FOnlineLeaderboardPico::ReadPicoLeaderboards(bool bOnlyFriends, bool bOnlyL
 			, *FString(FilterTypeNames[FilterType])
 			, *FString(StartAtNames[StartAt])
 			, *LeaderboardName));
+	TSharedPtr<FPicoLeaderboardsInterface> LeaderboardsInterface = PicoSubsystem.GetPicoLeaderboardsInterface();
+	if (!LeaderboardsInterface.IsValid())
+	{
+		SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("ReadPicoLeaderboards PicoLeaderboardsInterface Not Vailed")));
+		return false;
+	}
 	ReadObject->ReadState = EOnlineAsyncTaskState::InProgress;
-	PicoSubsystem.AddAsyncTask(
-		ppf_Leaderboard_GetEntries(TCHAR_TO_ANSI(*LeaderboardName), PageSize, PageIndex, FilterType, StartAt),
-		FPicoMessageOnCompleteDelegate::CreateLambda([this, ReadObject, bOnlyFriends, bOnlyLoggedInUser](ppfMessageHandle Message, bool bIsError)
+	// Repeated reads of the same page are served from the leaderboards interface page cache
+	return LeaderboardsInterface->GetEntriesCached(LeaderboardName, PageIndex, PageSize, FilterType, StartAt,
+		FPicoLeaderboardPageDelegate::CreateLambda([this, ReadObject, bOnlyFriends, bOnlyLoggedInUser](bool bIsError, const FString& ErrorMessage, const FPicoLeaderboardPage& Page)
 		{
-			OnReadLeaderboardsComplete(Message, bIsError, bOnlyFriends, bOnlyLoggedInUser, ReadObject);
+			OnReadLeaderboardsComplete(Page, bIsError, ErrorMessage, bOnlyFriends, bOnlyLoggedInUser, ReadObject);
 		}));
-	
-	return true;
 }
 
-void FOnlineLeaderboardPico::OnReadLeaderboardsComplete(ppfMessageHandle Message, bool bIsError, bool bOnlyFriends, bool bOnlyLoggedInUser,
+void FOnlineLeaderboardPico::OnReadLeaderboardsComplete(const FPicoLeaderboardPage& Page, bool bIsError, const FString& ErrorMessage, bool bOnlyFriends, bool bOnlyLoggedInUser,
                                                         const FOnlineLeaderboardReadRef& ReadObject)
 {
 	const bool UseUEObject = !ReadObject->LeaderboardName.IsNone();
@@ -122,17 +127,12 @@ void FOnlineLeaderboardPico::OnReadLeaderboardsComplete(ppfMessageHandle Message
 		// 	ReadIndex = 0;
 		// }
 		ReadObject->ReadState = EOnlineAsyncTaskState::Failed;
-		auto Error = ppf_Message_GetError(Message);
-		FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
-		ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 		SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("OnReadLeaderboardsComplete ErrorMessage: %s"), *FString(ErrorMessage)));
 		TriggerOnLeaderboardReadCompleteDelegates(false);
 		return;
 	}
 	
-	const ppfLeaderboardEntryArrayHandle LeaderboardArray = ppf_Message_GetLeaderboardEntryArray(Message);
-	const auto LeaderboardArraySize = ppf_LeaderboardEntryArray_GetSize(LeaderboardArray);
+	const int32 LeaderboardArraySize = Page.Entries.Num();
 	EOnlineKeyValuePairDataType::Type ScoreType = EOnlineKeyValuePairDataType::Int64;
 	for (auto Metadata : ReadObject->ColumnMetadata)
 	{
@@ -143,17 +143,14 @@ void FOnlineLeaderboardPico::OnReadLeaderboardsComplete(ppfMessageHandle Message
 		}
 	}
 	IOnlineIdentityPtr Identity = PicoSubsystem.GetIdentityInterface();
-	SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("OnReadLeaderboardsComplete LeaderboardArraySize: %zu"), LeaderboardArraySize));
-	for (size_t i = 0; i < LeaderboardArraySize; i++)
+	SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("OnReadLeaderboardsComplete LeaderboardArraySize: %d"), LeaderboardArraySize));
+	ReadObject->Rows.Reserve(ReadObject->Rows.Num() + LeaderboardArraySize);
+	for (const FPicoLeaderboardEntryData& LeaderboardEntry : Page.Entries)
 	{
-		auto LeaderboardEntry = ppf_LeaderboardEntryArray_GetElement(LeaderboardArray, i);
-		auto User = ppf_LeaderboardEntry_GetUser(LeaderboardEntry);
-		auto UserID = ppf_User_GetID(User);
-		FString NickName = UTF8_TO_TCHAR(ppf_User_GetDisplayName(User));
-		auto Rank = ppf_LeaderboardEntry_GetRank(LeaderboardEntry);
-		auto Score = ppf_LeaderboardEntry_GetScore(LeaderboardEntry);
+		const int32 Rank = LeaderboardEntry.Rank;
+		const int64 Score = LeaderboardEntry.Score;
 		
-		auto Row = FOnlineStatsRow(NickName, MakeShareable(new FUniqueNetIdPico(UserID)));//FUniqueNetIdPico(NickName).AsShared());
+		auto Row = FOnlineStatsRow(LeaderboardEntry.UserDisplayName, MakeShareable(new FUniqueNetIdPico(LeaderboardEntry.UserID)));//FUniqueNetIdPico(NickName).AsShared());
 		if (Row.PlayerId.IsValid())
 		{
 			SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("OnReadLeaderboardsComplete Row[PlayerID: %s, Rank: %d, Score: %lld]"), *Row.PlayerId->ToString(), Rank, Score));
@@ -307,16 +304,20 @@ bool FOnlineLeaderboardPico::WriteLeaderboards(const FName& SessionName, const F
 				ppf_Leaderboard_WriteEntry(
 					TCHAR_TO_ANSI(*LeaderboardName.ToString()), Score, /* extra_data */ nullptr, 0,
 					(WriteObject.UpdateMethod == ELeaderboardUpdateMethod::Force)),
-				FPicoMessageOnCompleteDelegate::CreateLambda([this](ppfMessageHandle Message, bool bIsError)
+				FPicoMessageOnCompleteDelegate::CreateLambda([this, CachedLeaderboardName = LeaderboardName.ToString()](ppfMessageHandle Message, bool bIsError)
 				{
 					if (bIsError)
 					{
-						auto Error = ppf_Message_GetError(Message);
-                        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+						auto Error = PicoMessageGetError(Message);
+                        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 						SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("WriteLeaderboards ErrorMessage: %s"), *FString(ErrorMessage)));
 					}
+					else if (PicoSubsystem.GetPicoLeaderboardsInterface().IsValid())
+					{
+						PicoSubsystem.GetPicoLeaderboardsInterface()->InvalidateLeaderboardCache(CachedLeaderboardName);
+					}
 				}));
 		}
 	}
@@ -345,16 +346,20 @@ bool FOnlineLeaderboardPico::WriteLeaderboards(const FName& SessionName, const F
 				ppf_Leaderboard_WriteEntry(
 					TCHAR_TO_ANSI(*LeaderboardName), Score, /* extra_data */ nullptr, 0,
 					(PicoWriteObject->UpdateMethod == ELeaderboardUpdateMethod::Force)),
-				FPicoMessageOnCompleteDelegate::CreateLambda([this](ppfMessageHandle Message, bool bIsError)
+				FPicoMessageOnCompleteDelegate::CreateLambda([this, CachedLeaderboardName = LeaderboardName](ppfMessageHandle Message, bool bIsError)
 				{
 					if (bIsError)
 					{
-						auto Error = ppf_Message_GetError(Message);
-                        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+						auto Error = PicoMessageGetError(Message);
+                        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 						SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("WriteLeaderboards ErrorMessage: %s"), *FString(ErrorMessage)));
 					}
+					else if (PicoSubsystem.GetPicoLeaderboardsInterface().IsValid())
+					{
+						PicoSubsystem.GetPicoLeaderboardsInterface()->InvalidateLeaderboardCache(CachedLeaderboardName);
+					}
 				}));
 		}
 	}
@@ -33,7 +33,7 @@ private:
     FOnlineSubsystemPico& PicoSubsystem;
 
     bool ReadPicoLeaderboards(bool bOnlyFriends, bool bOnlyLoggedInUser, FOnlineLeaderboardReadRef& ReadObject);
-    void OnReadLeaderboardsComplete(ppfMessageHandle Message, bool bIsError, bool bOnlyFriends, bool bOnlyLoggedInUser, const FOnlineLeaderboardReadRef& ReadObject);
+    void OnReadLeaderboardsComplete(const struct FPicoLeaderboardPage& Page, bool bIsError, const FString& ErrorMessage, bool bOnlyFriends, bool bOnlyLoggedInUser, const FOnlineLeaderboardReadRef& ReadObject);
 
     const char* FilterTypeNames[4] = { "None", "Friends", "Unknown", "UserIds" };
     const char* StartAtNames[4] = { "Top", "CenteredOnViewer", "CenteredOnViewerOrTop", "Unknown" };
@@ -3,7 +3,10 @@
 
 #include "OnlineMessageTaskManagerPico.h"
 #include "OnlineSubsystemPicoPrivate.h"
+#include "PicoLog.h"
 #include "PPF_Message.h"
+#include "PPF_Room.h"
+#include "HAL/PlatformTime.h"
 
 FString FOnlineAsyncTaskPico::ToString() const
 {
@@ -29,21 +32,20 @@ FString FOnlineAsyncEventPico::ToString() const
     return FString();
 }
 
+bool FOnlineAsyncTaskPico::CanTimeOut() const
+{
+    return bCanTimeOut;
+}
+
 void FOnlineAsyncTaskPico::Tick()
 {
-    if (RequestId != ppfMessageType_User_GetAccessToken)
-    {
-        if (GetElapsedTime() >= 10.f)
-        {
-            bIsComplete = true;
-            bWasSuccessful = false;
-        }
-    }
+    // Timeouts are handled by the task manager's timing wheel
 }
 
 void FOnlineAsyncTaskPico::Finalize()
 {
-    UE_LOG_ONLINE(Log, TEXT("%s Task Finalize in %f seconds "), *ToString(), GetElapsedTime());
+    const float ElapsedSeconds = GetElapsedTime();
+    PICO_LOG_EVENT(LogOnline, Verbose, TEXT("Task finalized"), RequestId, ElapsedSeconds);
 }
 
 void FOnlineAsyncTaskPico::TriggerDelegates()
@@ -75,12 +77,253 @@ void FOnlineAsyncTaskPico::TaskReceiveMessage(ppfMessageHandle InMessageHandle,
     }
 }
 
+void FOnlineAsyncTaskPico::TaskTimeOut()
+{
+    bIsComplete = true;
+    bWasSuccessful = false;
+    UE_LOG_ONLINE(Warning, TEXT("%s Task timed out after %f seconds"), *ToString(), GetElapsedTime());
+    Delegate.ExecuteIfBound(nullptr, true);
+    Delegate.Unbind();
+}
+
+FPicoRequestTimingWheel::FPicoRequestTimingWheel(int32 InNumSlots, double InTickInterval) :
+    TickInterval(FMath::Max(InTickInterval, 0.001)),
+    CurrentTick(0),
+    bStarted(false)
+{
+    const int32 NumSlots = FMath::RoundUpToPowerOfTwo(FMath::Max(InNumSlots, 1));
+    Slots.SetNum(NumSlots);
+    SlotMask = static_cast<uint32>(NumSlots - 1);
+}
+
+void FPicoRequestTimingWheel::Schedule(ppfRequest RequestId, double TimeOut, double Now)
+{
+    if (!bStarted)
+    {
+        CurrentTick = static_cast<uint64>(Now / TickInterval);
+        bStarted = true;
+    }
+    const uint64 DeadlineTick = FMath::Max(static_cast<uint64>(FMath::CeilToDouble((Now + TimeOut) / TickInterval)), CurrentTick + 1);
+    const uint64 Ticks = DeadlineTick - CurrentTick;
+    const uint32 NumSlots = SlotMask + 1;
+    FEntry Entry;
+    Entry.RequestId = RequestId;
+    Entry.RemainingRounds = static_cast<uint32>((Ticks - 1) / NumSlots);
+    Slots[static_cast<uint32>(DeadlineTick & SlotMask)].Add(Entry);
+}
+
+void FPicoRequestTimingWheel::Advance(double Now, TArray<ppfRequest>& OutExpired)
+{
+    if (!bStarted)
+    {
+        return;
+    }
+    const uint64 TargetTick = static_cast<uint64>(Now / TickInterval);
+    // Never spin more than one revolution, every slot has been visited by then
+    if (TargetTick > CurrentTick + SlotMask + 1)
+    {
+        CurrentTick = TargetTick - SlotMask - 1;
+    }
+    while (CurrentTick < TargetTick)
+    {
+        ++CurrentTick;
+        TArray<FEntry>& Slot = Slots[static_cast<uint32>(CurrentTick & SlotMask)];
+        for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+        {
+            FEntry& Entry = Slot[Index];
+            if (Entry.RemainingRounds == 0)
+            {
+                OutExpired.Add(Entry.RequestId);
+                Slot.RemoveAtSwap(Index, 1, false);
+            }
+            else
+            {
+                --Entry.RemainingRounds;
+            }
+        }
+    }
+}
+
+void FPicoRequestTimingWheel::Reset()
+{
+    for (TArray<FEntry>& Slot : Slots)
+    {
+        Slot.Reset();
+    }
+    CurrentTick = 0;
+    bStarted = false;
+}
+
+FOnlineAsyncTaskManagerPico::FOnlineAsyncTaskManagerPico(class FOnlineSubsystemPico* InOnlineSubsystem) :
+    bDrainMessageQueue(true),
+    MaxMessagesPerTick(256),
+    MaxDrainTimePerTick(0.002),
+    RequestTimeOut(10.f),
+    PicoSubsystem(InOnlineSubsystem)
+{
+    if (GConfig)
+    {
+        float MaxDrainTimeMs = static_cast<float>(MaxDrainTimePerTick * 1000.0);
+        GConfig->GetBool(TEXT("OnlineSubsystemPico"), TEXT("bDrainMessageQueue"), bDrainMessageQueue, GEngineIni);
+        GConfig->GetInt(TEXT("OnlineSubsystemPico"), TEXT("MaxMessagesPerTick"), MaxMessagesPerTick, GEngineIni);
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("MaxMessageDrainTimeMs"), MaxDrainTimeMs, GEngineIni);
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("RequestTimeOutSeconds"), RequestTimeOut, GEngineIni);
+        MaxDrainTimePerTick = FMath::Max(MaxDrainTimeMs, 0.f) / 1000.0;
+    }
+
+    // A room filling up sends one update per member, the session only needs the latest state of each room
+    bool bCoalesceRoomUpdates = true;
+    if (GConfig)
+    {
+        GConfig->GetBool(TEXT("OnlineSubsystemPico"), TEXT("bCoalesceRoomUpdates"), bCoalesceRoomUpdates, GEngineIni);
+    }
+    if (bCoalesceRoomUpdates)
+    {
+        SetNotificationPolicy(ppfMessageType_Notification_Room_RoomUpdate, EPicoNotificationDelivery::Coalesce,
+            FPicoNotificationKeyDelegate::CreateLambda([](ppfMessageHandle Message)
+                {
+                    return static_cast<uint64>(ppf_Room_GetID(ppf_Message_GetRoom(Message)));
+                }));
+    }
+
+    // Every running asset download reports progress several times per second, listeners only need the latest state of each asset
+    bool bCoalesceAssetDownloadUpdates = true;
+    if (GConfig)
+    {
+        GConfig->GetBool(TEXT("OnlineSubsystemPico"), TEXT("bCoalesceAssetDownloadUpdates"), bCoalesceAssetDownloadUpdates, GEngineIni);
+    }
+    if (bCoalesceAssetDownloadUpdates)
+    {
+        SetNotificationPolicy(ppfMessageType_Notification_AssetFile_DownloadUpdate, EPicoNotificationDelivery::Coalesce,
+            FPicoNotificationKeyDelegate::CreateLambda([](ppfMessageHandle Message)
+                {
+                    return static_cast<uint64>(ppf_AssetFileDownloadUpdate_GetAssetId(ppf_Message_GetAssetFileDownloadUpdate(Message)));
+                }));
+    }
+}
+
+FOnlineAsyncTaskManagerPico::~FOnlineAsyncTaskManagerPico()
+{
+    for (auto& Item : RequestTaskMap)
+    {
+        delete Item.Value;
+    }
+    RequestTaskMap.Empty();
+    RequestTimingWheel.Reset();
+    for (const FPendingNotification& Pending : PendingNotifications)
+    {
+        ppf_FreeMessage(Pending.MessageHandle);
+    }
+    PendingNotifications.Empty();
+}
+
 void FOnlineAsyncTaskManagerPico::OnlineTick()
 {
 }
 
+bool FOnlineAsyncTaskManagerPico::DispatchMessage(ppfMessageHandle MessageHandle)
+{
+    bool bIsError = ppf_Message_IsError(MessageHandle);
+    ppfRequest RequestId = ppf_Message_GetRequestID(MessageHandle);
+    PICO_LOG_EVENT(LogOnline, Verbose, TEXT("Receive request"), RequestId);
+
+    FOnlineAsyncTaskPico* Item = nullptr;
+    if (RequestTaskMap.RemoveAndCopyValue(RequestId, Item))
+    {
+        // Merged notifications that arrived before this response are handled first, so listeners see the messages in arrival order
+        DeliverPendingNotifications();
+        // The timing wheel entry is dropped lazily once its slot comes around
+        Item->TaskReceiveMessage(MessageHandle, bIsError);
+        delete Item;
+        Item = nullptr;
+        return true;
+    }
+
+    ppfMessageType MessageType = ppf_Message_GetType(MessageHandle);
+    if (FPicoMulticastMessageOnCompleteDelegate* Delegate = NotificationMap.Find(MessageType))
+    {
+        PICO_LOG_EVENT(LogOnline, Verbose, TEXT("Receive notification"), MessageType);
+        if (DeferNotification(MessageType, MessageHandle, bIsError))
+        {
+            return true;
+        }
+        DeliverPendingNotifications();
+        ++NotificationStats.FindOrAdd(MessageType).Delivered;
+        FOnlineAsyncEventPico NewEvent(PicoSubsystem, MessageHandle, bIsError, *Delegate);
+        NewEvent.TriggerDelegates();
+        return true;
+    }
+    ppf_FreeMessage(MessageHandle);
+    return false;
+}
+
+bool FOnlineAsyncTaskManagerPico::DeferNotification(ppfMessageType MessageType, ppfMessageHandle MessageHandle, bool bIsError)
+{
+    FPicoNotificationStats& Stats = NotificationStats.FindOrAdd(MessageType);
+    ++Stats.Received;
+    const FPicoNotificationPolicy* Policy = NotificationPolicies.Find(MessageType);
+    // Errors carry no state to merge, they are always delivered
+    if (Policy == nullptr || Policy->Delivery == EPicoNotificationDelivery::Queue || bIsError)
+    {
+        return false;
+    }
+    const uint64 Key = (Policy->Delivery == EPicoNotificationDelivery::Coalesce && Policy->GetKey.IsBound()) ? Policy->GetKey.Execute(MessageHandle) : 0;
+    for (FPendingNotification& Pending : PendingNotifications)
+    {
+        if (Pending.MessageType == MessageType && Pending.Key == Key)
+        {
+            ppf_FreeMessage(Pending.MessageHandle);
+            Pending.MessageHandle = MessageHandle;
+            ++Stats.Merged;
+            return true;
+        }
+    }
+    FPendingNotification& Pending = PendingNotifications.AddDefaulted_GetRef();
+    Pending.MessageType = MessageType;
+    Pending.Key = Key;
+    Pending.MessageHandle = MessageHandle;
+    return true;
+}
+
+void FOnlineAsyncTaskManagerPico::DeliverPendingNotifications()
+{
+    // A listener that pumps messages while a batch is delivered leaves its notifications for the outer call
+    if (PendingNotifications.Num() == 0 || DeliveringNotifications.Num() > 0)
+    {
+        return;
+    }
+    Swap(PendingNotifications, DeliveringNotifications);
+    for (const FPendingNotification& Pending : DeliveringNotifications)
+    {
+        ++NotificationStats.FindOrAdd(Pending.MessageType).Delivered;
+        FOnlineAsyncEventPico NewEvent(PicoSubsystem, Pending.MessageHandle, false, NotificationMap.FindOrAdd(Pending.MessageType));
+        NewEvent.TriggerDelegates();
+    }
+    DeliveringNotifications.Reset();
+}
+
+void FOnlineAsyncTaskManagerPico::ExpireTimedOutTasks()
+{
+    ExpiredRequests.Reset();
+    RequestTimingWheel.Advance(FPlatformTime::Seconds(), ExpiredRequests);
+    for (ppfRequest RequestId : ExpiredRequests)
+    {
+        FOnlineAsyncTaskPico* Item = nullptr;
+        if (RequestTaskMap.RemoveAndCopyValue(RequestId, Item))
+        {
+            const float ElapsedTime = Item->GetElapsedTime();
+            Item->TaskTimeOut();
+            delete Item;
+            Item = nullptr;
+            OnRequestTimeOut.Broadcast(RequestId, ElapsedTime);
+        }
+    }
+}
+
 void FOnlineAsyncTaskManagerPico::TickTask()
 {
+    const double StartTime = FPlatformTime::Seconds();
+    int32 NumMessages = 0;
     for (;;)
     {
         ppfMessageHandle MessageHandle = ppf_PopMessage();
@@ -88,39 +331,47 @@ void FOnlineAsyncTaskManagerPico::TickTask()
         {
             break;
         }
-        UE_LOG_ONLINE(Log, TEXT("OnlineTick Receive Message !"));
-        bool bIsError = ppf_Message_IsError(MessageHandle);
-        ppfRequest RequestId = ppf_Message_GetRequestID(MessageHandle);
-        UE_LOG_ONLINE(Log, TEXT("Receive request id: %llu!"), RequestId);
-
-        if (RequestTaskMap.Contains(RequestId))
+        ++NumMessages;
+        const bool bConsumed = DispatchMessage(MessageHandle);
+        if (!bDrainMessageQueue)
+        {
+            if (bConsumed)
+            {
+                break;
+            }
+            continue;
+        }
+        if (MaxMessagesPerTick > 0 && NumMessages >= MaxMessagesPerTick)
         {
-            auto Item = RequestTaskMap[RequestId];
-            Item->TaskReceiveMessage(MessageHandle, bIsError);
-            delete Item;
-            Item = nullptr;
-            RequestTaskMap.Remove(RequestId);
             break;
         }
-
-        ppfMessageType MessageType = ppf_Message_GetType(MessageHandle);
-        if (NotificationMap.Contains(MessageType))
+        if (MaxDrainTimePerTick > 0.0 && FPlatformTime::Seconds() - StartTime >= MaxDrainTimePerTick)
         {
-            UE_LOG_ONLINE(Log, TEXT("Receive MessageTypeID: %i"), static_cast<int32>(MessageType));
-            FOnlineAsyncEventPico* NewEvent = new FOnlineAsyncEventPico(PicoSubsystem, MessageHandle, bIsError, NotificationMap[MessageType]);
-            NewEvent->TriggerDelegates();
-            delete NewEvent;
-            NewEvent = nullptr;
             break;
         }
-        ppf_FreeMessage(MessageHandle);
     }
+    if (NumMessages > 0)
+    {
+        const double DispatchSeconds = FPlatformTime::Seconds() - StartTime;
+        PICO_LOG_EVENT(LogOnline, VeryVerbose, TEXT("OnlineTick dispatched"), NumMessages, DispatchSeconds);
+    }
+
+    DeliverPendingNotifications();
+    ExpireTimedOutTasks();
 }
 
 void FOnlineAsyncTaskManagerPico::CollectedRequestTask(ppfRequest Request, FOnlineAsyncTaskPico* InTask)
 {
-    UE_LOG_ONLINE(Log, TEXT("Send request id: %i"), static_cast<int32>(Request));
+    PICO_LOG_EVENT(LogOnline, Verbose, TEXT("Send request"), Request);
+    if (FOnlineAsyncTaskPico** ExistingTask = RequestTaskMap.Find(Request))
+    {
+        delete *ExistingTask;
+    }
     RequestTaskMap.Add(Request, InTask);
+    if (InTask && InTask->CanTimeOut() && RequestTimeOut > 0.f)
+    {
+        RequestTimingWheel.Schedule(Request, RequestTimeOut, FPlatformTime::Seconds());
+    }
 }
 
 FPicoMulticastMessageOnCompleteDelegate& FOnlineAsyncTaskManagerPico::GetOrAddNotifyDelegate(ppfMessageType MessageType)
@@ -133,3 +384,16 @@ void FOnlineAsyncTaskManagerPico::RemoveNotifyDelegate(ppfMessageType MessageTyp
     NotificationMap.FindOrAdd(MessageType).Remove(Delegate);
 }
 
+void FOnlineAsyncTaskManagerPico::SetNotificationPolicy(ppfMessageType MessageType, EPicoNotificationDelivery Delivery, FPicoNotificationKeyDelegate GetKey)
+{
+    FPicoNotificationPolicy& Policy = NotificationPolicies.FindOrAdd(MessageType);
+    Policy.Delivery = Delivery;
+    Policy.GetKey = MoveTemp(GetKey);
+}
+
+FPicoNotificationStats FOnlineAsyncTaskManagerPico::GetNotificationStats(ppfMessageType MessageType) const
+{
+    const FPicoNotificationStats* Stats = NotificationStats.Find(MessageType);
+    return Stats != nullptr ? *Stats : FPicoNotificationStats();
+}
+
@@ -10,6 +10,10 @@
 #include "Misc/FileHelper.h"
 #include "Misc/MessageDialog.h"
 #include "Online/OnlineSessionNames.h"
+#include "PicoLog.h"
+
+// Unlike SaveLog, whose callers format the line before it is filtered, the line is only formatted if LogOnlineSession logs at that verbosity
+#define PICO_SESSION_LOG(Verbosity, Format, ...) PICO_LOG(LogOnlineSession, Verbosity, TEXT("PPF_GAME ") Format, ##__VA_ARGS__)
 
 FOnlineSessionInfoPico::FOnlineSessionInfoPico(ppfID RoomId) :
 #if ENGINE_MAJOR_VERSION > 4
@@ -365,9 +369,9 @@ void FOnlineSessionPico::OnCreateRoomComplete(ppfMessageHandle Message, bool bIs
     }
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("OnCreateRoomComplete ErrorMessage: %s"), *FString(ErrorMessage)));
         RemoveNamedSession(SessionName);
@@ -483,60 +487,140 @@ bool FOnlineSessionPico::UpdateRoomDataStore(FName SessionName, FOnlineSessionSe
         SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("UpdateRoomDataStore cannot find session: %s"), *SessionName.ToString()));
         return false;
     }
-    int NewDataStoreSize = 0;
-    for (auto Setting : UpdatedSessionSettings.Settings)
+    const ppfID RoomID = GetRoomIDOfSession(*Session);
+    FRoomDataStoreSyncState& SyncState = RoomDataStoreSyncStates.FindOrAdd(SessionName);
+    if (SyncState.RoomID != RoomID)
     {
-        NewDataStoreSize++;
+        SyncState.RoomID = RoomID;
+        SyncState.SentValueHashes.Reset();
     }
-    int index = 0;
 
-    ppfKeyValuePairArray DataStore = ppf_KeyValuePairArray_Create(NewDataStoreSize);
+    // Only keys whose value changed since the last successful send go to the room.
+    // The UTF-8 copies must stay alive until ppf_Room_UpdateDataStore has consumed the array.
+    TArray<TArray<ANSICHAR>> UTF8Strings;
+    TArray<TPair<FName, uint32>, TInlineAllocator<16>> ChangedKeys;
+    UTF8Strings.Reserve(UpdatedSessionSettings.Settings.Num() * 2);
+    auto AddUTF8String = [&UTF8Strings](const FTCHARToUTF8& Converted)
+    {
+        TArray<ANSICHAR>& Buffer = UTF8Strings.AddDefaulted_GetRef();
+        Buffer.SetNumUninitialized(Converted.Length() + 1);
+        FMemory::Memcpy(Buffer.GetData(), Converted.Get(), Converted.Length());
+        Buffer[Converted.Length()] = '\0';
+    };
     for (auto& Setting : UpdatedSessionSettings.Settings)
     {
-        auto Key = new FTCHARToUTF8(*Setting.Key.ToString());
-        auto Value = new FTCHARToUTF8(*Setting.Value.Data.ToString());
-        auto item = ppf_KeyValuePairArray_GetElement(DataStore, index);
-        ppf_KeyValuePair_SetKey(item, Key->Get());
-        ppf_KeyValuePair_SetStringValue(item, Value->Get());
-        index++;
+        // Hashed as UTF-8, the form room updates hash the data store values in
+        const FTCHARToUTF8 Value(*Setting.Value.Data.ToString());
+        const uint32 ValueHash = FCrc::MemCrc32(Value.Get(), Value.Length());
+        const uint32* SentHash = SyncState.SentValueHashes.Find(Setting.Key);
+        if (SentHash != nullptr && *SentHash == ValueHash)
+        {
+            continue;
+        }
+        AddUTF8String(FTCHARToUTF8(*Setting.Key.ToString()));
+        AddUTF8String(Value);
+        ChangedKeys.Emplace(Setting.Key, ValueHash);
+    }
+
+    const int NewDataStoreSize = ChangedKeys.Num();
+    if (NewDataStoreSize == 0)
+    {
+        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateRoomDataStore nothing changed in session: %s"), *SessionName.ToString()));
+        TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+        return true;
+    }
+
+    ppfKeyValuePairArray DataStore = ppf_KeyValuePairArray_Create(NewDataStoreSize);
+    for (int Index = 0; Index < NewDataStoreSize; Index++)
+    {
+        auto Item = ppf_KeyValuePairArray_GetElement(DataStore, Index);
+        ppf_KeyValuePair_SetKey(Item, UTF8Strings[Index * 2].GetData());
+        ppf_KeyValuePair_SetStringValue(Item, UTF8Strings[Index * 2 + 1].GetData());
     }
+    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateRoomDataStore sending %d of %d keys"), NewDataStoreSize, UpdatedSessionSettings.Settings.Num()));
 
-    if (NewDataStoreSize > 0)
+    // Record the hashes now so a second update issued before this one completes does not resend the same values.
+    TArray<FName> SentKeys;
+    SentKeys.Reserve(NewDataStoreSize);
+    for (const TPair<FName, uint32>& ChangedKey : ChangedKeys)
     {
-        PicoSubsystem.AddAsyncTask(
-            ppf_Room_UpdateDataStore(GetRoomIDOfSession(*Session), DataStore, NewDataStoreSize),
-            FPicoMessageOnCompleteDelegate::CreateLambda([this, SessionName](ppfMessageHandle Message, bool bIsError)
+        SyncState.SentValueHashes.Add(ChangedKey.Key, ChangedKey.Value);
+        SentKeys.Add(ChangedKey.Key);
+    }
+
+    PicoSubsystem.AddAsyncTask(
+        ppf_Room_UpdateDataStore(RoomID, DataStore, NewDataStoreSize),
+        FPicoMessageOnCompleteDelegate::CreateLambda([this, SessionName, SentKeys = MoveTemp(SentKeys)](ppfMessageHandle Message, bool bIsError)
+            {
+                if (bIsError)
                 {
-                    if (bIsError)
+                    // The room never got these values, send them again with the next update
+                    if (FRoomDataStoreSyncState* FailedSyncState = RoomDataStoreSyncStates.Find(SessionName))
                     {
-                        auto Error = ppf_Message_GetError(Message);
-                        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
-                        ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
-                        SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateRoomDataStore ErrorMessage: %s"), *FString(ErrorMessage)));
-                        TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
-                        return;
+                        for (const FName& SentKey : SentKeys)
+                        {
+                            FailedSyncState->SentValueHashes.Remove(SentKey);
+                        }
                     }
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+                    ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+                    SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateRoomDataStore ErrorMessage: %s"), *FString(ErrorMessage)));
+                    TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+                    return;
+                }
 
-                    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateRoomDataStore no error")));
-                    auto NewSession = GetNamedSession(SessionName);
-                    if (NewSession == nullptr)
-                    {
-                        SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateRoomDataStore Session: %s does not exist"), *SessionName.ToString()));
-                        TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
-                        return;
-                    }
-                    auto Room = ppf_Message_GetRoom(Message);
-                    UpdateSessionFromRoom(*NewSession, Room);
-                    TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
-                }));
-        ppf_KeyValuePairArray_Destroy(DataStore);
+                SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateRoomDataStore no error")));
+                auto NewSession = GetNamedSession(SessionName);
+                if (NewSession == nullptr)
+                {
+                    SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateRoomDataStore Session: %s does not exist"), *SessionName.ToString()));
+                    TriggerOnUpdateSessionCompleteDelegates(SessionName, false);
+                    return;
+                }
+                auto Room = ppf_Message_GetRoom(Message);
+                UpdateSessionFromRoom(*NewSession, Room, ResetRoomDataStoreHashes(SessionName, Room));
+                TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+            }));
+    ppf_KeyValuePairArray_Destroy(DataStore);
+    return true;
+}
+
+TMap<FName, uint32>* FOnlineSessionPico::ResetRoomDataStoreHashes(FName SessionName, ppfRoomHandle Room)
+{
+    FRoomDataStoreSyncState* SyncState = RoomDataStoreSyncStates.Find(SessionName);
+    if (SyncState == nullptr || SyncState->RoomID != ppf_Room_GetID(Room))
+    {
+        return nullptr;
     }
-    else
+    // The room is the source of truth: a key another member changed must not be skipped when this client sets it back
+    SyncState->SentValueHashes.Reset();
+    return &SyncState->SentValueHashes;
+}
+
+FName FOnlineSessionPico::GetDataStoreKeyName(const char* UTF8Key) const
+{
+    // Rooms use a handful of keys, a cache that grew this large is fed unrelated keys and starts over
+    constexpr int32 MaxDataStoreKeyNames = 1024;
+
+    const int32 KeyLength = FCStringAnsi::Strlen(UTF8Key);
+    const uint32 KeyHash = FCrc::MemCrc32(UTF8Key, KeyLength);
+    if (const FDataStoreKeyName* Cached = DataStoreKeyNames.Find(KeyHash))
     {
-        TriggerOnUpdateSessionCompleteDelegates(SessionName, true);
+        if (Cached->UTF8Key.Num() == KeyLength && FMemory::Memcmp(Cached->UTF8Key.GetData(), UTF8Key, KeyLength) == 0)
+        {
+            return Cached->Name;
+        }
     }
-    return true;
+    if (DataStoreKeyNames.Num() >= MaxDataStoreKeyNames)
+    {
+        DataStoreKeyNames.Reset();
+    }
+    FDataStoreKeyName& Added = DataStoreKeyNames.Add(KeyHash);
+    Added.UTF8Key.Append(UTF8Key, KeyLength);
+    Added.Name = FName(UTF8_TO_TCHAR(UTF8Key));
+    return Added.Name;
 }
 
 bool FOnlineSessionPico::EndSession(FName SessionName)
@@ -586,9 +670,9 @@ bool FOnlineSessionPico::DestroySession(FName SessionName, const FOnDestroySessi
             {
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("DestroySession error! ErrorMessage: %s"), *FString(ErrorMessage)));
                     CompletionDelegate.ExecuteIfBound(SessionName, false);
@@ -683,9 +767,9 @@ bool FOnlineSessionPico::StartMatchmaking(const TArray< TSharedRef<const FUnique
             {
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("StartMatchmaking OnComplete ErrorMessage: %s"), *FString(ErrorMessage)));
                     SearchSettings->SearchState = EOnlineAsyncTaskState::Failed;
@@ -717,9 +801,9 @@ bool FOnlineSessionPico::CancelMatchmaking(int32 SearchingPlayerNum, FName Sessi
             {
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("CancelMatchmaking OnComplete ErrorMessage: %s"), *FString(ErrorMessage)));
                     TriggerOnCancelMatchmakingCompleteDelegates(SessionName, false);
@@ -803,13 +887,13 @@ bool FOnlineSessionPico::FindModeratedRoomSessions(const TSharedRef<FOnlineSessi
     SearchSettings->SearchState = EOnlineAsyncTaskState::InProgress;
     PicoSubsystem.AddAsyncTask(
         ppf_Room_GetModeratedRooms(FCString::Atoi(*PageIndex), FCString::Atoi(*PageSize)),
-        FPicoMessageOnCompleteDelegate::CreateLambda([this, SearchSettings](ppfMessageHandle Message, bool bIsError)
+        FPicoMessageOnCompleteDelegate::CreateLambda([this, SearchSettings, Query = FString::Printf(TEXT("moderated:%s:%s"), *PageIndex, *PageSize)](ppfMessageHandle Message, bool bIsError)
             {
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindModeratedRoomSessions OnComplete ErrorMessage: %s"), *FString(ErrorMessage)));
                     SearchSettings->SearchState = EOnlineAsyncTaskState::Failed;
@@ -826,22 +910,28 @@ bool FOnlineSessionPico::FindModeratedRoomSessions(const TSharedRef<FOnlineSessi
                 SearchSettings->SearchResults.Reset(SearchResultsSize);
                 int32 BuildUniqueId = GetBuildUniqueId();
                 SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("FindModeratedRoomSessions GetBuildUniqueId(): %d"), BuildUniqueId));
+                FSessionBrowserPass Pass = BeginSessionBrowserPass(Query);
                 for (size_t i = 0; i < SearchResultsSize; i++)
                 {
                     auto Room = ppf_RoomArray_GetElement(RoomArray, i);
-                    int32 ServerBuildId = GetRoomBuildUniqueId(Room);
-                    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("FindModeratedRoomSessions ServerBuildId: %d"), ServerBuildId));
-                    if (ServerBuildId != 0 && ServerBuildId != BuildUniqueId)
+                    bool bRebuilt = false;
+                    auto Session = GetBrowsedSession(Pass, Room, bRebuilt);
+                    if (bRebuilt)
                     {
-                        SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindModeratedRoomSessions ServerBuildId != 0 && ServerBuildId != BuildUniqueId")));
-                        // continue;
+                        int32 ServerBuildId = GetRoomBuildUniqueId(Room);
+                        SaveLog(ELogVerbosity::Type::Verbose, FString::Printf(TEXT("FindModeratedRoomSessions ServerBuildId: %d"), ServerBuildId));
+                        if (ServerBuildId != 0 && ServerBuildId != BuildUniqueId)
+                        {
+                            SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindModeratedRoomSessions ServerBuildId != 0 && ServerBuildId != BuildUniqueId")));
+                            // continue;
+                        }
                     }
-                    auto Session = CreateSessionFromRoom(Room);
                     auto SearchResult = FOnlineSessionSearchResult();
                     SearchResult.Session = Session.Get();
                     SearchResult.PingInMs = 0;
                     SearchSettings->SearchResults.Add(MoveTemp(SearchResult));
                 }
+                EndSessionBrowserPass(Pass);
                 SearchSettings->SearchState = EOnlineAsyncTaskState::Done;
                 TriggerOnFindSessionsCompleteDelegates(true);
             }));
@@ -865,13 +955,13 @@ bool FOnlineSessionPico::FindMatchmakingSessions(const FString Pool, const TShar
     ppfMatchmakingOptionsHandle MatchmakingOptions = ppf_MatchmakingOptions_Create();
     PicoSubsystem.AddAsyncTask(
         ppf_Matchmaking_Browse2(TCHAR_TO_UTF8(*Pool), MatchmakingOptions),
-        FPicoMessageOnCompleteDelegate::CreateLambda([this, SearchSettings](ppfMessageHandle Message, bool bIsError)
+        FPicoMessageOnCompleteDelegate::CreateLambda([this, SearchSettings, Query = TEXT("pool:") + Pool](ppfMessageHandle Message, bool bIsError)
             {
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindMatchmakingSessions OnComplete ErrorMessage: %s"), *FString(ErrorMessage)));
                     SearchSettings->SearchState = EOnlineAsyncTaskState::Failed;
@@ -890,23 +980,29 @@ bool FOnlineSessionPico::FindMatchmakingSessions(const FString Pool, const TShar
                 SearchSettings->SearchResults.Reset(SearchResultsSize);
                 int32 BuildUniqueId = GetBuildUniqueId();
                 SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("FindMatchmakingSessions GetBuildUniqueId(): %d"), BuildUniqueId));
+                FSessionBrowserPass Pass = BeginSessionBrowserPass(Query);
                 for (size_t i = 0; i < SearchResultsSize; i++)
                 {
                     auto MatchmakingRoom = ppf_MatchmakingRoomArray_GetElement(RoomArray, i);
                     auto Room = ppf_MatchmakingRoom_GetRoom(MatchmakingRoom);
-                    int32 ServerBuildId = GetRoomBuildUniqueId(Room);
-                    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("FindMatchmakingSessions ServerBuildId: %d"), ServerBuildId));
-                    if (ServerBuildId != BuildUniqueId)
+                    bool bRebuilt = false;
+                    auto Session = GetBrowsedSession(Pass, Room, bRebuilt);
+                    if (bRebuilt)
                     {
-                        SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindMatchmakingSessions ServerBuildId != BuildUniqueId")));
-                        // continue;
+                        int32 ServerBuildId = GetRoomBuildUniqueId(Room);
+                        SaveLog(ELogVerbosity::Type::Verbose, FString::Printf(TEXT("FindMatchmakingSessions ServerBuildId: %d"), ServerBuildId));
+                        if (ServerBuildId != BuildUniqueId)
+                        {
+                            SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("FindMatchmakingSessions ServerBuildId != BuildUniqueId")));
+                            // continue;
+                        }
                     }
-                    auto Session = CreateSessionFromRoom(Room);
                     auto SearchResult = FOnlineSessionSearchResult();
                     SearchResult.Session = Session.Get();
                     SearchResult.PingInMs = ppf_MatchmakingRoom_HasPingTime(MatchmakingRoom) ? ppf_MatchmakingRoom_GetPingTime(MatchmakingRoom) : 0;
                     SearchSettings->SearchResults.Add(MoveTemp(SearchResult));
                 }
+                EndSessionBrowserPass(Pass);
                 SearchSettings->SearchState = EOnlineAsyncTaskState::Done;
                 TriggerOnFindSessionsCompleteDelegates(true);
             }));
@@ -948,9 +1044,9 @@ bool FOnlineSessionPico::FindSessionById(const FUniqueNetId& SearchingUserId, co
                 auto SearchResult = FOnlineSessionSearchResult();
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("FindSessionById ErrorMessage: %s"), *FString(ErrorMessage)));
                     CompletionDelegate.ExecuteIfBound(0, false, SearchResult);
@@ -1021,16 +1117,16 @@ bool FOnlineSessionPico::JoinSession(int32 PlayerNum, FName SessionName, const F
         ppf_Room_Join2(RoomId, RoomOptions),
         FPicoMessageOnCompleteDelegate::CreateLambda([this, SessionName, Session](ppfMessageHandle Message, bool bIsError)
             {
-                auto Room = ppf_Message_GetRoom(Message);
+                auto Room = Message ? ppf_Message_GetRoom(Message) : nullptr;
                 if (bIsError)
                 {
-                    auto Error = ppf_Message_GetError(Message);
-                    FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                    FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                    auto Error = PicoMessageGetError(Message);
+                    FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                    FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                     ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                     SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("JoinSession OnComplete ErrorMessage: %s"), *FString(ErrorMessage)));
                     RemoveNamedSession(SessionName);
-                    auto RoomJoinability = ppf_Room_GetJoinability(Room);
+                    auto RoomJoinability = Room ? ppf_Room_GetJoinability(Room) : ppfRoom_JoinabilityUnknown;
                     SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("JoinSession RoomJoinability: %s"), *FString(JoinabilityNames[RoomJoinability])));
                     EOnJoinSessionCompleteResult::Type FailureReason;
                     if (RoomJoinability == ppfRoom_JoinabilityIsFull)
@@ -1374,6 +1470,7 @@ void FOnlineSessionPico::RemoveNamedSession(FName SessionName)
     {
         Sessions.Remove(SessionName);
     }
+    RoomDataStoreSyncStates.Remove(SessionName);
 }
 
 EOnlineSessionState::Type FOnlineSessionPico::GetSessionState(FName SessionName) const
@@ -1422,13 +1519,13 @@ TSharedRef<FOnlineSession> FOnlineSessionPico::CreateSessionFromRoom(ppfRoomHand
     auto RoomPolicy = ppf_Room_GetJoinPolicy(Room);
     auto RoomJoinability = ppf_Room_GetJoinability(Room);
     auto RoomType = ppf_Room_GetType(Room);
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("CreateSessionFromRoom RoomId: %llu, RoomMaxUsers: %d, RoomCurrentUsersSize: %zu, RoomPolicy: %s, RoomType: %s, RoomJoinability: %s")
-        , RoomId, RoomMaxUsers, RoomCurrentUsersSize, *FString(JoinPolicyNames[RoomPolicy]), *FString(RoomTypeNames[RoomType]), *FString(JoinabilityNames[RoomJoinability])));
+    PICO_SESSION_LOG(Verbose, TEXT("CreateSessionFromRoom RoomId: %llu, RoomMaxUsers: %d, RoomCurrentUsersSize: %zu, RoomPolicy: %s, RoomType: %s, RoomJoinability: %s")
+        , RoomId, RoomMaxUsers, RoomCurrentUsersSize, *FString(JoinPolicyNames[RoomPolicy]), *FString(RoomTypeNames[RoomType]), *FString(JoinabilityNames[RoomJoinability]));
     for (size_t UserIndex = 0; UserIndex < RoomCurrentUsersSize; ++UserIndex)
     {
         auto User = ppf_UserArray_GetElement(RoomUsers, UserIndex);
         FString RoomOwnerIdString = UTF8_TO_TCHAR(ppf_User_GetID(User));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("CreateSessionFromRoom UserIndex: %zu, UserId: %s"), UserIndex, *RoomOwnerIdString));
+        PICO_SESSION_LOG(Verbose, TEXT("CreateSessionFromRoom UserIndex: %zu, UserId: %s"), UserIndex, *RoomOwnerIdString);
     }
     auto SessionSettings = FOnlineSessionSettings();
     SessionSettings.NumPublicConnections = RoomMaxUsers;
@@ -1452,6 +1549,96 @@ TSharedRef<FOnlineSession> FOnlineSessionPico::CreateSessionFromRoom(ppfRoomHand
     return MakeShareable(Session);
 }
 
+uint32 FOnlineSessionPico::GetRoomFingerprint(ppfRoomHandle Room)
+{
+    const uint32 Fields[] = {
+        static_cast<uint32>(ppf_Room_GetMaxUsers(Room)),
+        static_cast<uint32>(ppf_UserArray_GetSize(ppf_Room_GetUsers(Room))),
+        static_cast<uint32>(ppf_Room_GetJoinPolicy(Room)),
+        static_cast<uint32>(ppf_Room_GetJoinability(Room)),
+        static_cast<uint32>(ppf_Room_GetType(Room))
+    };
+    uint32 Crc = FCrc::MemCrc32(Fields, sizeof(Fields));
+
+    // Strings are hashed as the UTF-8 the platform returns, including the terminator so that adjacent strings cannot run together
+    auto HashString = [&Crc](const char* String)
+    {
+        if (String)
+        {
+            Crc = FCrc::MemCrc32(String, FCStringAnsi::Strlen(String) + 1, Crc);
+        }
+    };
+    auto RoomOwner = ppf_Room_GetOwner(Room);
+    HashString(ppf_User_GetID(RoomOwner));
+    HashString(ppf_User_GetDisplayName(RoomOwner));
+    auto DataStore = ppf_Room_GetDataStore(Room);
+    for (size_t KeyIndex = 0, NumKeys = ppf_DataStore_GetNumKeys(DataStore); KeyIndex < NumKeys; ++KeyIndex)
+    {
+        const char* Key = ppf_DataStore_GetKey(DataStore, static_cast<int>(KeyIndex));
+        HashString(Key);
+        HashString(ppf_DataStore_GetValue(DataStore, Key));
+    }
+    return Crc;
+}
+
+FOnlineSessionPico::FSessionBrowserPass FOnlineSessionPico::BeginSessionBrowserPass(const FString& Query)
+{
+    FSessionBrowserPass Pass;
+    Pass.Query = Query;
+    if (TMap<ppfID, FBrowsedRoom>* PreviousRooms = BrowsedRooms.Find(Query))
+    {
+        Pass.PreviousRooms = MoveTemp(*PreviousRooms);
+        Pass.Rooms.Reserve(Pass.PreviousRooms.Num());
+    }
+    return Pass;
+}
+
+TSharedRef<FOnlineSession> FOnlineSessionPico::GetBrowsedSession(FSessionBrowserPass& Pass, ppfRoomHandle Room, bool& bOutRebuilt) const
+{
+    const ppfID RoomId = ppf_Room_GetID(Room);
+    const uint32 Fingerprint = GetRoomFingerprint(Room);
+
+    FBrowsedRoom PreviousRoom;
+    const bool bWasBrowsed = Pass.PreviousRooms.RemoveAndCopyValue(RoomId, PreviousRoom);
+    bOutRebuilt = !bWasBrowsed || PreviousRoom.Fingerprint != Fingerprint;
+
+    FBrowsedRoom& BrowsedRoom = Pass.Rooms.Add(RoomId);
+    BrowsedRoom.Fingerprint = Fingerprint;
+    if (bOutRebuilt)
+    {
+        BrowsedRoom.Session = CreateSessionFromRoom(Room);
+        (bWasBrowsed ? Pass.UpdatedRoomIDs : Pass.AddedRoomIDs).Add(FString::Printf(TEXT("%llu"), RoomId));
+    }
+    else
+    {
+        BrowsedRoom.Session = MoveTemp(PreviousRoom.Session);
+    }
+    return BrowsedRoom.Session.ToSharedRef();
+}
+
+void FOnlineSessionPico::EndSessionBrowserPass(FSessionBrowserPass& Pass)
+{
+    TArray<FString> RemovedRoomIDs;
+    RemovedRoomIDs.Reserve(Pass.PreviousRooms.Num());
+    for (const TPair<ppfID, FBrowsedRoom>& PreviousRoom : Pass.PreviousRooms)
+    {
+        RemovedRoomIDs.Add(FString::Printf(TEXT("%llu"), PreviousRoom.Key));
+    }
+    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("EndSessionBrowserPass Query: %s, Rooms: %d, Added: %d, Updated: %d, Removed: %d")
+        , *Pass.Query, Pass.Rooms.Num(), Pass.AddedRoomIDs.Num(), Pass.UpdatedRoomIDs.Num(), RemovedRoomIDs.Num()));
+
+    BrowsedRooms.Add(Pass.Query, MoveTemp(Pass.Rooms));
+    if (Pass.AddedRoomIDs.Num() > 0 || Pass.UpdatedRoomIDs.Num() > 0 || RemovedRoomIDs.Num() > 0)
+    {
+        SessionBrowserDeltaCallback.Broadcast(Pass.Query, Pass.AddedRoomIDs, Pass.UpdatedRoomIDs, RemovedRoomIDs);
+    }
+}
+
+void FOnlineSessionPico::ClearSessionBrowserCache()
+{
+    BrowsedRooms.Empty();
+}
+
 void FOnlineSessionPico::LogRoomData(ppfRoomHandle Room) const
 {
     auto RoomId = ppf_Room_GetID(Room);
@@ -1463,18 +1650,18 @@ void FOnlineSessionPico::LogRoomData(ppfRoomHandle Room) const
     auto RoomPolicy = ppf_Room_GetJoinPolicy(Room);
     auto RoomJoinability = ppf_Room_GetJoinability(Room);
     auto RoomType = ppf_Room_GetType(Room);
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("LogRoomData RoomId: %llu, RoomMaxUsers: %d, RoomCurrentUsersSize: %zu, RoomPolicy: %s, RoomType: %s, RoomJoinability: %s")
-        , RoomId, RoomMaxUsers, RoomCurrentUsersSize, *FString(JoinPolicyNames[RoomPolicy]), *FString(RoomTypeNames[RoomType]), *FString(JoinabilityNames[RoomJoinability])));
+    PICO_SESSION_LOG(Verbose, TEXT("LogRoomData RoomId: %llu, RoomMaxUsers: %d, RoomCurrentUsersSize: %zu, RoomPolicy: %s, RoomType: %s, RoomJoinability: %s")
+        , RoomId, RoomMaxUsers, RoomCurrentUsersSize, *FString(JoinPolicyNames[RoomPolicy]), *FString(RoomTypeNames[RoomType]), *FString(JoinabilityNames[RoomJoinability]));
 }
 
-void FOnlineSessionPico::UpdateSessionFromRoom(FNamedOnlineSession & Session, ppfRoomHandle Room) const
+void FOnlineSessionPico::UpdateSessionFromRoom(FNamedOnlineSession & Session, ppfRoomHandle Room, TMap<FName, uint32>* OutDataStoreHashes) const
 {
     if (!IsInitSuccess())
     {
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateSessionFromRoom %s"), *InitStateErrorMessage));
         return;
     }
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom begin")));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom begin"));
     LogRoomData(Room);
     auto UserArray = ppf_Room_GetUsers(Room);
     auto UserArraySize = ppf_UserArray_GetSize(UserArray);
@@ -1485,7 +1672,7 @@ void FOnlineSessionPico::UpdateSessionFromRoom(FNamedOnlineSession & Session, pp
 #elif ENGINE_MINOR_VERSION > 24
     TArray< TSharedRef<const FUniqueNetId> > Players;
 #endif
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom UserArraySize: %zu"), UserArraySize));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom UserArraySize: %zu"), UserArraySize);
     for (size_t UserIndex = 0; UserIndex < UserArraySize; ++UserIndex)
     {
         auto User = ppf_UserArray_GetElement(UserArray, UserIndex);
@@ -1498,19 +1685,19 @@ void FOnlineSessionPico::UpdateSessionFromRoom(FNamedOnlineSession & Session, pp
         TSharedRef<const FUniqueNetId>  PlayerId = MakeShareable(new FUniqueNetIdPico(UserId));
 #endif
         Players.Add(PlayerId);
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom UserIndex: %zu, UserId: %s, PlayerId: %s, PlayerId->IsValid(): %d"), UserIndex, *UserId, *PlayerId->ToString(), PlayerId->IsValid()));
+        PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom UserIndex: %zu, UserId: %s, PlayerId: %s, PlayerId->IsValid(): %d"), UserIndex, *UserId, *PlayerId->ToString(), PlayerId->IsValid());
     }
     Session.RegisteredPlayers = Players;
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom NumPublicConnections: %d"), Session.SessionSettings.NumPublicConnections));
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom ppf_Room_GetMaxUsers: %d"), ppf_Room_GetMaxUsers(Room)));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom NumPublicConnections: %d"), Session.SessionSettings.NumPublicConnections);
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom ppf_Room_GetMaxUsers: %d"), ppf_Room_GetMaxUsers(Room));
     Session.SessionSettings.NumPublicConnections = ppf_Room_GetMaxUsers(Room);
     auto RemainingConnections = Session.SessionSettings.NumPublicConnections - UserArraySize;
     Session.NumOpenPublicConnections = (RemainingConnections > 0) ? RemainingConnections : 0;
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom set NumOpenPublicConnections: %d"), Session.NumOpenPublicConnections));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom set NumOpenPublicConnections: %d"), Session.NumOpenPublicConnections);
     Session.NumOpenPrivateConnections = 0;
     auto RoomOwner = ppf_Room_GetOwner(Room);
     FString RoomOwnerIdString = UTF8_TO_TCHAR(ppf_User_GetID(RoomOwner));
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom RoomOwnerIdString: %s"), *RoomOwnerIdString));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom RoomOwnerIdString: %s"), *RoomOwnerIdString);
     //auto RoomOwnerUniqueIdPtr = FUniqueNetIdPico::Create(RoomOwnerIdString);
 
 #if ENGINE_MAJOR_VERSION > 4
@@ -1520,78 +1707,123 @@ void FOnlineSessionPico::UpdateSessionFromRoom(FNamedOnlineSession & Session, pp
 #elif ENGINE_MINOR_VERSION > 24
     TSharedRef<const FUniqueNetId> RoomOwnerUniqueIdPtr = MakeShareable(new FUniqueNetIdPico(RoomOwnerIdString));
 #endif
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom RoomOwnerUniqueId: %s"), *RoomOwnerUniqueIdPtr->ToString()));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom RoomOwnerUniqueId: %s"), *RoomOwnerUniqueIdPtr->ToString());
 
     if (!Session.OwningUserId.IsValid() || Session.OwningUserId.ToSharedRef().Get() != *RoomOwnerUniqueIdPtr)
     {
         Session.OwningUserId = RoomOwnerUniqueIdPtr;
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom set OwningUserId: %s"), *(Session.OwningUserId->ToString())));
+        PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom set OwningUserId: %s"), *(Session.OwningUserId->ToString()));
         Session.OwningUserName = UTF8_TO_TCHAR(ppf_User_GetDisplayName(RoomOwner));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom set OwningUserName : %s"), *Session.OwningUserName));
+        PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom set OwningUserName : %s"), *Session.OwningUserName);
         if (Session.LocalOwnerId.IsValid())
         {
             Session.bHosting = Session.OwningUserId.ToSharedRef().Get() == *Session.LocalOwnerId;
         }
         else
         {
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom Session.LocalOwnerId is invalid")));
+            PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom Session.LocalOwnerId is invalid"));
             Session.bHosting = false;
         }
     }
     TestDumpNamedSession(&Session);
     auto RoomDataStore = ppf_Room_GetDataStore(Room);
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionFromRoom end ppf_Room_GetDataStore")));
-    UpdateSessionSettingsFromDataStore(Session.SessionSettings, RoomDataStore);
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionFromRoom end ppf_Room_GetDataStore"));
+    UpdateSessionSettingsFromDataStore(Session.SessionSettings, RoomDataStore, OutDataStoreHashes);
 }
 
-void FOnlineSessionPico::UpdateSessionSettingsFromDataStore(FOnlineSessionSettings & SessionSettings, ppfDataStoreHandle DataStore) const
+void FOnlineSessionPico::UpdateSessionSettingsFromDataStore(FOnlineSessionSettings & SessionSettings, ppfDataStoreHandle DataStore, TMap<FName, uint32>* OutDataStoreHashes) const
 {
     if (!IsInitSuccess())
     {
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore %s"), *InitStateErrorMessage));
         return;
     }
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore begin")));
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore begin"));
     if (DataStore == nullptr)
     {
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore DataStore is nullptr")));
+        PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore DataStore is nullptr"));
     }
     auto DataStoreSize = ppf_DataStore_GetNumKeys(DataStore);
-    SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore DataStoreSize: %zu"), DataStoreSize));
-    SessionSettings.Settings.Empty(DataStoreSize);
+    PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore DataStoreSize: %zu"), DataStoreSize);
+
+    // Resolved once instead of constructing every FName for every key of every room update
+    static const FName IntegerSettingKeys[] = { SETTING_NUMBOTS, SETTING_BEACONPORT, SETTING_QOS, SETTING_NEEDS, SETTING_NEEDSSORT };
+    static const FName BuildUniqueIdKey = SETTING_PICO_BUILD_UNIQUE_ID;
+
+    // Settings that are still in the data store are updated in place, only the ones that changed are rewritten,
+    // and the ones that were removed from the data store are dropped afterwards.
+    TSet<FName, DefaultKeyFuncs<FName>, TInlineSetAllocator<32>> DataStoreKeys;
+    DataStoreKeys.Reserve(DataStoreSize);
     for (size_t DataStoreIndex = 0; DataStoreIndex < DataStoreSize; DataStoreIndex++)
     {
         auto SrcKey = ppf_DataStore_GetKey(DataStore, DataStoreIndex);
-        auto DataStoreKey = FName(UTF8_TO_TCHAR(SrcKey));
+        const FName DataStoreKey = GetDataStoreKeyName(SrcKey);
         auto DataStoreValue = ppf_DataStore_GetValue(DataStore, SrcKey);
-        FString SetValue = UTF8_TO_TCHAR(DataStoreValue);
-        if (DataStoreKey == SETTING_NUMBOTS
-            || DataStoreKey == SETTING_BEACONPORT
-            || DataStoreKey == SETTING_QOS
-            || DataStoreKey == SETTING_NEEDS
-            || DataStoreKey == SETTING_NEEDSSORT)
+        if (OutDataStoreHashes != nullptr)
+        {
+            OutDataStoreHashes->Add(DataStoreKey, FCrc::MemCrc32(DataStoreValue, FCStringAnsi::Strlen(DataStoreValue)));
+        }
+        if (DataStoreKey == BuildUniqueIdKey)
+        {
+            SessionSettings.BuildUniqueId = FCStringAnsi::Atoi(DataStoreValue);
+            PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore set SessionSettings.BuildUniqueId DataStoreValue: %d"), SessionSettings.BuildUniqueId);
+            continue;
+        }
+        DataStoreKeys.Add(DataStoreKey);
+        const FOnlineSessionSetting* ExistingSetting = SessionSettings.Settings.Find(DataStoreKey);
+        if (ExistingSetting != nullptr && ExistingSetting->AdvertisementType != EOnlineDataAdvertisementType::ViaOnlineService)
         {
-            int32 IntDataStoreValue = FCString::Atoi(UTF8_TO_TCHAR(DataStoreValue));
+            ExistingSetting = nullptr;
+        }
+        if (MakeArrayView(IntegerSettingKeys).Contains(DataStoreKey))
+        {
+            int32 IntDataStoreValue = FCStringAnsi::Atoi(DataStoreValue);
+            if (ExistingSetting != nullptr && ExistingSetting->Data.GetType() == EOnlineKeyValuePairDataType::Int32)
+            {
+                int32 ExistingValue = 0;
+                ExistingSetting->Data.GetValue(ExistingValue);
+                if (ExistingValue == IntDataStoreValue)
+                {
+                    continue;
+                }
+            }
             SessionSettings.Set(
                 DataStoreKey,
                 IntDataStoreValue,
                 EOnlineDataAdvertisementType::ViaOnlineService
             );
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore Key: %s, Value: %d"), *DataStoreKey.ToString(), IntDataStoreValue));
-        }
-        else if (DataStoreKey == SETTING_PICO_BUILD_UNIQUE_ID)
-        {
-            SessionSettings.BuildUniqueId = FCString::Atoi(UTF8_TO_TCHAR(DataStoreValue));
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore set SessionSettings.BuildUniqueId DataStoreValue: %d"), SessionSettings.BuildUniqueId));
+            PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore Key: %s, Value: %d"), *DataStoreKey.ToString(), IntDataStoreValue);
         }
         else
         {
+            FUTF8ToTCHAR SetValueChars(DataStoreValue);
+            const FStringView SetValueView(SetValueChars.Get(), SetValueChars.Length());
+            if (ExistingSetting != nullptr && ExistingSetting->Data.GetType() == EOnlineKeyValuePairDataType::String)
+            {
+                FString ExistingValue;
+                ExistingSetting->Data.GetValue(ExistingValue);
+                if (SetValueView.Equals(ExistingValue, ESearchCase::CaseSensitive))
+                {
+                    continue;
+                }
+            }
+            FString SetValue(SetValueView);
             SessionSettings.Set(
                 DataStoreKey,
                 SetValue,
                 EOnlineDataAdvertisementType::ViaOnlineService
             );
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("UpdateSessionSettingsFromDataStore Key: %s, Value: %s"), *DataStoreKey.ToString(), *SetValue));
+            PICO_SESSION_LOG(Verbose, TEXT("UpdateSessionSettingsFromDataStore Key: %s, Value: %s"), *DataStoreKey.ToString(), *SetValue);
+        }
+    }
+    if (SessionSettings.Settings.Num() != DataStoreKeys.Num())
+    {
+        for (auto It = SessionSettings.Settings.CreateIterator(); It; ++It)
+        {
+            if (!DataStoreKeys.Contains(It.Key()))
+            {
+                It.RemoveCurrent();
+            }
         }
     }
 }
@@ -1666,9 +1898,9 @@ void FOnlineSessionPico::OnGetAccessTokenComplete(ppfMessageHandle Message, bool
     SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnGetAccessTokenComplete")));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("OnGetAccessTokenComplete ErrorMessage: %s"), *ErrorMessage));
         //Initialize();
@@ -1687,9 +1919,9 @@ void FOnlineSessionPico::OnGameInitializeComplete(ppfMessageHandle Message, bool
     SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnGameInitializeComplete")));
     if (bIsError)
     {
-        const auto Error = ppf_Message_GetError(Message);
-        const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        const int ErrorCode = ppf_Error_GetCode(Error);
+        const auto Error = PicoMessageGetError(Message);
+        const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        const int ErrorCode = PicoErrorGetCode(Error);
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("OnGameInitializeComplete ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *FString(ErrorMessage)));
         GameInitializeCompleteCallback.Broadcast(false, ErrorCode, ErrorMessage, -1);
         return;
@@ -1765,7 +1997,7 @@ bool FOnlineSessionPico::OnUpdateRoomData(ppfRoomHandle Room, ppfID RoomId)
                 SaveLog(ELogVerbosity::Type::Log, FString::Printf(TEXT("OnUpdateRoomData SessionRoomId: %llu"), SessionRoomId));
                 if (RoomId == SessionRoomId)
                 {
-                    UpdateSessionFromRoom(*Session, Room);
+                    UpdateSessionFromRoom(*Session, Room, ResetRoomDataStoreHashes(SessionKV.Key, Room));
                     return true;
                 }
             }
@@ -1794,9 +2026,9 @@ void FOnlineSessionPico::OnRoomNotificationUpdate(ppfMessageHandle Message, bool
     }
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        int ErrorCode = ppf_Error_GetCode(Error);
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        int ErrorCode = PicoErrorGetCode(Error);
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + FString::FromInt(ErrorCode);
         SaveLog(ELogVerbosity::Type::Warning, FString::Printf(TEXT("OnRoomNotificationUpdate Error on getting a room notification update")));
         RoomUpdateCallback.Broadcast(FString(), false, ErrorCode, FString(ErrorMessage));
@@ -1823,9 +2055,9 @@ void FOnlineSessionPico::OnRoomInviteAccepted(ppfMessageHandle Message, bool bIs
     auto PlayerId = Identity->GetUniquePlayerId(0);
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Error, FString::Printf(TEXT("OnRoomInviteAccepted ErrorMessage: %s"), *ErrorMessage));
         if (RoomInviteAcceptedCallback.IsBound())
@@ -1919,9 +2151,9 @@ void FOnlineSessionPico::OnMatchmakingNotificationMatchFound(ppfMessageHandle Me
 
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        int ErrorCode = ppf_Error_GetCode(Error);
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        int ErrorCode = PicoErrorGetCode(Error);
         
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnMatchmakingNotificationMatchFound error")));
         InProgressMatchmakingSearch->SearchState = EOnlineAsyncTaskState::Failed;
@@ -1954,9 +2186,9 @@ void FOnlineSessionPico::OnNetNotificationConnection(ppfMessageHandle Message, b
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnNetNotificationConnection error ErrorMessage: %s"), *FString(ErrorMessage)));
         GameConnectionCallback.Broadcast(-1, false);
@@ -2030,9 +2262,9 @@ void FOnlineSessionPico::OnNetNotificationRequestFailed(ppfMessageHandle Message
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnNetNotificationRequestFailed error ErrorMessage: %s"), *FString(ErrorMessage)));
         GameRequestFailedCallback.Broadcast(-1, false);
@@ -2049,9 +2281,9 @@ void FOnlineSessionPico::OnNetNotificationGameStateReset(ppfMessageHandle Messag
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnNetNotificationGameStateReset error ErrorMessage: %s"), *FString(ErrorMessage)));
         GameStateResetCallback.Broadcast(false);
@@ -2072,9 +2304,9 @@ void FOnlineSessionPico::OnMatchmakingNotificationCancel2(ppfMessageHandle Messa
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnMatchmakingNotificationCancel2 error ErrorMessage: %s"), *FString(ErrorMessage)));
         MatchmakingCancel2Callback.Broadcast(false);
@@ -2094,9 +2326,9 @@ void FOnlineSessionPico::OnRoomNotificationLeave(ppfMessageHandle Message, bool
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationLeave error ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomLeaveCallback.Broadcast(FString(ErrorMessage), false);
@@ -2113,9 +2345,9 @@ void FOnlineSessionPico::OnRoomNotificationJoin2(ppfMessageHandle Message, bool
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationJoin2 error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomJoin2Callback.Broadcast(FString(ErrorMessage), false);
@@ -2139,9 +2371,9 @@ void FOnlineSessionPico::OnRoomNotificationSetDescription(ppfMessageHandle Messa
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationSetDescription error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomSetDescriptionCallback.Broadcast(FString(ErrorMessage), false);
@@ -2165,9 +2397,9 @@ void FOnlineSessionPico::OnRoomNotificationKickUser(ppfMessageHandle Message, bo
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationKickUser error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomKickUserCallback.Broadcast(FString(ErrorMessage), false);
@@ -2185,9 +2417,9 @@ void FOnlineSessionPico::OnRoomNotificationUpdateOwner(ppfMessageHandle Message,
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationUpdateOwner error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomUpdateOwnerCallback.Broadcast(false);
@@ -2203,9 +2435,9 @@ void FOnlineSessionPico::OnRoomNotificationUpdateDataStore(ppfMessageHandle Mess
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationUpdateDataStore error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomUpdateDataStoreCallback.Broadcast(FString(ErrorMessage), false);
@@ -2229,9 +2461,9 @@ void FOnlineSessionPico::OnRoomNotificationUpdateMembershipLockStatus(ppfMessage
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("OnRoomNotificationUpdateMembershipLockStatus error. ErrorMessage: %s"), *FString(ErrorMessage)));
         RoomUpdateMembershipLockStatusCallback.Broadcast(FString(ErrorMessage), false);
@@ -2257,21 +2489,21 @@ void FOnlineSessionPico::TestDumpNamedSession(const FNamedOnlineSession * NamedS
     if (NamedSession != NULL)
     {
         //LOG_SCOPE_VERBOSITY_OVERRIDE(LogOnlineSession, ELogVerbosity::VeryVerbose);
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("dumping NamedSession: ")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	SessionName: %s"), *NamedSession->SessionName.ToString()));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	HostingPlayerNum: %d"), NamedSession->HostingPlayerNum));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	SessionState: %s"), EOnlineSessionState::ToString(NamedSession->SessionState)));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	RegisteredPlayers: ")));
+        PICO_SESSION_LOG(Verbose, TEXT("dumping NamedSession: "));
+        PICO_SESSION_LOG(Verbose, TEXT("	SessionName: %s"), *NamedSession->SessionName.ToString());
+        PICO_SESSION_LOG(Verbose, TEXT("	HostingPlayerNum: %d"), NamedSession->HostingPlayerNum);
+        PICO_SESSION_LOG(Verbose, TEXT("	SessionState: %s"), EOnlineSessionState::ToString(NamedSession->SessionState));
+        PICO_SESSION_LOG(Verbose, TEXT("	RegisteredPlayers: "));
         if (NamedSession->RegisteredPlayers.Num())
         {
             for (int32 UserIdx = 0; UserIdx < NamedSession->RegisteredPlayers.Num(); UserIdx++)
             {
-                SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	    %d: %s"), UserIdx, *NamedSession->RegisteredPlayers[UserIdx]->ToString()));
+                PICO_SESSION_LOG(Verbose, TEXT("	    %d: %s"), UserIdx, *NamedSession->RegisteredPlayers[UserIdx]->ToString());
             }
         }
         else
         {
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	    0 registered players")));
+            PICO_SESSION_LOG(Verbose, TEXT("	    0 registered players"));
         }
 
         TestDumpSession(NamedSession);
@@ -2281,42 +2513,42 @@ void FOnlineSessionPico::TestDumpSession(const FOnlineSession * Session) const
 {
     if (Session != NULL)
     {
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("dumping Session: ")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	OwningPlayerName: %s"), *Session->OwningUserName));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	OwningPlayerId: %s"), Session->OwningUserId.IsValid() ? *Session->OwningUserId->ToString() : TEXT("")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	NumOpenPrivateConnections: %d"), Session->NumOpenPrivateConnections));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	NumOpenPublicConnections: %d"), Session->NumOpenPublicConnections));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("	SessionInfo: %s"), Session->SessionInfo.IsValid() ? *Session->SessionInfo->ToDebugString() : TEXT("NULL")));
+        PICO_SESSION_LOG(Verbose, TEXT("dumping Session: "));
+        PICO_SESSION_LOG(Verbose, TEXT("	OwningPlayerName: %s"), *Session->OwningUserName);
+        PICO_SESSION_LOG(Verbose, TEXT("	OwningPlayerId: %s"), Session->OwningUserId.IsValid() ? *Session->OwningUserId->ToString() : TEXT(""));
+        PICO_SESSION_LOG(Verbose, TEXT("	NumOpenPrivateConnections: %d"), Session->NumOpenPrivateConnections);
+        PICO_SESSION_LOG(Verbose, TEXT("	NumOpenPublicConnections: %d"), Session->NumOpenPublicConnections);
+        PICO_SESSION_LOG(Verbose, TEXT("	SessionInfo: %s"), Session->SessionInfo.IsValid() ? *Session->SessionInfo->ToDebugString() : TEXT("NULL"));
         TestDumpSessionSettings(&Session->SessionSettings);
     }
     else
     {
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("dumping Session is null")));
+        PICO_SESSION_LOG(Verbose, TEXT("dumping Session is null"));
     }
 }
 void FOnlineSessionPico::TestDumpSessionSettings(const FOnlineSessionSettings * SessionSettings) const
 {
     if (SessionSettings != NULL)
     {
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("dumping SessionSettings: ")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tNumPublicConnections: %d"), SessionSettings->NumPublicConnections));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tNumPrivateConnections: %d"), SessionSettings->NumPrivateConnections));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbIsLanMatch: %s"), SessionSettings->bIsLANMatch ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbIsDedicated: %s"), SessionSettings->bIsDedicated ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbUsesStats: %s"), SessionSettings->bUsesStats ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbShouldAdvertise: %s"), SessionSettings->bShouldAdvertise ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbAllowJoinInProgress: %s"), SessionSettings->bAllowJoinInProgress ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbAllowInvites: %s"), SessionSettings->bAllowInvites ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbUsesPresence: %s"), SessionSettings->bUsesPresence ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbAllowJoinViaPresence: %s"), SessionSettings->bAllowJoinViaPresence ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tbAllowJoinViaPresenceFriendsOnly: %s"), SessionSettings->bAllowJoinViaPresenceFriendsOnly ? TEXT("true") : TEXT("false")));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tBuildUniqueId: 0x%08x"), SessionSettings->BuildUniqueId));
-        SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\tSettings:")));
+        PICO_SESSION_LOG(Verbose, TEXT("dumping SessionSettings: "));
+        PICO_SESSION_LOG(Verbose, TEXT("\tNumPublicConnections: %d"), SessionSettings->NumPublicConnections);
+        PICO_SESSION_LOG(Verbose, TEXT("\tNumPrivateConnections: %d"), SessionSettings->NumPrivateConnections);
+        PICO_SESSION_LOG(Verbose, TEXT("\tbIsLanMatch: %s"), SessionSettings->bIsLANMatch ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbIsDedicated: %s"), SessionSettings->bIsDedicated ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbUsesStats: %s"), SessionSettings->bUsesStats ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbShouldAdvertise: %s"), SessionSettings->bShouldAdvertise ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbAllowJoinInProgress: %s"), SessionSettings->bAllowJoinInProgress ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbAllowInvites: %s"), SessionSettings->bAllowInvites ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbUsesPresence: %s"), SessionSettings->bUsesPresence ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbAllowJoinViaPresence: %s"), SessionSettings->bAllowJoinViaPresence ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tbAllowJoinViaPresenceFriendsOnly: %s"), SessionSettings->bAllowJoinViaPresenceFriendsOnly ? TEXT("true") : TEXT("false"));
+        PICO_SESSION_LOG(Verbose, TEXT("\tBuildUniqueId: 0x%08x"), SessionSettings->BuildUniqueId);
+        PICO_SESSION_LOG(Verbose, TEXT("\tSettings:"));
         for (FSessionSettings::TConstIterator It(SessionSettings->Settings); It; ++It)
         {
             FName Key = It.Key();
             const FOnlineSessionSetting& Setting = It.Value();
-            SaveLog(ELogVerbosity::Type::Display, FString::Printf(TEXT("\t\t%s=%s"), *Key.ToString(), *Setting.ToString()));
+            PICO_SESSION_LOG(Verbose, TEXT("\t\t%s=%s"), *Key.ToString(), *Setting.ToString());
         }
     }
 }
@@ -2330,19 +2562,18 @@ void FOnlineSessionPico::SaveLog(const ELogVerbosity::Type Verbosity, const FStr
     case ELogVerbosity::Type::Warning:
         UE_LOG_ONLINE_SESSION(Warning, TEXT("PPF_GAME %s"), *Log);
         break;
+    case ELogVerbosity::Type::Verbose:
+        UE_LOG_ONLINE_SESSION(Verbose, TEXT("PPF_GAME %s"), *Log);
+        break;
+    case ELogVerbosity::Type::VeryVerbose:
+        UE_LOG_ONLINE_SESSION(VeryVerbose, TEXT("PPF_GAME %s"), *Log);
+        break;
     default:
         UE_LOG_ONLINE_SESSION(Log, TEXT("PPF_GAME %s"), *Log);
         break;
     }
 
-    FDateTime Time = FDateTime::Now();
-    int year = Time.GetYear();
-    int month = Time.GetMonth();
-    int day = Time.GetDay();
-    int hour = Time.GetHour();
-    int minute = Time.GetMinute();
-    int second = Time.GetSecond();
-    
+    // FDateTime Time = FDateTime::Now();
     // FString WriteLog = FString::Printf(TEXT("[%d.%d.%d %d:%d:%d]%s\n"), year, month, day, hour, minute, second, *Log);
     // FString TextPath = FPaths::ProjectPersistentDownloadDir() + TEXT("Log-OnlineSessionInterfacePico.txt");
     // FFileHelper::SaveStringToFile(*WriteLog, *TextPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
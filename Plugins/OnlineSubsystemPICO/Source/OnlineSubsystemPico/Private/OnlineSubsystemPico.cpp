@@ -324,6 +324,11 @@ bool FOnlineSubsystemPico::Shutdown()
 {
     UE_LOG_ONLINE(Display, TEXT("FOnlineSubsystemPico::Shutdown()"));
 
+    // Coalesced packets still waiting for their window would be lost with the interface
+    if (PicoNetworkingInterface.IsValid())
+    {
+        PicoNetworkingInterface->FlushCoalescedPackets(true);
+    }
     FOnlineSubsystemImpl::Shutdown();
     RtcPicoUserInterface.Reset();
     PicoPresenceInterface.Reset();
@@ -393,6 +398,10 @@ bool FOnlineSubsystemPico::Tick(float DeltaTime)
     {
         GameSessionInterface->TickPendingInvites(DeltaTime);
     }
+    if (PicoNetworkingInterface.IsValid())
+    {
+        PicoNetworkingInterface->FlushCoalescedPackets();
+    }
 
     if (OnlineAsyncTaskThreadRunnable)
     {
@@ -403,7 +412,7 @@ bool FOnlineSubsystemPico::Tick(float DeltaTime)
 
 
 
-void FOnlineSubsystemPico::AddAsyncTask(ppfRequest RequestId, FPicoMessageOnCompleteDelegate Delegate)
+void FOnlineSubsystemPico::AddAsyncTask(ppfRequest RequestId, FPicoMessageOnCompleteDelegate Delegate, bool bCanTimeOut)
 {
     check(OnlineAsyncTaskThreadRunnable);
     if (RequestId == 0)
@@ -411,7 +420,7 @@ void FOnlineSubsystemPico::AddAsyncTask(ppfRequest RequestId, FPicoMessageOnComp
         UE_LOG_ONLINE(Error, TEXT("Wrong request id!"));
         return;
     }
-    FOnlineAsyncTaskPico* NewTask = new FOnlineAsyncTaskPico(this, RequestId, Delegate);
+    FOnlineAsyncTaskPico* NewTask = new FOnlineAsyncTaskPico(this, RequestId, Delegate, bCanTimeOut);
     OnlineAsyncTaskThreadRunnable->CollectedRequestTask(RequestId, NewTask);
 }
 
@@ -428,6 +437,24 @@ void FOnlineSubsystemPico::RemoveNotifyDelegate(ppfMessageType MessageType, cons
     return OnlineAsyncTaskThreadRunnable->RemoveNotifyDelegate(MessageType, Delegate);
 }
 
+void FOnlineSubsystemPico::SetNotificationPolicy(ppfMessageType MessageType, EPicoNotificationDelivery Delivery, FPicoNotificationKeyDelegate GetKey) const
+{
+    check(OnlineAsyncTaskThreadRunnable);
+    OnlineAsyncTaskThreadRunnable->SetNotificationPolicy(MessageType, Delivery, MoveTemp(GetKey));
+}
+
+FPicoNotificationStats FOnlineSubsystemPico::GetNotificationStats(ppfMessageType MessageType) const
+{
+    check(OnlineAsyncTaskThreadRunnable);
+    return OnlineAsyncTaskThreadRunnable->GetNotificationStats(MessageType);
+}
+
+FPicoMulticastRequestOnTimeOutDelegate& FOnlineSubsystemPico::OnRequestTimeOut() const
+{
+    check(OnlineAsyncTaskThreadRunnable);
+    return OnlineAsyncTaskThreadRunnable->OnRequestTimeOut;
+}
+
 bool FOnlineSubsystemPico::IsInitialized() const
 {
     return bPicoInit;
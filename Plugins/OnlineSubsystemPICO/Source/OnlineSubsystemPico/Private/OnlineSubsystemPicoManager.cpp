@@ -84,7 +84,7 @@ UOnlineSubsystemPicoManager::UOnlineSubsystemPicoManager()
             RtcInterface->RtcAudioPlaybackDeviceChangeCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcAudioChangePlaybackDevice);
             RtcInterface->RtcMediaDeviceChangeInfoCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcMediaDeviceChangeInfo);
             RtcInterface->RtcLocalAudioPropertiesReportCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcLocalAudioPropertiesReport);
-            RtcInterface->RtcRemoteAudioPropertiesReportCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport);
+            RtcInterface->RtcRemoteAudioPropertiesSnapshotCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport);
             RtcInterface->RtcWarnCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcWarn);
             RtcInterface->RtcErrorCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcError);
             RtcInterface->RtcConnectStateChangedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcConnectStateChanged);
@@ -94,10 +94,9 @@ UOnlineSubsystemPicoManager::UOnlineSubsystemPicoManager()
             // V2
             RtcInterface->RtcUserPublishInfoCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcUserPublishInfo);
             RtcInterface->RtcUserUnPublishInfoCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcUserUnPublishInfo);
-            RtcInterface->RtcStreamSyncInfoCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnGetRtcStreamSyncInfo);
+            RtcInterface->RtcStreamSyncInfoViewCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnGetRtcStreamSyncInfo);
             RtcInterface->RtcMessageSendResultCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcMessageSendResult);
-            RtcInterface->RtcBinaryMessageReceivedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcBinaryMessageReceived);
-            RtcInterface->RtcBinaryArrayMessageReceivedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcBinaryArrayMessageReceived);
+            RtcInterface->RtcBinaryMessageViewReceivedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcBinaryMessageReceived);
             RtcInterface->RtcRoomMessageReceivedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcRoomMessageReceived);
             RtcInterface->RtcUserMessageReceivedCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcUserMessageReceived);
             RtcInterface->RtcTokenWillExpireCallback.AddUObject(this, &UOnlineSubsystemPicoManager::OnRtcTokenWilExpire);
@@ -636,9 +635,23 @@ void UOnlineSubsystemPicoManager::OnRtcLocalAudioPropertiesReport(TArray<ERtcStr
     OnRtcLocalAudioPropertiesReportDelegate.Broadcast(StreamIndexs, Volumes);
 }
 
-void UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, TArray<int> Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, TArray<ERtcStreamIndex> StreamIndexs)
+void UOnlineSubsystemPicoManager::OnRtcRemoteAudioPropertiesReport(const FRtcRemoteAudioPropertiesSnapshot& Snapshot)
 {
-    OnRtcRemoteAudioPropertiesReportDelegate.Broadcast(TotalRemoteVolume, Volumes, RoomIds, UserIds, StreamIndexs);
+    if (!OnRtcRemoteAudioPropertiesReportDelegate.IsBound() || !RtcInterface)
+    {
+        return;
+    }
+    const int32 StreamNum = Snapshot.Volumes.Num();
+    TArray<FString> RoomIds;
+    TArray<FString> UserIds;
+    RoomIds.Reserve(StreamNum);
+    UserIds.Reserve(StreamNum);
+    for (int32 i = 0; i < StreamNum; i++)
+    {
+        RoomIds.Add(RtcInterface->GetRtcIdByHandle(Snapshot.RoomIds[i]));
+        UserIds.Add(RtcInterface->GetRtcIdByHandle(Snapshot.UserIds[i]));
+    }
+    OnRtcRemoteAudioPropertiesReportDelegate.Broadcast(Snapshot.TotalRemoteVolume, Snapshot.Volumes, RoomIds, UserIds, Snapshot.StreamIndexes);
 }
 
 void UOnlineSubsystemPicoManager::OnRtcWarn(int MessageCode)
@@ -678,9 +691,12 @@ void UOnlineSubsystemPicoManager::OnRtcUserUnPublishInfo(const FString& RoomId,
     OnRtcUserUnPublishInfoDelegate.Broadcast(RoomId, UserId, MediaStreamType, Reason);
 }
 
-void UOnlineSubsystemPicoManager::OnGetRtcStreamSyncInfo(const FString& RoomId, const FString& UserId, ERtcStreamIndex StreamIndex, ERtcSyncInfoStreamType RtcSyncInfoStreamType, const FString& Info)
+void UOnlineSubsystemPicoManager::OnGetRtcStreamSyncInfo(const FString& RoomId, const FString& UserId, ERtcStreamIndex StreamIndex, ERtcSyncInfoStreamType RtcSyncInfoStreamType, TArrayView<const uint8> Payload)
 {
-    OnGetRtcStreamSyncInfoDelegate.Broadcast(RoomId, UserId, StreamIndex, RtcSyncInfoStreamType, Info);
+    if (OnGetRtcStreamSyncInfoDelegate.IsBound())
+    {
+        OnGetRtcStreamSyncInfoDelegate.Broadcast(RoomId, UserId, StreamIndex, RtcSyncInfoStreamType, BytesToString(Payload.GetData(), Payload.Num()));
+    }
 }
 
 void UOnlineSubsystemPicoManager::OnRtcMessageSendResult(int64 MessageId, int32 Error, const FString& RoomId)
@@ -688,14 +704,17 @@ void UOnlineSubsystemPicoManager::OnRtcMessageSendResult(int64 MessageId, int32
     OnRtcMessageSendResultDelegate.Broadcast(MessageId, Error, RoomId);
 }
 
-void UOnlineSubsystemPicoManager::OnRtcBinaryMessageReceived(const FString& RoomId, const FString& UserId, const FString& Info)
+void UOnlineSubsystemPicoManager::OnRtcBinaryMessageReceived(const FString& RoomId, const FString& UserId, TArrayView<const uint8> Payload)
 {
-    OnRtcBinaryMessageReceivedDelegate.Broadcast(RoomId, UserId, Info);
-}
-
-void UOnlineSubsystemPicoManager::OnRtcBinaryArrayMessageReceived(const FString& RoomId, const FString& UserId, TArray<uint8> BinaryArray)
-{
-    OnRtcBinaryArrayMessageReceivedDelegate.Broadcast(RoomId, UserId, BinaryArray);
+    // Blueprint listeners need owning copies, so only make the ones somebody listens to
+    if (OnRtcBinaryMessageReceivedDelegate.IsBound())
+    {
+        OnRtcBinaryMessageReceivedDelegate.Broadcast(RoomId, UserId, BytesToString(Payload.GetData(), Payload.Num()));
+    }
+    if (OnRtcBinaryArrayMessageReceivedDelegate.IsBound())
+    {
+        OnRtcBinaryArrayMessageReceivedDelegate.Broadcast(RoomId, UserId, TArray<uint8>(Payload.GetData(), Payload.Num()));
+    }
 }
 
 void UOnlineSubsystemPicoManager::OnRtcRoomMessageReceived(const FString& RoomId, const FString& UserId, const FString& Message)
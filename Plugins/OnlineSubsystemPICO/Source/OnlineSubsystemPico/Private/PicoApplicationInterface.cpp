@@ -42,9 +42,9 @@ void FPicoApplicationInterface::OnQueryLaunchOtherAppComplete(ppfMessageHandle M
     FString ErrorStr;
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(FString(), false, ErrorMessage);
         return;
@@ -81,9 +81,9 @@ void FPicoApplicationInterface::OnQueryGetVersionComplete(ppfMessageHandle Messa
 #if PLATFORM_ANDROID
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(0, FString(), 0, FString(), false, ErrorMessage);
         return;
@@ -129,9 +129,9 @@ void FPicoApplicationInterface::OnQueryLaunchOtherAppByPresenceComplete(ppfMessa
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(FString(), false, ErrorMessage);
         return;
@@ -169,9 +169,9 @@ void FPicoApplicationInterface::OnQueryLaunchOtherAppByAppIdComplete(ppfMessageH
 {
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(FString(), false, ErrorMessage);
         return;
@@ -207,9 +207,9 @@ void FPicoApplicationInterface::OnQueryLaunchStoreComplete(ppfMessageHandle Mess
     FString ErrorStr;
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(FString(), false, ErrorMessage);
         return;
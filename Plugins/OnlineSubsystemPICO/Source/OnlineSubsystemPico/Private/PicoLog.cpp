@@ -0,0 +1,127 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+
+#include "PicoLog.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ConfigCacheIni.h"
+
+namespace
+{
+    constexpr int32 DefaultLogRingCapacity = 4096;
+
+    FAutoConsoleCommandWithOutputDevice DumpLogRingCommand(
+        TEXT("Pico.DumpLogRing"),
+        TEXT("Writes the latest log events of the Pico online subsystem, oldest first"),
+        FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+            {
+                FPicoLogRing::Get().Dump(Ar);
+            }));
+
+    void AppendArg(FString& Out, const FPicoLogEventArg& Arg)
+    {
+        switch (Arg.Kind)
+        {
+        case FPicoLogEventArg::EKind::Float:
+            Out.Appendf(TEXT("%f"), Arg.Float);
+            break;
+        case FPicoLogEventArg::EKind::Unsigned:
+            Out.Appendf(TEXT("%llu"), Arg.Unsigned);
+            break;
+        default:
+            Out.Appendf(TEXT("%lld"), Arg.Signed);
+            break;
+        }
+    }
+}
+
+FPicoLogRing& FPicoLogRing::Get()
+{
+    static FPicoLogRing Ring([]()
+        {
+            int32 Capacity = DefaultLogRingCapacity;
+            if (GConfig)
+            {
+                GConfig->GetInt(TEXT("OnlineSubsystemPico"), TEXT("LogRingCapacity"), Capacity, GEngineIni);
+            }
+            return Capacity;
+        }());
+    return Ring;
+}
+
+FPicoLogRing::FPicoLogRing(int32 InCapacity) :
+    Capacity(FMath::Max(InCapacity, 1))
+{
+    Slots = MakeUnique<FSlot[]>(Capacity);
+}
+
+FPicoLogEvent FPicoLogRing::RecordValues(const FPicoLogEventSite& Site, const FPicoLogEventArg* Values, int32 NumValues)
+{
+    FPicoLogEvent Event;
+    Event.Time = FPlatformTime::Seconds();
+    Event.Site = &Site;
+    Event.NumArgs = NumValues;
+    for (int32 Index = 0; Index < NumValues; ++Index)
+    {
+        Event.Args[Index] = Values[Index];
+    }
+
+    // A slot is only written twice at once if a writer is lapped by Capacity others, the event may then be torn
+    const uint64 Index = NumRecorded.fetch_add(1, std::memory_order_relaxed);
+    FSlot& Slot = Slots[static_cast<int32>(Index % Capacity)];
+    Slot.Sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    Slot.Event = Event;
+    Slot.Sequence.store(Index + 1, std::memory_order_release);
+    return Event;
+}
+
+void FPicoLogRing::Dump(FOutputDevice& Ar) const
+{
+    const uint64 NumTotal = NumRecorded.load(std::memory_order_acquire);
+    const uint64 NumKept = FMath::Min(NumTotal, static_cast<uint64>(Capacity));
+    const uint64 NumDropped = NumTotal - NumKept;
+    TArray<FPicoLogEvent> Snapshot;
+    Snapshot.Reserve(static_cast<int32>(NumKept));
+    for (uint64 Index = NumTotal - NumKept; Index < NumTotal; ++Index)
+    {
+        // Events that are being written or were overwritten since NumTotal was read are left out
+        const FSlot& Slot = Slots[static_cast<int32>(Index % Capacity)];
+        if (Slot.Sequence.load(std::memory_order_acquire) != Index + 1)
+        {
+            continue;
+        }
+        const FPicoLogEvent Event = Slot.Event;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (Slot.Sequence.load(std::memory_order_relaxed) == Index + 1)
+        {
+            Snapshot.Add(Event);
+        }
+    }
+
+    // The lines are formatted after the snapshot is taken, recording never waits for a dump
+    Ar.Logf(TEXT("Pico log ring: %d events, %llu older events overwritten"), Snapshot.Num(), NumDropped);
+    for (const FPicoLogEvent& Event : Snapshot)
+    {
+        Ar.Logf(TEXT("[%.3f] %s %s: %s"), Event.Time, Event.Site->Category, ToString(Event.Site->Verbosity), *FormatEvent(Event));
+    }
+}
+
+FString FPicoLogRing::FormatEvent(const FPicoLogEvent& Event)
+{
+    FString Out = Event.Site->Message;
+    const TCHAR* Name = Event.Site->ArgNames;
+    for (int32 Index = 0; Index < Event.NumArgs; ++Index)
+    {
+        // ArgNames is the argument list as written, split it at the commas outside of parentheses
+        const TCHAR* NameEnd = Name;
+        for (int32 Depth = 0; *NameEnd && (Depth > 0 || *NameEnd != TEXT(',')); ++NameEnd)
+        {
+            Depth += (*NameEnd == TEXT('(') || *NameEnd == TEXT('[')) ? 1 : (*NameEnd == TEXT(')') || *NameEnd == TEXT(']')) ? -1 : 0;
+        }
+        Out += Index == 0 ? TEXT(" ") : TEXT(", ");
+        Out += FString(UE_PTRDIFF_TO_INT32(NameEnd - Name), Name).TrimStartAndEnd();
+        Out += TEXT("=");
+        AppendArg(Out, Event.Args[Index]);
+        Name = *NameEnd ? NameEnd + 1 : NameEnd;
+    }
+    return Out;
+}
@@ -0,0 +1,209 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include <atomic>
+#include <type_traits>
+
+/**
+ * Logging helpers for the hot paths of the online subsystem.
+ *
+ * PICO_LOG                 UE_LOG that is compiled out above PICO_LOG_COMPILED_VERBOSITY or the category's compile time verbosity.
+ * PICO_LOG_RATE_LIMITED    Logs at most once per interval per call site and reports how many lines it dropped.
+ * PICO_LOG_EVENT           Logs a message and up to four numbers and records them into a ring buffer.
+ *                          Nothing is recorded or formatted unless the category is enabled at the event's verbosity,
+ *                          the ring buffer is written with the Pico.DumpLogRing console command.
+ *
+ * A category declared with a lower compile time verbosity, e.g. DECLARE_LOG_CATEGORY_EXTERN(PicoNetworking, Log, Warning),
+ * strips its more verbose statements from the build on its own.
+ */
+
+/** Pico log statements more verbose than this are compiled out in every category */
+#ifndef PICO_LOG_COMPILED_VERBOSITY
+#if UE_BUILD_SHIPPING
+#define PICO_LOG_COMPILED_VERBOSITY Warning
+#else
+#define PICO_LOG_COMPILED_VERBOSITY All
+#endif
+#endif
+
+#define PICO_LOG_IS_COMPILED(Category, Verbosity) \
+	((ELogVerbosity::Verbosity & ELogVerbosity::VerbosityMask) <= ELogVerbosity::PICO_LOG_COMPILED_VERBOSITY && \
+	(ELogVerbosity::Verbosity & ELogVerbosity::VerbosityMask) <= std::decay_t<decltype(Category)>::CompileTimeVerbosity)
+
+#define PICO_LOG(Category, Verbosity, Format, ...) \
+	do \
+	{ \
+		if constexpr (PICO_LOG_IS_COMPILED(Category, Verbosity)) \
+		{ \
+			UE_LOG(Category, Verbosity, Format, ##__VA_ARGS__); \
+		} \
+	} while (0)
+
+#define PICO_LOG_RATE_LIMITED(Category, Verbosity, IntervalSeconds, Format, ...) \
+	do \
+	{ \
+		if constexpr (PICO_LOG_IS_COMPILED(Category, Verbosity)) \
+		{ \
+			if (UE_LOG_ACTIVE(Category, Verbosity)) \
+			{ \
+				static FPicoLogRateLimiter PicoLogRateLimiter; \
+				int32 PicoLogNumSuppressed = 0; \
+				if (PicoLogRateLimiter.TryLog(IntervalSeconds, PicoLogNumSuppressed)) \
+				{ \
+					if (PicoLogNumSuppressed > 0) \
+					{ \
+						UE_LOG(Category, Verbosity, TEXT("%s (%d similar lines suppressed)"), *FString::Printf(Format, ##__VA_ARGS__), PicoLogNumSuppressed); \
+					} \
+					else \
+					{ \
+						UE_LOG(Category, Verbosity, Format, ##__VA_ARGS__); \
+					} \
+				} \
+			} \
+		} \
+	} while (0)
+
+#define PICO_LOG_EVENT(Category, Verbosity, Message, ...) \
+	do \
+	{ \
+		if constexpr (PICO_LOG_IS_COMPILED(Category, Verbosity)) \
+		{ \
+			if (UE_LOG_ACTIVE(Category, Verbosity)) \
+			{ \
+				static const FPicoLogEventSite PicoLogEventSite = { TEXT(#Category), ELogVerbosity::Verbosity, Message, TEXT(#__VA_ARGS__) }; \
+				const FPicoLogEvent PicoLogEvent = FPicoLogRing::Get().Record(PicoLogEventSite, ##__VA_ARGS__); \
+				UE_LOG(Category, Verbosity, TEXT("%s"), *FPicoLogRing::FormatEvent(PicoLogEvent)); \
+			} \
+		} \
+	} while (0)
+
+/** Lets a log statement through at most once per interval and counts what it dropped in between. Not synchronized, meant for game thread call sites */
+struct FPicoLogRateLimiter
+{
+	/** Returns true if the statement may log, OutNumSuppressed is the number of lines dropped since it last did */
+	bool TryLog(double IntervalSeconds, int32& OutNumSuppressed)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if (Now < NextAllowedTime)
+		{
+			++NumSuppressed;
+			return false;
+		}
+		NextAllowedTime = Now + IntervalSeconds;
+		OutNumSuppressed = NumSuppressed;
+		NumSuppressed = 0;
+		return true;
+	}
+
+private:
+	double NextAllowedTime = 0.0;
+	int32 NumSuppressed = 0;
+};
+
+/** A PICO_LOG_EVENT statement, ArgNames is its argument list as written */
+struct FPicoLogEventSite
+{
+	const TCHAR* Category;
+	ELogVerbosity::Type Verbosity;
+	const TCHAR* Message;
+	const TCHAR* ArgNames;
+};
+
+/** An event argument, kept as a number so that recording it formats nothing */
+struct FPicoLogEventArg
+{
+	enum class EKind : uint8
+	{
+		Signed,
+		Unsigned,
+		Float
+	};
+
+	union
+	{
+		int64 Signed;
+		uint64 Unsigned;
+		double Float;
+	};
+	EKind Kind;
+
+	FPicoLogEventArg() : Signed(0), Kind(EKind::Signed) {}
+
+	template <typename T>
+	FPicoLogEventArg(T Value)
+	{
+		static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>, "Log event arguments must be numbers");
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			Float = Value;
+			Kind = EKind::Float;
+		}
+		else if constexpr (std::is_enum_v<T> || std::is_signed_v<T>)
+		{
+			Signed = static_cast<int64>(Value);
+			Kind = EKind::Signed;
+		}
+		else
+		{
+			Unsigned = static_cast<uint64>(Value);
+			Kind = EKind::Unsigned;
+		}
+	}
+};
+
+struct FPicoLogEvent
+{
+	static constexpr int32 MaxArgs = 4;
+
+	double Time = 0.0;
+	const FPicoLogEventSite* Site = nullptr;
+	int32 NumArgs = 0;
+	FPicoLogEventArg Args[MaxArgs];
+};
+
+/**
+ * Fixed size ring of the latest log events, the oldest event is overwritten when it is full.
+ * Recording claims a slot with an atomic counter and takes no lock, Dump skips the slots that are being written.
+ */
+class FPicoLogRing
+{
+public:
+	/** The ring holds [OnlineSubsystemPico] LogRingCapacity events, 4096 by default */
+	static FPicoLogRing& Get();
+
+	/** Returns a copy of the recorded event, the ring may overwrite it at any time */
+	template <typename... ArgTypes>
+	FPicoLogEvent Record(const FPicoLogEventSite& Site, ArgTypes... Args)
+	{
+		static_assert(sizeof...(Args) <= FPicoLogEvent::MaxArgs, "Log events take at most four arguments");
+		// One extra element so that the array is not empty for events without arguments
+		const FPicoLogEventArg Values[sizeof...(Args) + 1] = { FPicoLogEventArg(Args)... };
+		return RecordValues(Site, Values, sizeof...(Args));
+	}
+
+	/** Writes the recorded events to Ar, oldest first */
+	void Dump(FOutputDevice& Ar) const;
+
+	/** Formats an event as "Message Name=Value, ..." */
+	static FString FormatEvent(const FPicoLogEvent& Event);
+
+private:
+	explicit FPicoLogRing(int32 Capacity);
+
+	FPicoLogEvent RecordValues(const FPicoLogEventSite& Site, const FPicoLogEventArg* Values, int32 NumValues);
+
+	struct FSlot
+	{
+		/** Index of the event in the slot plus one, 0 while it is written */
+		std::atomic<uint64> Sequence{0};
+		FPicoLogEvent Event;
+	};
+
+	TUniquePtr<FSlot[]> Slots;
+	int32 Capacity;
+	/** Total number of events recorded, the next one goes to NumRecorded % Capacity */
+	std::atomic<uint64> NumRecorded{0};
+};
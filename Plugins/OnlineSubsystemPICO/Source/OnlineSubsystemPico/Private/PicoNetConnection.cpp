@@ -1,8 +1,10 @@
 // Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved. 
 
 #include "PicoNetConnection.h"
+#include "PicoNetDriver.h"
 #include "OnlineSubsystemPicoPrivate.h"
 #include "IPAddressPico.h"
+#include "PicoLog.h"
 #include "Net/DataChannel.h"
 #include "PacketHandler.h"
 
@@ -16,11 +18,17 @@ void UPicoNetConnection::InitBase(UNetDriver* InDriver, class FSocket* InSocket,
 
     DisableAddressResolution();
 
+    // Use the default packet size/overhead unless overridden by a child class
+    int32 MaxPacketSize = InMaxPacket == 0 ? MAX_PACKET_SIZE : InMaxPacket;
+    // The packet transport adds its framing to every packet, which must still fit into one frame
+    const UPicoNetDriver* PicoDriver = Cast<UPicoNetDriver>(InDriver);
+    if (PicoDriver && PicoDriver->HasPacketTransport())
+    {
+        MaxPacketSize = FMath::Min(MaxPacketSize, PicoDriver->GetMaxTransportPacketSize());
+    }
+
     // Pass the call up the chain
-    UNetConnection::InitBase(InDriver, InSocket, InURL, InState,
-        // Use the default packet size/overhead unless overridden by a child class
-        InMaxPacket == 0 ? MAX_PACKET_SIZE : InMaxPacket,
-        /* PacketOverhead */ 1);
+    UNetConnection::InitBase(InDriver, InSocket, InURL, InState, MaxPacketSize, /* PacketOverhead */ 1);
 
     // We handle our own overhead
     PacketOverhead = 0;
@@ -51,7 +59,7 @@ void UPicoNetConnection::InitLocalConnection(UNetDriver* InDriver, class FSocket
     auto PicoAddr = FInternetAddrPico(InURL);
 #endif
     PeerID = PicoAddr.GetID();
-    UserID = PicoAddr.GetStrID();
+    SetUserID(PicoAddr.GetStrID());
 }
 
 void UPicoNetConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocket* InSocket, const FURL& InURL, const class FInternetAddr& InRemoteAddr, EConnectionState InState, int32 InMaxPacket, int32 InPacketOverhead)
@@ -71,13 +79,22 @@ void UPicoNetConnection::InitRemoteConnection(UNetDriver* InDriver, class FSocke
 
     RemoteAddr = InRemoteAddr.Clone();
     PeerID = StaticCastSharedPtr<FInternetAddrPico>(RemoteAddr)->GetID();
-    UserID = StaticCastSharedPtr<FInternetAddrPico>(RemoteAddr)->GetStrID();
+    SetUserID(StaticCastSharedPtr<FInternetAddrPico>(RemoteAddr)->GetStrID());
 
     // This is for a client that needs to log in, setup ClientLoginState and ExpectedClientLoginMsgType to reflect that
     SetClientLoginState(EClientLoginState::LoggingIn);
     SetExpectedClientLoginMsgType(NMT_Hello);
 }
 
+void UPicoNetConnection::SetUserID(const FString& InUserID)
+{
+    UserID = InUserID;
+    FTCHARToUTF8 Converted(*UserID);
+    UserIDUTF8.Reset(Converted.Length() + 1);
+    UserIDUTF8.Append(reinterpret_cast<const ANSICHAR*>(Converted.Get()), Converted.Length());
+    UserIDUTF8.Add('\0');
+}
+
 void UPicoNetConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTraits& Traits)
 {
     if (bIsPassThrough)
@@ -130,8 +147,16 @@ void UPicoNetConnection::LowLevelSend(void* Data, int32 CountBits, FOutPacketTra
 
     if (!bBlockSend && CountBytes > 0)
     {
-        UE_LOG(LogNetTraffic, VeryVerbose, TEXT("Low level send to: %llu Count: %d, UserID: %s"), PeerID, CountBytes, *UserID);
-        ppf_Net_SendPacket(TCHAR_TO_UTF8(*UserID), static_cast<size_t>(CountBytes), DataToSend);
+        PICO_LOG_EVENT(LogNetTraffic, VeryVerbose, TEXT("Low level send"), PeerID, CountBytes);
+        UPicoNetDriver* PicoDriver = Cast<UPicoNetDriver>(Driver);
+        if (PicoDriver && PicoDriver->HasPacketTransport())
+        {
+            PicoDriver->SendToPeer(PeerID, DataToSend, static_cast<int32>(CountBytes));
+        }
+        else
+        {
+            ppf_Net_SendPacket(UserIDUTF8.GetData(), static_cast<size_t>(CountBytes), DataToSend);
+        }
     }
 }
 
@@ -153,6 +178,22 @@ FString UPicoNetConnection::LowLevelDescribe()
     return FString::Printf(TEXT("PeerId=%llu"), PeerID);
 }
 
+void UPicoNetConnection::CleanUp()
+{
+    if (bIsPassThrough)
+    {
+        UIpConnection::CleanUp();
+        return;
+    }
+    // The base class clears Driver
+    UPicoNetDriver* PicoDriver = Cast<UPicoNetDriver>(Driver);
+    UNetConnection::CleanUp();
+    if (PicoDriver)
+    {
+        PicoDriver->RemoveConnection(this);
+    }
+}
+
 void UPicoNetConnection::FinishDestroy()
 {
     if (bIsPassThrough)
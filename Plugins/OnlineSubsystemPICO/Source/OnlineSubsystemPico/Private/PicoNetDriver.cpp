@@ -5,6 +5,7 @@
 #include "OnlineSessionInterfacePico.h"
 #include "IPAddressPico.h"
 #include "PicoNetConnection.h"
+#include "PicoLog.h"
 #include "PacketHandlers/StatelessConnectHandlerComponent.h"
 #include "Engine/NetworkDelegates.h"
 
@@ -42,6 +43,15 @@ bool UPicoNetDriver::InitBase(bool bInitAsClient, FNetworkNotify* InNotify, cons
         return false;
     }
 
+    if (bUsePacketTransport)
+    {
+        PacketTransport = MakeUnique<FPicoPacketTransport>(FPicoTransportSendFrame::CreateLambda([](ppfID PeerID, const uint8* Data, int32 Size)
+            {
+                const FPicoPeerIDString PeerIDString(PeerID);
+                ppf_Net_SendPacket(PeerIDString.Get(), static_cast<size_t>(Size), Data);
+            }), MaxTransportFrameSize);
+    }
+
     // How often new links time out
     if (InitialConnectTimeout == 0.0)
     {
@@ -110,10 +120,19 @@ bool UPicoNetDriver::InitConnect(FNetworkNotify* InNotify, const FURL& ConnectUR
     UPicoNetConnection* Connection = NewObject<UPicoNetConnection>(NetConnectionClass);
     check(Connection);
 
+    // Packets to the server are held until it answers the transport offer, a server without it never sees a frame
+    if (PacketTransport.IsValid())
+    {
+        FTransportPeer& TransportPeer = TransportPeers.Add(PicoAddr.GetID());
+        TransportPeer.Mode = ETransportMode::Offered;
+        TransportPeer.OfferTime = FPlatformTime::Seconds();
+        SendTransportControl(PicoAddr.GetID(), EPicoTransportControl::Offer);
+    }
+
     // Set it as the server connection before anything else so everything knows this is a client
     ServerConnection = Connection;
     Connection->InitLocalConnection(this, nullptr, ConnectURL, USOCK_Open);
-    Connections.Add(PicoAddr.GetStrID(), Connection);
+    Connections.Add(PicoAddr.GetID(), Connection);
 
     // Create the control channel so we can send the Hello message
     CreateInitialClientChannels();
@@ -153,6 +172,7 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
     UNetDriver::TickDispatch(DeltaTime);
 
     // Process all incoming packets.
+    const double Now = FPlatformTime::Seconds();
     for (;;)
     {
         auto Packet = ppf_Net_ReadPacket();
@@ -161,176 +181,390 @@ void UPicoNetDriver::TickDispatch(float DeltaTime)
             break;
         }
 
-        bool bIgnorePacket = false;
-
         auto SenderID = ppf_Packet_GetSenderID(Packet);
-        FString SenderIDStr = UTF8_TO_TCHAR(SenderID);
+        const ppfID SenderPeerID = SenderID ? FCStringAnsi::Strtoui64(SenderID, nullptr, 10) : 0;
+        // A missing or malformed sender would otherwise be handled as peer 0 and mix unrelated traffic
+        if (SenderPeerID == 0)
+        {
+            PICO_LOG_RATE_LIMITED(LogNet, Warning, 1.0, TEXT("Dropped a packet with an invalid sender ID"));
+            ppf_Packet_Free(Packet);
+            continue;
+        }
         auto PacketSize = static_cast<int32>(ppf_Packet_GetSize(Packet));
         auto Data = (uint8*)ppf_Packet_GetBytes(Packet);
 
-        // The server must check the pending client connections first to see if any clients are challenging the server
-        // This logic is basically the same as the one in IpNetDriver
-        if (IsServer() && PendingClientConnections.Contains(SenderIDStr))
+        EPicoTransportControl Control;
+        uint8 ControlVersion = 0;
+        if (FPicoPacketTransport::ReadControlMessage(Data, PacketSize, Control, ControlVersion))
         {
-            bool bPassedChallenge = false;
-            TSharedPtr<StatelessConnectHandlerComponent> StatelessConnect;
-
-            if (!ConnectionlessHandler.IsValid() || !StatelessConnectComponent.IsValid())
+            ProcessTransportControl(SenderPeerID, Control, ControlVersion, Now);
+        }
+        // Only peers that accepted the transport send frames, everything else is a plain packet
+        else if (IsTransportEnabled(SenderPeerID))
+        {
+            const bool bWasFrame = PacketTransport->Receive(SenderPeerID, Data, PacketSize, Now,
+                [this, SenderID, SenderPeerID](const uint8* FramePacket, int32 FramePacketSize)
+                {
+                    ProcessIncomingPacket(SenderID, SenderPeerID, const_cast<uint8*>(FramePacket), FramePacketSize);
+                });
+            if (!bWasFrame)
             {
-                UE_LOG(LogNet, Log,
-                    TEXT("Invalid ConnectionlessHandler (%i) or StatelessConnectComponent (%i); can't accept connections."),
-                    (int32)(ConnectionlessHandler.IsValid()), (int32)(StatelessConnectComponent.IsValid()));
-                continue;
+                PICO_LOG_RATE_LIMITED(LogNet, Warning, 1.0, TEXT("Dropped a malformed transport frame from %llu"), SenderPeerID);
             }
+        }
+        else
+        {
+            ProcessIncomingPacket(SenderID, SenderPeerID, Data, PacketSize);
+        }
+        ppf_Packet_Free(Packet);
+    }
 
-            UE_LOG(LogNet, Verbose, TEXT("Checking challenge from: %s"), *SenderIDStr);
-            TSharedPtr<FInternetAddr> PicoAddr = MakeShareable(new FInternetAddrPico(SenderIDStr));
-            StatelessConnect = StatelessConnectComponent.Pin();
-            const ProcessedPacket UnProcessedPacket = ConnectionlessHandler->IncomingConnectionless(PicoAddr, Data, PacketSize);
-            bool bRestartedHandshake = false;
-            bPassedChallenge = !UnProcessedPacket.bError && StatelessConnect->HasPassedChallenge(PicoAddr, bRestartedHandshake);
+    ExpireTransportOffers(Now);
+}
 
-            if (bPassedChallenge)
-            {
-                PendingClientConnections.Remove(SenderIDStr);
-                PacketSize = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
-                if (PacketSize > 0)
-                {
-                    Data = UnProcessedPacket.Data;
-                }
+bool UPicoNetDriver::IsTransportEnabled(ppfID PeerID) const
+{
+    const FTransportPeer* TransportPeer = PacketTransport.IsValid() ? TransportPeers.Find(PeerID) : nullptr;
+    return TransportPeer && TransportPeer->Mode == ETransportMode::Enabled;
+}
+
+void UPicoNetDriver::SendTransportControl(ppfID PeerID, EPicoTransportControl Control)
+{
+    uint8 Message[FPicoPacketTransport::ControlMessageSize];
+    FPicoPacketTransport::WriteControlMessage(Control, Message);
+    const FPicoPeerIDString PeerIDString(PeerID);
+    ppf_Net_SendPacket2(PeerIDString.Get(), sizeof(Message), Message, true);
+}
+
+void UPicoNetDriver::ProcessTransportControl(ppfID PeerID, EPicoTransportControl Control, uint8 Version, double Now)
+{
+    switch (Control)
+    {
+    case EPicoTransportControl::Offer:
+    {
+        // A new offer comes from a new connection of the peer, whose frames start over
+        const bool bAccept = PacketTransport.IsValid() && Version == FPicoPacketTransport::ProtocolVersion;
+        if (bAccept)
+        {
+            PacketTransport->RemovePeer(PeerID, Now);
+            TransportPeers.FindOrAdd(PeerID).Mode = ETransportMode::Enabled;
+        }
+        else
+        {
+            TransportPeers.Remove(PeerID);
+        }
+        UE_LOG(LogNet, Verbose, TEXT("%s the packet transport offered by %llu"), bAccept ? TEXT("Accepting") : TEXT("Rejecting"), PeerID);
+        SendTransportControl(PeerID, bAccept ? EPicoTransportControl::Accept : EPicoTransportControl::Reject);
+        break;
+    }
+    case EPicoTransportControl::Accept:
+    case EPicoTransportControl::Reject:
+    {
+        FTransportPeer* TransportPeer = TransportPeers.Find(PeerID);
+        if (TransportPeer == nullptr || !PacketTransport.IsValid())
+        {
+            break;
+        }
+        const bool bEnabled = Control == EPicoTransportControl::Accept;
+        if (TransportPeer->Mode == ETransportMode::Offered)
+        {
+            ResolveTransportOffer(PeerID, *TransportPeer, bEnabled);
+        }
+        else if (TransportPeer->Mode == ETransportMode::Disabled && bEnabled)
+        {
+            // The server accepted after the offer timed out and now sends frames, follow it
+            UE_LOG(LogNet, Log, TEXT("Late packet transport acceptance from %llu"), PeerID);
+            TransportPeer->Mode = ETransportMode::Enabled;
+        }
+        break;
+    }
+    }
+}
+
+void UPicoNetDriver::ResolveTransportOffer(ppfID PeerID, FTransportPeer& TransportPeer, bool bEnabled)
+{
+    UE_LOG(LogNet, Verbose, TEXT("Packet transport with %llu is %s"), PeerID, bEnabled ? TEXT("enabled") : TEXT("disabled"));
+    TransportPeer.Mode = bEnabled ? ETransportMode::Enabled : ETransportMode::Disabled;
+    const double Now = FPlatformTime::Seconds();
+    for (const TArray<uint8>& HeldPacket : TransportPeer.HeldPackets)
+    {
+        if (bEnabled)
+        {
+            PacketTransport->Send(PeerID, HeldPacket.GetData(), HeldPacket.Num(), Now);
+        }
+        else
+        {
+            SendPlainPacket(PeerID, HeldPacket.GetData(), HeldPacket.Num());
+        }
+    }
+    TransportPeer.HeldPackets.Empty();
+}
+
+void UPicoNetDriver::ExpireTransportOffers(double Now)
+{
+    for (TPair<ppfID, FTransportPeer>& Pair : TransportPeers)
+    {
+        if (Pair.Value.Mode == ETransportMode::Offered && Now - Pair.Value.OfferTime >= TransportOfferTimeOut)
+        {
+            UE_LOG(LogNet, Log, TEXT("%llu did not answer the packet transport offer, sending plain packets"), Pair.Key);
+            ResolveTransportOffer(Pair.Key, Pair.Value, false);
+        }
+    }
+}
 
-                UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *SenderIDStr);
+void UPicoNetDriver::ProcessIncomingPacket(const ANSICHAR* SenderID, ppfID SenderPeerID, uint8* Data, int32 PacketSize)
+{
+    bool bIgnorePacket = false;
 
-                // Create an unreal connection to the client
-                UPicoNetConnection* Connection = NewObject<UPicoNetConnection>(NetConnectionClass);
-                check(Connection);
+    // The server must check the pending client connections first to see if any clients are challenging the server
+    // This logic is basically the same as the one in IpNetDriver
+    if (IsServer() && PendingClientConnections.Contains(SenderPeerID))
+    {
+        // Handshake only, the string form is needed by the address
+        const FString SenderIDStr = UTF8_TO_TCHAR(SenderID);
+        bool bPassedChallenge = false;
+        TSharedPtr<StatelessConnectHandlerComponent> StatelessConnect;
 
-                Connection->InitRemoteConnection(this, nullptr, FURL(), *PicoAddr, USOCK_Open);
+        if (!ConnectionlessHandler.IsValid() || !StatelessConnectComponent.IsValid())
+        {
+            UE_LOG(LogNet, Log,
+                TEXT("Invalid ConnectionlessHandler (%i) or StatelessConnectComponent (%i); can't accept connections."),
+                (int32)(ConnectionlessHandler.IsValid()), (int32)(StatelessConnectComponent.IsValid()));
+            return;
+        }
 
-                AddClientConnection(Connection);
+        UE_LOG(LogNet, Verbose, TEXT("Checking challenge from: %s"), *SenderIDStr);
+        TSharedPtr<FInternetAddr> PicoAddr = MakeShareable(new FInternetAddrPico(SenderIDStr));
+        StatelessConnect = StatelessConnectComponent.Pin();
+        const ProcessedPacket UnProcessedPacket = ConnectionlessHandler->IncomingConnectionless(PicoAddr, Data, PacketSize);
+        bool bRestartedHandshake = false;
+        bPassedChallenge = !UnProcessedPacket.bError && StatelessConnect->HasPassedChallenge(PicoAddr, bRestartedHandshake);
 
-                Connections.Add(SenderIDStr, Connection);
+        if (bPassedChallenge)
+        {
+            PendingClientConnections.Remove(SenderPeerID);
+            PacketSize = FMath::DivideAndRoundUp(UnProcessedPacket.CountBits, 8);
+            if (PacketSize > 0)
+            {
+                Data = UnProcessedPacket.Data;
+            }
 
-                // Set the initial packet sequence from the handshake data
-                if (StatelessConnect.IsValid())
-                {
-                    int32 ServerSequence = 0;
-                    int32 ClientSequence = 0;
+            UE_LOG(LogNet, Log, TEXT("Server accepting post-challenge connection from: %s"), *SenderIDStr);
 
-                    StatelessConnect->GetChallengeSequence(ServerSequence, ClientSequence);
+            // Create an unreal connection to the client
+            UPicoNetConnection* Connection = NewObject<UPicoNetConnection>(NetConnectionClass);
+            check(Connection);
 
-                    Connection->InitSequence(ClientSequence, ServerSequence);
+            Connection->InitRemoteConnection(this, nullptr, FURL(), *PicoAddr, USOCK_Open);
 
-                    StatelessConnect->ResetChallengeData();
-                }
+            AddClientConnection(Connection);
 
-                if (Connection->Handler.IsValid())
-                {
-                    Connection->Handler->BeginHandshaking();
-                }
+            Connections.Add(SenderPeerID, Connection);
+            // A reconnecting peer starts its frame sequence over
+            if (PacketTransport.IsValid())
+            {
+                PacketTransport->RemovePeer(SenderPeerID, FPlatformTime::Seconds());
+            }
 
-                Notify->NotifyAcceptedConnection(Connection);
+            // Set the initial packet sequence from the handshake data
+            if (StatelessConnect.IsValid())
+            {
+                int32 ServerSequence = 0;
+                int32 ClientSequence = 0;
 
-                // If there is nothing left to process for this packet, then skip it
-                if (PacketSize == 0)
-                {
-                    bIgnorePacket = true;
-                }
+                StatelessConnect->GetChallengeSequence(ServerSequence, ClientSequence);
+
+                Connection->InitSequence(ClientSequence, ServerSequence);
+
+                StatelessConnect->ResetChallengeData();
             }
-            else
+
+            if (Connection->Handler.IsValid())
+            {
+                Connection->Handler->BeginHandshaking();
+            }
+
+            Notify->NotifyAcceptedConnection(Connection);
+
+            // If there is nothing left to process for this packet, then skip it
+            if (PacketSize == 0)
             {
-                UE_LOG(LogNet, Warning, TEXT("Server failed post-challenge connection from: %s"), *SenderIDStr);
                 bIgnorePacket = true;
             }
         }
-
-        // Process the packet if we aren't suppose to ignore it
-        if (!bIgnorePacket && Connections.Contains(SenderIDStr))
+        else
         {
-            auto Connection = Connections[SenderIDStr];
+            UE_LOG(LogNet, Warning, TEXT("Server failed post-challenge connection from: %s"), *SenderIDStr);
+            bIgnorePacket = true;
+        }
+    }
+
+    // Process the packet if we aren't suppose to ignore it
+    UPicoNetConnection** FoundConnection = bIgnorePacket ? nullptr : Connections.Find(SenderPeerID);
+    if (FoundConnection)
+    {
+        auto Connection = *FoundConnection;
 #if ENGINE_MAJOR_VERSION > 4
-            if (Connection->GetConnectionState() == EConnectionState::USOCK_Open)
+        if (Connection->GetConnectionState() == EConnectionState::USOCK_Open)
 #elif ENGINE_MINOR_VERSION > 24
-            if (Connection->State == EConnectionState::USOCK_Open)
+        if (Connection->State == EConnectionState::USOCK_Open)
 #endif
-            {
-                UE_LOG(LogNetTraffic, VeryVerbose, TEXT("Got a raw packet of size %d"), PacketSize);
-                Connection->ReceivedRawPacket(Data, PacketSize);
-            }
-            else
-            {
-                // This can happen on non-seamless map travels
-                UE_LOG(LogNet, Verbose, TEXT("Got a packet but the connection is closed to: %s"), *SenderIDStr);
-            }
+        {
+            PICO_LOG_EVENT(LogNetTraffic, VeryVerbose, TEXT("Got a raw packet"), SenderPeerID, PacketSize);
+            Connection->ReceivedRawPacket(Data, PacketSize);
         }
         else
         {
-            UE_LOG(LogNet, Warning, TEXT("There is no connection to: %s"), *SenderIDStr);
+            // This can happen on non-seamless map travels
+            PICO_LOG_EVENT(LogNet, Verbose, TEXT("Got a packet but the connection is closed"), SenderPeerID);
         }
-        ppf_Packet_Free(Packet);
+    }
+    else if (!bIgnorePacket)
+    {
+        PICO_LOG_RATE_LIMITED(LogNet, Warning, 1.0, TEXT("There is no connection to: %llu"), SenderPeerID);
     }
 }
 
-void UPicoNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
+void UPicoNetDriver::TickFlush(float DeltaSeconds)
 {
-    if (bIsPassthrough)
+    Super::TickFlush(DeltaSeconds);
+
+    // Connections have sent this tick's packets, send them out aggregated per peer
+    if (!bIsPassthrough && PacketTransport.IsValid())
     {
-        return UIpNetDriver::LowLevelSend(Address, Data, CountBits, Traits);
+        PacketTransport->Flush(FPlatformTime::Seconds());
     }
+}
 
-#if ENGINE_MAJOR_VERSION > 4
-    FInternetAddrPico PicoAddr = FInternetAddrPico::FromUrl(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#elif ENGINE_MINOR_VERSION > 26
-    FInternetAddrPico PicoAddr = FInternetAddrPico::FromUrl(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#elif ENGINE_MINOR_VERSION > 24
-    FInternetAddrPico PicoAddr(FURL(nullptr, *Address->ToString(false), ETravelType::TRAVEL_Absolute));
-#endif
+void UPicoNetDriver::SendToPeer(ppfID PeerID, const uint8* Data, int32 CountBytes)
+{
+    FTransportPeer* TransportPeer = PacketTransport.IsValid() ? TransportPeers.Find(PeerID) : nullptr;
+    if (TransportPeer && TransportPeer->Mode == ETransportMode::Enabled)
+    {
+        PacketTransport->Send(PeerID, Data, CountBytes, FPlatformTime::Seconds());
+        return;
+    }
+    if (TransportPeer && TransportPeer->Mode == ETransportMode::Offered)
+    {
+        if (TransportPeer->HeldPackets.Num() >= MaxHeldPackets)
+        {
+            // The net connection resends what it needs
+            TransportPeer->HeldPackets.RemoveAt(0);
+        }
+        TransportPeer->HeldPackets.Emplace(Data, CountBytes);
+        return;
+    }
+    SendPlainPacket(PeerID, Data, CountBytes);
+}
+
+void UPicoNetDriver::SendPlainPacket(ppfID PeerID, const uint8* Data, int32 CountBytes)
+{
+    const FPicoPeerIDString PeerIDString(PeerID);
+    ppf_Net_SendPacket(PeerIDString.Get(), static_cast<size_t>(CountBytes), Data);
+}
+
+void UPicoNetDriver::RemoveConnection(UPicoNetConnection* Connection)
+{
+    const ppfID PeerID = Connection->GetPeerID();
+    UPicoNetConnection* const* FoundConnection = Connections.Find(PeerID);
+    if (FoundConnection == nullptr || *FoundConnection != Connection)
+    {
+        return;
+    }
+    Connections.Remove(PeerID);
+    TransportPeers.Remove(PeerID);
+    if (PacketTransport.IsValid())
+    {
+        PacketTransport->RemovePeer(PeerID, FPlatformTime::Seconds());
+    }
+}
+
+int32 UPicoNetDriver::GetMaxTransportPacketSize() const
+{
+    return PacketTransport.IsValid() ? PacketTransport->GetMaxPacketSize() : MAX_PACKET_SIZE;
+}
+
+const FPicoTransportStats* UPicoNetDriver::GetTransportStats(ppfID PeerID) const
+{
+    return PacketTransport.IsValid() ? PacketTransport->FindStats(PeerID) : nullptr;
+}
 
-    ppfID PeerID = PicoAddr.GetID();
-    FString UserID = PicoAddr.GetStrID();
-    if (IOnlineSubsystem* Subsystem = IOnlineSubsystem::Get())
+ppfID UPicoNetDriver::GetPeerID(const FInternetAddr& Address)
+{
+    if (Address.GetProtocolType() == FNetworkProtocolTypes::Pico)
     {
-        auto PicoSubsystem = static_cast<FOnlineSubsystemPico*>(Subsystem);
-        if (PicoSubsystem && PicoSubsystem->Init() && PicoSubsystem->GetGameSessionInterface())
+        return static_cast<const FInternetAddrPico&>(Address).GetID();
+    }
+    // Foreign address types only expose their string form
+    return FCString::Strtoui64(*Address.ToString(false), nullptr, 10);
+}
+
+TSharedPtr<FOnlineSessionPico, ESPMode::ThreadSafe> UPicoNetDriver::GetInitializedSessionInterface()
+{
+    TSharedPtr<FOnlineSessionPico, ESPMode::ThreadSafe> SessionInterface = CachedSessionInterface.Pin();
+    if (!SessionInterface.IsValid())
+    {
+        if (FOnlineSubsystemPico* PicoSubsystem = static_cast<FOnlineSubsystemPico*>(IOnlineSubsystem::Get(PICO_SUBSYSTEM)))
         {
-            auto SessionInterface = PicoSubsystem->GetGameSessionInterface();
-            if (!SessionInterface->IsInitSuccess())
+            if (PicoSubsystem->Init())
             {
-                return;
+                SessionInterface = PicoSubsystem->GetGameSessionInterface();
+                CachedSessionInterface = SessionInterface;
             }
-            const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
+        }
+    }
+    if (SessionInterface.IsValid() && SessionInterface->IsInitSuccess())
+    {
+        return SessionInterface;
+    }
+    return nullptr;
+}
 
-            if (ConnectionlessHandler.IsValid())
-            {
-                const ProcessedPacket ProcessedData =
-                    ConnectionlessHandler->OutgoingConnectionless(Address, (uint8*)DataToSend, CountBits, Traits);
+void UPicoNetDriver::LowLevelSend(TSharedPtr<const FInternetAddr> Address, void* Data, int32 CountBits, FOutPacketTraits& Traits)
+{
+    if (bIsPassthrough)
+    {
+        return UIpNetDriver::LowLevelSend(Address, Data, CountBits, Traits);
+    }
 
-                if (!ProcessedData.bError)
-                {
-                    DataToSend = ProcessedData.Data;
-                    CountBits = ProcessedData.CountBits;
-                }
-                else
-                {
-                    CountBits = 0;
-                }
-            }
-            int32 BytesSent = 0;
-            uint32 CountBytes = FMath::DivideAndRoundUp(CountBits, 8);
+    if (!Address.IsValid())
+    {
+        return;
+    }
 
-            if (CountBits > 0)
-            {
-                ppf_Net_SendPacket(TCHAR_TO_UTF8(*UserID), static_cast<size_t>(CountBytes), DataToSend);
-            }
+    const ppfID PeerID = GetPeerID(*Address);
+    if (!GetInitializedSessionInterface().IsValid())
+    {
+        UE_LOG(LogNet, Warning, TEXT("There is no connection to: %llu"), PeerID);
+        return;
+    }
+
+    const uint8* DataToSend = reinterpret_cast<uint8*>(Data);
+
+    if (ConnectionlessHandler.IsValid())
+    {
+        const ProcessedPacket ProcessedData =
+            ConnectionlessHandler->OutgoingConnectionless(Address, (uint8*)DataToSend, CountBits, Traits);
+
+        if (!ProcessedData.bError)
+        {
+            DataToSend = ProcessedData.Data;
+            CountBits = ProcessedData.CountBits;
         }
         else
         {
-            UE_LOG(LogNet, Warning, TEXT("There is no connection to: %s"), *UserID);
+            CountBits = 0;
         }
     }
+    uint32 CountBytes = FMath::DivideAndRoundUp(CountBits, 8);
+
+    if (CountBits > 0)
+    {
+        SendToPeer(PeerID, DataToSend, static_cast<int32>(CountBytes));
+    }
 }
 
-bool UPicoNetDriver::AddNewClientConnection(const FString& UserID)
+bool UPicoNetDriver::AddNewClientConnection(ppfID PeerID)
 {
     // Ignore the peer if not accepting new connections
     if (Notify->NotifyAcceptingConnection() != EAcceptConnection::Accept)
@@ -339,13 +573,12 @@ bool UPicoNetDriver::AddNewClientConnection(const FString& UserID)
         return false;
     }
 
-    UE_LOG(LogNet, Verbose, TEXT("New incoming peer request: %s"), *UserID);
+    UE_LOG(LogNet, Verbose, TEXT("New incoming peer request: %llu"), PeerID);
 
-    // todo
     // Add to the list of clients we are expecting a challenge from
-    PendingClientConnections.Add(UserID, USOCK_Open);
+    PendingClientConnections.Add(PeerID, USOCK_Open);
     // Remove it from existing connections map if it exists.
-    Connections.Remove(UserID);
+    Connections.Remove(PeerID);
 
     return true;
 }
@@ -358,6 +591,13 @@ void UPicoNetDriver::Shutdown()
         return;
     }
     UNetDriver::Shutdown();
+    // Closing the connections queued their last packets
+    if (PacketTransport.IsValid())
+    {
+        PacketTransport->Flush(FPlatformTime::Seconds());
+        PacketTransport.Reset();
+    }
+    TransportPeers.Empty();
     UE_LOG(LogNet, Verbose, TEXT("Pico Net Driver shutdown"));
 }
 
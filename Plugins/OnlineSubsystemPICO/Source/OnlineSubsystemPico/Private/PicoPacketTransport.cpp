@@ -0,0 +1,320 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+
+#include "PicoPacketTransport.h"
+#include "PicoLog.h"
+#include "EngineLogs.h"
+
+namespace
+{
+    /**
+     * Frame layout, little-endian:
+     * Magic (1) | Sequence (2) | AckSequence (2) | AckBits (4) | AckDelayMs (2) | Flags (1)
+     * followed by every packet as Size (2) | Bytes
+     */
+    constexpr uint8 FrameMagic = 0xB7;
+    constexpr int32 FrameHeaderSize = FPicoPacketTransport::FrameHeaderSize;
+    constexpr int32 PacketSizeFieldSize = FPicoPacketTransport::PacketSizeFieldSize;
+    constexpr uint8 FrameFlag_HasAcks = 1 << 0;
+
+    /** Control message layout: Magic (8) | Version (1) | Control (1) */
+    constexpr uint8 ControlMagic[8] = { 'P', 'X', 'R', 'T', 'R', 'N', 'S', 'P' };
+    static_assert(sizeof(ControlMagic) + 2 == FPicoPacketTransport::ControlMessageSize, "Control message layout changed");
+
+    /** Weight of a new sample in the loss rate average */
+    constexpr double LossRateGain = 1.0 / 16.0;
+
+    void WriteUInt16(uint8* Dest, uint16 Value)
+    {
+        Dest[0] = static_cast<uint8>(Value & 0xFF);
+        Dest[1] = static_cast<uint8>(Value >> 8);
+    }
+
+    uint16 ReadUInt16(const uint8* Src)
+    {
+        return static_cast<uint16>(Src[0] | (Src[1] << 8));
+    }
+
+    void WriteUInt32(uint8* Dest, uint32 Value)
+    {
+        WriteUInt16(Dest, static_cast<uint16>(Value & 0xFFFF));
+        WriteUInt16(Dest + 2, static_cast<uint16>(Value >> 16));
+    }
+
+    uint32 ReadUInt32(const uint8* Src)
+    {
+        return ReadUInt16(Src) | (static_cast<uint32>(ReadUInt16(Src + 2)) << 16);
+    }
+
+    /** Distance from B to A in sequence space, negative if A is older */
+    int32 SequenceDiff(uint16 A, uint16 B)
+    {
+        return static_cast<int16>(static_cast<uint16>(A - B));
+    }
+
+    bool IsValidFrame(const uint8* Data, int32 Size)
+    {
+        if (Size < FrameHeaderSize || Data[0] != FrameMagic)
+        {
+            return false;
+        }
+        int32 Offset = FrameHeaderSize;
+        while (Offset + PacketSizeFieldSize <= Size)
+        {
+            Offset += PacketSizeFieldSize + ReadUInt16(Data + Offset);
+        }
+        return Offset == Size;
+    }
+}
+
+void FPicoPacketTransport::WriteControlMessage(EPicoTransportControl Control, uint8 (&OutData)[ControlMessageSize])
+{
+    FMemory::Memcpy(OutData, ControlMagic, sizeof(ControlMagic));
+    OutData[sizeof(ControlMagic)] = ProtocolVersion;
+    OutData[sizeof(ControlMagic) + 1] = static_cast<uint8>(Control);
+}
+
+bool FPicoPacketTransport::ReadControlMessage(const uint8* Data, int32 Size, EPicoTransportControl& OutControl, uint8& OutVersion)
+{
+    if (Size != ControlMessageSize || FMemory::Memcmp(Data, ControlMagic, sizeof(ControlMagic)) != 0)
+    {
+        return false;
+    }
+    const uint8 Control = Data[sizeof(ControlMagic) + 1];
+    if (Control < static_cast<uint8>(EPicoTransportControl::Offer) || Control > static_cast<uint8>(EPicoTransportControl::Reject))
+    {
+        return false;
+    }
+    OutVersion = Data[sizeof(ControlMagic)];
+    OutControl = static_cast<EPicoTransportControl>(Control);
+    return true;
+}
+
+FPicoPacketTransport::FPicoPacketTransport(FPicoTransportSendFrame InSendFrame, int32 InMaxFrameSize) :
+    SendFrame(MoveTemp(InSendFrame)),
+    MaxFrameSize(FMath::Max(InMaxFrameSize, FrameHeaderSize + PacketSizeFieldSize + 1))
+{
+}
+
+bool FPicoPacketTransport::Send(ppfID PeerID, const uint8* Data, int32 Size, double Now)
+{
+    if (Size <= 0)
+    {
+        return false;
+    }
+    // A frame larger than MaxFrameSize could be rejected by ppf_Net_SendPacket, dropping every packet it carries
+    if (Size > GetMaxPacketSize())
+    {
+        PICO_LOG_RATE_LIMITED(LogNet, Warning, 1.0, TEXT("Dropped a %d byte packet to %llu, frames carry at most %d bytes"), Size, PeerID, GetMaxPacketSize());
+        return false;
+    }
+
+    FPeer& Peer = Peers.FindOrAdd(PeerID);
+    if (Peer.PendingFrame.Num() > 0 && Peer.PendingFrame.Num() + PacketSizeFieldSize + Size > MaxFrameSize)
+    {
+        SendPendingFrame(PeerID, Peer, Now);
+    }
+    if (Peer.PendingFrame.Num() == 0)
+    {
+        Peer.PendingFrame.AddUninitialized(FrameHeaderSize);
+    }
+
+    const int32 Offset = Peer.PendingFrame.Num();
+    Peer.PendingFrame.AddUninitialized(PacketSizeFieldSize);
+    WriteUInt16(Peer.PendingFrame.GetData() + Offset, static_cast<uint16>(Size));
+    Peer.PendingFrame.Append(Data, Size);
+    Peer.Stats.PacketsSent++;
+
+    // A frame without room for another packet does not wait for the flush
+    if (Peer.PendingFrame.Num() + PacketSizeFieldSize >= MaxFrameSize)
+    {
+        SendPendingFrame(PeerID, Peer, Now);
+    }
+    return true;
+}
+
+void FPicoPacketTransport::Flush(double Now)
+{
+    for (TPair<ppfID, FPeer>& Pair : Peers)
+    {
+        if (Pair.Value.PendingFrame.Num() > 0)
+        {
+            SendPendingFrame(Pair.Key, Pair.Value, Now);
+        }
+    }
+}
+
+void FPicoPacketTransport::SendPendingFrame(ppfID PeerID, FPeer& Peer, double Now)
+{
+    const uint16 Sequence = Peer.NextSequence++;
+
+    // The slot is reused every SentHistorySize frames, long after its frame left the acknowledgement window
+    FSentFrame& Sent = Peer.SentFrames[Sequence % SentHistorySize];
+    if (Sent.bPending && Peer.bPeerSendsAcks)
+    {
+        ResolveFrame(Peer, Sent, false);
+    }
+    Sent.Sequence = Sequence;
+    Sent.SendTime = Now;
+    Sent.bPending = true;
+
+    const double AckDelay = Peer.bHasReceived ? Now - Peer.LatestReceivedTime : 0.0;
+    uint8* Header = Peer.PendingFrame.GetData();
+    Header[0] = FrameMagic;
+    WriteUInt16(Header + 1, Sequence);
+    WriteUInt16(Header + 3, Peer.LatestReceived);
+    WriteUInt32(Header + 5, Peer.ReceivedBits);
+    WriteUInt16(Header + 9, static_cast<uint16>(FMath::Clamp(AckDelay * 1000.0, 0.0, static_cast<double>(MAX_uint16))));
+    Header[11] = Peer.bHasReceived ? FrameFlag_HasAcks : 0;
+
+    Peer.Stats.FramesSent++;
+    Peer.Stats.BytesSent += Peer.PendingFrame.Num();
+    SendFrame.ExecuteIfBound(PeerID, Peer.PendingFrame.GetData(), Peer.PendingFrame.Num());
+    Peer.PendingFrame.Reset();
+}
+
+bool FPicoPacketTransport::Receive(ppfID PeerID, const uint8* Data, int32 Size, double Now, TFunctionRef<void(const uint8*, int32)> OnPacket)
+{
+    if (!IsValidFrame(Data, Size))
+    {
+        return false;
+    }
+
+    FPeer& Peer = Peers.FindOrAdd(PeerID);
+    Peer.Stats.BytesReceived += Size;
+    if ((Data[11] & FrameFlag_HasAcks) != 0)
+    {
+        Peer.bPeerSendsAcks = true;
+        ProcessAcks(Peer, ReadUInt16(Data + 3), ReadUInt32(Data + 5), ReadUInt16(Data + 9) / 1000.0, Now);
+    }
+
+    if (!RecordReceived(Peer, ReadUInt16(Data + 1), Now))
+    {
+        return true;
+    }
+
+    Peer.Stats.FramesReceived++;
+    int32 Offset = FrameHeaderSize;
+    while (Offset < Size)
+    {
+        const int32 PacketSize = ReadUInt16(Data + Offset);
+        Offset += PacketSizeFieldSize;
+        Peer.Stats.PacketsReceived++;
+        OnPacket(Data + Offset, PacketSize);
+        Offset += PacketSize;
+    }
+    return true;
+}
+
+bool FPicoPacketTransport::RecordReceived(FPeer& Peer, uint16 Sequence, double Now)
+{
+    const int32 Diff = Peer.bHasReceived ? SequenceDiff(Sequence, Peer.LatestReceived) : AckWindow + 1;
+    if (Diff > 0)
+    {
+        // Shift the history so that the previous latest frame lands on bit Diff - 1
+        const uint64 Shifted = Diff > AckWindow ? 0 : ((static_cast<uint64>(Peer.ReceivedBits) << Diff) | (1ull << (Diff - 1)));
+        Peer.ReceivedBits = Peer.bHasReceived ? static_cast<uint32>(Shifted) : 0;
+        Peer.LatestReceived = Sequence;
+        Peer.LatestReceivedTime = Now;
+        Peer.bHasReceived = true;
+        return true;
+    }
+    if (Diff == 0)
+    {
+        Peer.Stats.DuplicateFrames++;
+        return false;
+    }
+    if (-Diff <= AckWindow)
+    {
+        const uint32 Bit = 1u << (-Diff - 1);
+        if ((Peer.ReceivedBits & Bit) != 0)
+        {
+            Peer.Stats.DuplicateFrames++;
+            return false;
+        }
+        Peer.ReceivedBits |= Bit;
+        Peer.Stats.OutOfOrderFrames++;
+        return true;
+    }
+
+    // Too old to tell apart from a duplicate. Restarting the window here would accept duplicates again;
+    // a peer that restarts its sequence reconnects, which resets its state with RemovePeer
+    Peer.Stats.LateFrames++;
+    return false;
+}
+
+void FPicoPacketTransport::ProcessAcks(FPeer& Peer, uint16 AckSequence, uint32 AckBits, double AckDelay, double Now)
+{
+    for (FSentFrame& Sent : Peer.SentFrames)
+    {
+        if (!Sent.bPending)
+        {
+            continue;
+        }
+
+        const int32 Age = SequenceDiff(AckSequence, Sent.Sequence);
+        if (Age == 0)
+        {
+            // Only the latest acknowledged frame has a known acknowledgement delay
+            const double Sample = FMath::Max(Now - Sent.SendTime - AckDelay, 0.0);
+            FPicoTransportStats& Stats = Peer.Stats;
+            if (!Peer.bHasRTTSample)
+            {
+                Peer.bHasRTTSample = true;
+                Stats.SmoothedRTT = Sample;
+                Stats.RTTVariance = Sample / 2.0;
+            }
+            else
+            {
+                Stats.RTTVariance = 0.75 * Stats.RTTVariance + 0.25 * FMath::Abs(Stats.SmoothedRTT - Sample);
+                Stats.SmoothedRTT = 0.875 * Stats.SmoothedRTT + 0.125 * Sample;
+            }
+            ResolveFrame(Peer, Sent, true);
+        }
+        else if (Age > 0 && Age <= AckWindow)
+        {
+            if ((AckBits & (1u << (Age - 1))) != 0)
+            {
+                ResolveFrame(Peer, Sent, true);
+            }
+        }
+        else if (Age > AckWindow)
+        {
+            ResolveFrame(Peer, Sent, false);
+        }
+    }
+}
+
+void FPicoPacketTransport::ResolveFrame(FPeer& Peer, FSentFrame& Frame, bool bAcked)
+{
+    Frame.bPending = false;
+    if (bAcked)
+    {
+        Peer.Stats.FramesAcked++;
+    }
+    else
+    {
+        Peer.Stats.FramesLost++;
+    }
+    Peer.Stats.LossRate += LossRateGain * ((bAcked ? 0.0 : 1.0) - Peer.Stats.LossRate);
+}
+
+void FPicoPacketTransport::RemovePeer(ppfID PeerID, double Now)
+{
+    FPeer* Peer = Peers.Find(PeerID);
+    if (Peer == nullptr)
+    {
+        return;
+    }
+    // The closing connection queued its last packets
+    if (Peer->PendingFrame.Num() > 0)
+    {
+        SendPendingFrame(PeerID, *Peer, Now);
+    }
+    Peers.Remove(PeerID);
+}
+
+const FPicoTransportStats* FPicoPacketTransport::FindStats(ppfID PeerID) const
+{
+    const FPeer* Peer = Peers.Find(PeerID);
+    return Peer ? &Peer->Stats : nullptr;
+}
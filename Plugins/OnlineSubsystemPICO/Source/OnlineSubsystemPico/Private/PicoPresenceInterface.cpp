@@ -55,9 +55,9 @@ void FPicoPresenceInterface::OnQueryPresenceClearComplete(ppfMessageHandle Messa
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceClearComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -98,9 +98,9 @@ void FPicoPresenceInterface::OnQueryReadInvitableUserComplete(ppfMessageHandle M
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryReadInvitableUserComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         UE_LOG_ONLINE_FRIEND(Log, TEXT("FPicoPresenceInterface::On Read Invitable User Complete Recive Failed :%s"), *ErrorMessage);
         Delegate.ExecuteIfBound(false, ErrorMessage);
@@ -196,9 +196,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetComplete(ppfMessageHandle Message
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -231,9 +231,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetDestinationComplete(ppfMessageHan
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetDestinationComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -266,9 +266,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetSetIsJoinableComplete(ppfMessageH
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetSetIsJoinableComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -301,9 +301,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetLobbySessionComplete(ppfMessageHa
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetLobbySessionComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
 
@@ -337,9 +337,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetMatchSessionComplete(ppfMessageHa
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetMatchSessionComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -372,9 +372,9 @@ void FPicoPresenceInterface::OnQueryPresenceSetExtraComplete(ppfMessageHandle Me
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceSetExtraComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -407,9 +407,9 @@ void FPicoPresenceInterface::OnQueryPresenceReadSendInvitesComplete(ppfMessageHa
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryPresenceReadSendInvitesComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -538,9 +538,9 @@ void FPicoPresenceInterface::OnQueryGetDestinationsComplete(ppfMessageHandle Mes
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQueryGetDestinationsComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
@@ -606,8 +606,8 @@ bool FPicoPresenceInterface::LaunchInvitePanel(const FOnLaunchInvitePanelComplet
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
                 UE_LOG(PresenceInterface, Log, TEXT("LaunchInvitePanel return failed:%s"), *ErrorMessage);
                 Delegate.ExecuteIfBound(false, ErrorMessage);
             }
@@ -653,8 +653,8 @@ bool FPicoPresenceInterface::ShareMedia(EShareMediaType InMediaType, const FStri
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
                 UE_LOG(PresenceInterface, Log, TEXT("ShareMedia return failed:%s"), *ErrorMessage);
                 Delegate.ExecuteIfBound(false, ErrorMessage);
             }
@@ -738,9 +738,9 @@ void FPicoPresenceInterface::OnQuerySendInvitesComplete(ppfMessageHandle Message
     UE_LOG(PresenceInterface, Log, TEXT("FPicoPresenceInterface::OnQuerySendInvitesComplete"));
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-        FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
         ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
         Delegate.ExecuteIfBound(false, ErrorMessage);
         return;
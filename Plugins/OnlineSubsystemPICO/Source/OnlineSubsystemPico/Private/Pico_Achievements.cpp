@@ -149,9 +149,9 @@ bool FPicoAchievementsInterface::AddCount(const FString& Name, const int64& Coun
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("AddCount return failed:%s"), *ErrorMessage);
                 this->AddCountDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -185,9 +185,9 @@ bool FPicoAchievementsInterface::AddFields(const FString& Name, const FString& F
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("AddFields return failed:%s"), *ErrorMessage);
                 this->AddFieldsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -221,9 +221,9 @@ bool FPicoAchievementsInterface::Unlock(const FString& Name, const FString& Extr
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("AddFields return failed:%s"), *ErrorMessage);
                 this->UnlockDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -250,9 +250,9 @@ bool FPicoAchievementsInterface::GetAllDefinitions(int32 PageIndex, int32 PageSi
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("GetAllDefinitions return failed:%s"), *ErrorMessage);
                 this->GetAllDefinitionsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -279,9 +279,9 @@ bool FPicoAchievementsInterface::GetAllProgress(int32 PageIndex, int32 PageSize,
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("GetAllProgress return failed:%s"), *ErrorMessage);
                 this->GetAllProgressDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -319,9 +319,9 @@ bool FPicoAchievementsInterface::GetDefinitionsByName(const TArray<FString>& Nam
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("GetDefinitionsByName return failed:%s"), *ErrorMessage);
                 this->GetDefinitionsByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -359,9 +359,9 @@ bool FPicoAchievementsInterface::GetProgressByName(const TArray<FString>& NameAr
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAchievements, Log, TEXT("GetProgressByName return failed:%s"), *ErrorMessage);
                 this->GetProgressByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -4,12 +4,25 @@
 #include "Pico_AssetFile.h"
 #include "OnlineSubsystemUtils.h"
 #include "OnlineSubsystemPico.h"
+#include "PicoLog.h"
 
 DEFINE_LOG_CATEGORY(PicoAssetFile);
 
 FPicoAssetFileInterface::FPicoAssetFileInterface(FOnlineSubsystemPico& InSubsystem) :
     PicoSubsystem(InSubsystem)
 {
+    if (GConfig)
+    {
+        float ProgressInterval = static_cast<float>(ProgressBroadcastInterval);
+        float StallTimeout = static_cast<float>(DownloadStallTimeout);
+        GConfig->GetInt(TEXT("OnlineSubsystemPico"), TEXT("MaxConcurrentAssetDownloads"), MaxConcurrentDownloads, GEngineIni);
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("AssetDownloadProgressIntervalSeconds"), ProgressInterval, GEngineIni);
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("AssetDownloadStallTimeoutSeconds"), StallTimeout, GEngineIni);
+        MaxConcurrentDownloads = FMath::Max(MaxConcurrentDownloads, 1);
+        ProgressBroadcastInterval = FMath::Max(ProgressInterval, 0.f);
+        DownloadStallTimeout = FMath::Max(StallTimeout, 1.f);
+    }
+
     AssetFileDownloadUpdateHandle =
         PicoSubsystem.GetOrAddNotify(ppfMessageType_Notification_AssetFile_DownloadUpdate)
         .AddRaw(this, &FPicoAssetFileInterface::OnAssetFileDownloadUpdate);
@@ -17,6 +30,9 @@ FPicoAssetFileInterface::FPicoAssetFileInterface(FOnlineSubsystemPico& InSubsyst
     AssetFileDeleteForSafetyHandle =
         PicoSubsystem.GetOrAddNotify(ppfMessageType_Notification_AssetFile_DeleteForSafety)
         .AddRaw(this, &FPicoAssetFileInterface::OnAssetFileDeleteForSafety);
+
+    StallCheckTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FPicoAssetFileInterface::TickStalledDownloads), 1.f);
 }
 
 FPicoAssetFileInterface::~FPicoAssetFileInterface()
@@ -30,6 +46,12 @@ FPicoAssetFileInterface::~FPicoAssetFileInterface()
     {
         AssetFileDeleteForSafetyHandle.Reset();
     }
+
+    if (StallCheckTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(StallCheckTickerHandle);
+        StallCheckTickerHandle.Reset();
+    }
 }
 
 bool FPicoAssetFileInterface::DeleteByID(FString AssetFileID, FAssetFileDeleteResult InDeleteByIDDelegate)
@@ -43,9 +65,9 @@ bool FPicoAssetFileInterface::DeleteByID(FString AssetFileID, FAssetFileDeleteRe
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DeleteByID return failed:%s"), *ErrorMessage);
                 this->DeleteByIDDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -76,9 +98,9 @@ bool FPicoAssetFileInterface::DeleteByName(FString AssetFileName, FAssetFileDele
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DeleteByName return failed:%s"), *ErrorMessage);
                 this->DeleteByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -108,9 +130,9 @@ bool FPicoAssetFileInterface::DownloadById(FString AssetFileID, FAssetFileDownlo
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DownloadById return failed:%s"), *ErrorMessage);
                 this->DownloadByIdDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -140,9 +162,9 @@ bool FPicoAssetFileInterface::DownloadByName(FString AssetFileName, FAssetFileDo
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DownloadByName return failed:%s"), *ErrorMessage);
                 this->DownloadByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -162,6 +184,242 @@ bool FPicoAssetFileInterface::DownloadByName(FString AssetFileName, FAssetFileDo
     return false;
 }
 
+bool FPicoAssetFileInterface::QueueDownloadById(FString AssetFileID, EPicoAssetDownloadPriority Priority, FAssetFileDownloadResult InDownloadByIDDelegate)
+{
+    UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::QueueDownloadById"));
+#if PLATFORM_ANDROID
+    return QueueDownload(FStringTouint64(AssetFileID), Priority, InDownloadByIDDelegate);
+#endif
+    return false;
+}
+
+bool FPicoAssetFileInterface::QueueDownloadByName(FString AssetFileName, EPicoAssetDownloadPriority Priority, FAssetFileDownloadResult InDownloadByNameDelegate)
+{
+    UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::QueueDownloadByName"));
+#if PLATFORM_ANDROID
+    // The queue is keyed by asset ID, so the name is resolved before the download takes its place in it
+    ppfRequest RequestId = ppf_AssetFile_StatusByName(TCHAR_TO_UTF8(*AssetFileName));
+    if (RequestId == 0)
+    {
+        return false;
+    }
+    PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
+        [InDownloadByNameDelegate, Priority, this](ppfMessageHandle Message, bool bIsError)
+        {
+            if (bIsError)
+            {
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+                ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+                UE_LOG(PicoAssetFile, Log, TEXT("QueueDownloadByName return failed:%s"), *ErrorMessage);
+                InDownloadByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+                return;
+            }
+            QueueDownload(ppf_AssetStatus_GetAssetId(ppf_Message_GetAssetStatus(Message)), Priority, InDownloadByNameDelegate);
+        }));
+    return true;
+#endif
+    return false;
+}
+
+bool FPicoAssetFileInterface::QueueDownload(ppfID AssetId, EPicoAssetDownloadPriority Priority, const FAssetFileDownloadResult& InDownloadDelegate)
+{
+    if (FActiveAssetDownload* ActiveDownload = ActiveDownloads.Find(AssetId))
+    {
+        if (ActiveDownload->Result.IsValid())
+        {
+            InDownloadDelegate.ExecuteIfBound(false, FString(), ActiveDownload->Result.Get());
+        }
+        else
+        {
+            ActiveDownload->Delegates.Add(InDownloadDelegate);
+        }
+        return true;
+    }
+
+    int32 QueuedPriority = INDEX_NONE;
+    int32 QueuedIndex = INDEX_NONE;
+    if (FindQueuedDownload(AssetId, QueuedPriority, QueuedIndex))
+    {
+        QueuedDownloads[QueuedPriority][QueuedIndex].Delegates.Add(InDownloadDelegate);
+        const int32 RequestedPriority = static_cast<int32>(Priority);
+        if (RequestedPriority < QueuedPriority)
+        {
+            QueuedDownloads[RequestedPriority].Add(MoveTemp(QueuedDownloads[QueuedPriority][QueuedIndex]));
+            QueuedDownloads[QueuedPriority].RemoveAt(QueuedIndex);
+            StartQueuedDownloads();
+        }
+        return true;
+    }
+
+    FQueuedAssetDownload Download;
+    Download.AssetId = AssetId;
+    Download.Delegates.Add(InDownloadDelegate);
+    QueuedDownloads[static_cast<int32>(Priority)].Add(MoveTemp(Download));
+    StartQueuedDownloads();
+    return true;
+}
+
+bool FPicoAssetFileInterface::RemoveQueuedDownload(FString AssetFileID)
+{
+    UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::RemoveQueuedDownload"));
+    int32 QueuedPriority = INDEX_NONE;
+    int32 QueuedIndex = INDEX_NONE;
+    if (!FindQueuedDownload(FStringTouint64(AssetFileID), QueuedPriority, QueuedIndex))
+    {
+        return false;
+    }
+
+    FQueuedAssetDownload Download = MoveTemp(QueuedDownloads[QueuedPriority][QueuedIndex]);
+    QueuedDownloads[QueuedPriority].RemoveAt(QueuedIndex);
+    const FString ErrorMessage = TEXT("Download removed from queue");
+    for (const FAssetFileDownloadResult& Delegate : Download.Delegates)
+    {
+        Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+    }
+    return true;
+}
+
+void FPicoAssetFileInterface::SetMaxConcurrentDownloads(int32 InMaxConcurrentDownloads)
+{
+    MaxConcurrentDownloads = FMath::Max(InMaxConcurrentDownloads, 1);
+    StartQueuedDownloads();
+}
+
+void FPicoAssetFileInterface::SetDownloadProgressInterval(float Seconds)
+{
+    ProgressBroadcastInterval = FMath::Max(Seconds, 0.f);
+}
+
+bool FPicoAssetFileInterface::FindQueuedDownload(ppfID AssetId, int32& OutPriority, int32& OutIndex) const
+{
+    for (int32 Priority = 0; Priority < NumDownloadPriorities; ++Priority)
+    {
+        const int32 Index = QueuedDownloads[Priority].IndexOfByPredicate([AssetId](const FQueuedAssetDownload& Download)
+            {
+                return Download.AssetId == AssetId;
+            });
+        if (Index != INDEX_NONE)
+        {
+            OutPriority = Priority;
+            OutIndex = Index;
+            return true;
+        }
+    }
+    return false;
+}
+
+void FPicoAssetFileInterface::StartQueuedDownloads()
+{
+    for (int32 Priority = 0; Priority < NumDownloadPriorities; ++Priority)
+    {
+        while (QueuedDownloads[Priority].Num() > 0 && ActiveDownloads.Num() < MaxConcurrentDownloads)
+        {
+            FQueuedAssetDownload Download = MoveTemp(QueuedDownloads[Priority][0]);
+            QueuedDownloads[Priority].RemoveAt(0);
+            StartDownload(MoveTemp(Download));
+        }
+    }
+}
+
+bool FPicoAssetFileInterface::StartDownload(FQueuedAssetDownload&& Download)
+{
+#if PLATFORM_ANDROID
+    const ppfID AssetId = Download.AssetId;
+    ppfRequest RequestId = ppf_AssetFile_DownloadById(AssetId);
+    if (RequestId == 0)
+    {
+        const FString ErrorMessage = TEXT("ppf_AssetFile_DownloadById request failed");
+        UE_LOG(PicoAssetFile, Log, TEXT("QueueDownloadById return failed:%s"), *ErrorMessage);
+        for (const FAssetFileDownloadResult& Delegate : Download.Delegates)
+        {
+            Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+        }
+        return false;
+    }
+
+    FActiveAssetDownload& ActiveDownload = ActiveDownloads.Add(AssetId);
+    ActiveDownload.LastUpdateTime = FPlatformTime::Seconds();
+    ActiveDownload.Delegates = MoveTemp(Download.Delegates);
+    UE_LOG(PicoAssetFile, Log, TEXT("Started download of asset %llu, %d active, %d queued"), AssetId, GetNumActiveDownloads(), GetNumQueuedDownloads());
+    PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
+        [AssetId, this](ppfMessageHandle Message, bool bIsError)
+        {
+            // Delegates that joined while the request was in flight are answered too
+            FActiveAssetDownload* ActiveDownload = ActiveDownloads.Find(AssetId);
+            TArray<FAssetFileDownloadResult> Delegates;
+            if (ActiveDownload != nullptr)
+            {
+                Delegates = MoveTemp(ActiveDownload->Delegates);
+            }
+            if (bIsError)
+            {
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+                ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+                UE_LOG(PicoAssetFile, Log, TEXT("QueueDownloadById return failed:%s"), *ErrorMessage);
+                // The slot is released first, so a delegate that queues the asset again starts a new download
+                FinishDownload(AssetId);
+                this->DownloadByIdDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+                for (const FAssetFileDownloadResult& Delegate : Delegates)
+                {
+                    Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+                }
+            }
+            else
+            {
+                UE_LOG(PicoAssetFile, Log, TEXT("QueueDownloadById Successfully"));
+                UPico_AssetFileDownloadResult* Pico_AssetFileDownloadResult = NewObject<UPico_AssetFileDownloadResult>();
+                Pico_AssetFileDownloadResult->InitParams(ppf_Message_GetAssetFileDownloadResult(Message));
+                if (ActiveDownload != nullptr)
+                {
+                    ActiveDownload->Result.Reset(Pico_AssetFileDownloadResult);
+                }
+                this->DownloadByIdDelegate.ExecuteIfBound(false, FString(), Pico_AssetFileDownloadResult);
+                for (const FAssetFileDownloadResult& Delegate : Delegates)
+                {
+                    Delegate.ExecuteIfBound(false, FString(), Pico_AssetFileDownloadResult);
+                }
+            }
+        }));
+    return true;
+#endif
+    return false;
+}
+
+bool FPicoAssetFileInterface::TickStalledDownloads(float DeltaTime)
+{
+    // A stalled download keeps its slot, it is only reported so the caller can cancel it
+    const double Now = FPlatformTime::Seconds();
+    for (TPair<ppfID, FActiveAssetDownload>& ActiveDownload : ActiveDownloads)
+    {
+        if (!ActiveDownload.Value.bStallReported && Now - ActiveDownload.Value.LastUpdateTime > DownloadStallTimeout)
+        {
+            ActiveDownload.Value.bStallReported = true;
+            UE_LOG(PicoAssetFile, Warning, TEXT("Asset %llu sent no download update for %.0fs, it keeps its download slot until it completes or is cancelled"), ActiveDownload.Key, DownloadStallTimeout);
+        }
+    }
+    return true;
+}
+
+void FPicoAssetFileInterface::FinishDownload(ppfID AssetId)
+{
+    LastProgressBroadcastTimes.Remove(AssetId);
+    FActiveAssetDownload ActiveDownload;
+    if (!ActiveDownloads.RemoveAndCopyValue(AssetId, ActiveDownload))
+    {
+        return;
+    }
+    const FString ErrorMessage = TEXT("Download ended before its request completed");
+    for (const FAssetFileDownloadResult& Delegate : ActiveDownload.Delegates)
+    {
+        Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
+    }
+    StartQueuedDownloads();
+}
+
 bool FPicoAssetFileInterface::DownloadCancelById(FString AssetFileID, FAssetFileDownloadCancelResult InDownloadCancelByIDDelegate)
 {
     UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::DownloadCancelById"));
@@ -172,9 +430,9 @@ bool FPicoAssetFileInterface::DownloadCancelById(FString AssetFileID, FAssetFile
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DownloadCancelById return failed:%s"), *ErrorMessage);
                 this->DownloadCancelByIdDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -187,6 +445,10 @@ bool FPicoAssetFileInterface::DownloadCancelById(FString AssetFileID, FAssetFile
                 AssetFileDownloadCancelResult->InitParams(ppf_Message_GetAssetFileDownloadCancelResult(Message));
                 this->DownloadCancelByIdDelegate.ExecuteIfBound(false, FString(), AssetFileDownloadCancelResult);
                 InDownloadCancelByIDDelegate.ExecuteIfBound(false, FString(), AssetFileDownloadCancelResult);
+                if (AssetFileDownloadCancelResult->GetSuccess())
+                {
+                    FinishDownload(AssetFileDownloadCancelResult->GetppfAssetId());
+                }
             }
         }));
     return true;
@@ -204,9 +466,9 @@ bool FPicoAssetFileInterface::DownloadCancelByName(FString AssetFileName, FAsset
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("DownloadCancelByName return failed:%s"), *ErrorMessage);
                 this->DownloadCancelNameIdDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -219,6 +481,10 @@ bool FPicoAssetFileInterface::DownloadCancelByName(FString AssetFileName, FAsset
                 AssetFileDownloadCancelResult->InitParams(ppf_Message_GetAssetFileDownloadCancelResult(Message));
                 this->DownloadCancelNameIdDelegate.ExecuteIfBound(false, FString(), AssetFileDownloadCancelResult);
                 InDownloadCancelByNameDelegate.ExecuteIfBound(false, FString(), AssetFileDownloadCancelResult);
+                if (AssetFileDownloadCancelResult->GetSuccess())
+                {
+                    FinishDownload(AssetFileDownloadCancelResult->GetppfAssetId());
+                }
             }
         }));
     return true;
@@ -226,6 +492,117 @@ bool FPicoAssetFileInterface::DownloadCancelByName(FString AssetFileName, FAsset
     return false;
 }
 
+bool FPicoAssetFileInterface::RefreshAssetCatalog(FPicoAssetCatalogRefreshed InRefreshedDelegate)
+{
+    UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::RefreshAssetCatalog"));
+    if (bCatalogRefreshInFlight && FPlatformTime::Seconds() - CatalogPageRequestTime >= CatalogPageTimeOut)
+    {
+        FinishCatalogRefresh(true, TEXT("Request timed out"));
+    }
+    if (bCatalogRefreshInFlight)
+    {
+        CatalogRefreshWaiters.Add(InRefreshedDelegate);
+        return true;
+    }
+
+    RefreshedCatalogAssets.Reset();
+    if (!RequestCatalogPage(nullptr))
+    {
+        return false;
+    }
+    bCatalogRefreshInFlight = true;
+    CatalogRefreshWaiters.Add(InRefreshedDelegate);
+    return true;
+}
+
+bool FPicoAssetFileInterface::RequestCatalogPage(const char* NextPageParam)
+{
+#if PLATFORM_ANDROID
+    ppfRequest RequestId = NextPageParam ? ppf_AssetFile_GetNextAssetDetailsArrayPage(NextPageParam) : ppf_AssetFile_GetList();
+    if (RequestId == 0)
+    {
+        return false;
+    }
+    CatalogPageRequestTime = FPlatformTime::Seconds();
+    PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateRaw(this, &FPicoAssetFileInterface::OnCatalogPageReceived, ++CatalogPageSerial));
+    return true;
+#endif
+    return false;
+}
+
+void FPicoAssetFileInterface::OnCatalogPageReceived(ppfMessageHandle Message, bool bIsError, uint32 Serial)
+{
+#if PLATFORM_ANDROID
+    if (!bCatalogRefreshInFlight || Serial != CatalogPageSerial)
+    {
+        return;
+    }
+    if (bIsError)
+    {
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+        ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+        UE_LOG(PicoAssetFile, Log, TEXT("RefreshAssetCatalog return failed:%s"), *ErrorMessage);
+        FinishCatalogRefresh(true, ErrorMessage);
+        return;
+    }
+
+    ppfAssetDetailsArrayHandle DetailsArray = ppf_Message_GetAssetDetailsArray(Message);
+    const size_t Count = ppf_AssetDetailsArray_GetSize(DetailsArray);
+    int32 NumChanged = 0;
+    for (size_t Index = 0; Index < Count; ++Index)
+    {
+        ppfAssetDetailsHandle Details = ppf_AssetDetailsArray_GetElement(DetailsArray, Index);
+        const ppfID AssetId = ppf_AssetDetails_GetAssetId(Details);
+        RefreshedCatalogAssets.Add(AssetId);
+
+        // Unchanged assets skip converting the remaining strings
+        const FPicoAssetCatalogEntry* Existing = AssetCatalog.Find(AssetId);
+        if (Existing
+            && Existing->Version == ppf_AssetDetails_GetVersion(Details)
+            && Existing->DownloadStatus.Equals(UTF8_TO_TCHAR(ppf_AssetDetails_GetDownloadStatus(Details)), ESearchCase::CaseSensitive)
+            && Existing->IapStatus.Equals(UTF8_TO_TCHAR(ppf_AssetDetails_GetIapStatus(Details)), ESearchCase::CaseSensitive))
+        {
+            continue;
+        }
+        AssetCatalog.FindOrAdd(AssetId).InitParams(Details);
+        ++NumChanged;
+    }
+    UE_LOG(PicoAssetFile, Verbose, TEXT("Asset catalog page: %d assets, %d changed"), static_cast<int32>(Count), NumChanged);
+
+    if (ppf_AssetDetailsArray_HasNextPage(DetailsArray))
+    {
+        if (!RequestCatalogPage(ppf_AssetDetailsArray_GetNextPageParam(DetailsArray)))
+        {
+            FinishCatalogRefresh(true, TEXT("Requesting the next asset file list page failed"));
+        }
+        return;
+    }
+
+    for (auto It = AssetCatalog.CreateIterator(); It; ++It)
+    {
+        if (!RefreshedCatalogAssets.Contains(It.Key()))
+        {
+            It.RemoveCurrent();
+        }
+    }
+    FinishCatalogRefresh(false, FString());
+#endif
+}
+
+void FPicoAssetFileInterface::FinishCatalogRefresh(bool bIsError, const FString& ErrorMessage)
+{
+    bCatalogRefreshInFlight = false;
+    RefreshedCatalogAssets.Reset();
+    TArray<FPicoAssetCatalogRefreshed> Waiters = MoveTemp(CatalogRefreshWaiters);
+    CatalogRefreshWaiters.Reset();
+    for (const FPicoAssetCatalogRefreshed& Waiter : Waiters)
+    {
+        Waiter.ExecuteIfBound(bIsError, ErrorMessage);
+    }
+}
+
 bool FPicoAssetFileInterface::GetAssetFileList(FGetAssetFileList InGetAssetFileListDelegate)
 {
     UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::GetAssetFileList"));
@@ -236,9 +613,9 @@ bool FPicoAssetFileInterface::GetAssetFileList(FGetAssetFileList InGetAssetFileL
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("GetAssetFileList return failed:%s"), *ErrorMessage);
                 this->GetAssetFileListDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -268,9 +645,9 @@ bool FPicoAssetFileInterface::GetNextAssetDetailsArrayPage(UPico_AssetDetailsArr
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("GetNextAssetDetailsArrayPage return failed:%s"), *ErrorMessage);
                 this->GetNextAssetDetailsArrayPageDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -300,9 +677,9 @@ bool FPicoAssetFileInterface::GetAssetFileStatusById(FString AssetFileID, FGetAs
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("GetAssetFileStatusById return failed:%s"), *ErrorMessage);
                 this->GetAssetFileStatusByIdDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -332,9 +709,9 @@ bool FPicoAssetFileInterface::GetAssetFileStatusByName(FString AssetFileName, FG
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoAssetFile, Log, TEXT("GetAssetFileStatusByName return failed:%s"), *ErrorMessage);
                 this->GetAssetFileStatusByNameDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -356,16 +733,46 @@ bool FPicoAssetFileInterface::GetAssetFileStatusByName(FString AssetFileName, FG
 
 void FPicoAssetFileInterface::OnAssetFileDownloadUpdate(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("FPicoAssetFileInterface::OnAssetFileDownloadUpdate"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("FPicoAssetFileInterface::OnAssetFileDownloadUpdate"));
     if (bIsError)
     {
         UE_LOG(PicoAssetFile, Error, TEXT("AssetFileDownloadUpdate error!"));
     }
 
 #if PLATFORM_ANDROID
-    UPico_AssetFileDownloadUpdate* AssetFileDownloadUpdate = NewObject<UPico_AssetFileDownloadUpdate>();
-    AssetFileDownloadUpdate->InitParams(ppf_Message_GetAssetFileDownloadUpdate(Message));
-    AssetFileDownloadUpdateCallback.Broadcast(AssetFileDownloadUpdate);
+    ppfAssetFileDownloadUpdateHandle DownloadUpdate = ppf_Message_GetAssetFileDownloadUpdate(Message);
+    const ppfID AssetId = ppf_AssetFileDownloadUpdate_GetAssetId(DownloadUpdate);
+    const bool bCompleted = ppf_AssetFileDownloadUpdate_GetCompleteStatus(DownloadUpdate) != ppfAssetFileDownloadCompleteStatus_Downloading;
+    const double Now = FPlatformTime::Seconds();
+    if (FActiveAssetDownload* ActiveDownload = ActiveDownloads.Find(AssetId))
+    {
+        ActiveDownload->LastUpdateTime = Now;
+        ActiveDownload->bStallReported = false;
+    }
+
+    // Progress is broadcast at most once per interval per asset, completion always goes through
+    if (!bCompleted)
+    {
+        double& LastBroadcastTime = LastProgressBroadcastTimes.FindOrAdd(AssetId, 0.0);
+        if (Now - LastBroadcastTime < ProgressBroadcastInterval)
+        {
+            return;
+        }
+        LastBroadcastTime = Now;
+    }
+
+    if (AssetFileDownloadUpdateCallback.IsBound())
+    {
+        UPico_AssetFileDownloadUpdate* AssetFileDownloadUpdate = NewObject<UPico_AssetFileDownloadUpdate>();
+        AssetFileDownloadUpdate->InitParams(DownloadUpdate);
+        AssetFileDownloadUpdateCallback.Broadcast(AssetFileDownloadUpdate);
+    }
+
+    if (bCompleted)
+    {
+        UE_LOG(PicoAssetFile, Log, TEXT("Download of asset %llu completed"), AssetId);
+        FinishDownload(AssetId);
+    }
 #endif
 }
 
@@ -547,7 +954,7 @@ bool UOnlinePicoAssetFileFunction::GetAssetFileStatusByName(UObject* WorldContex
 
 void UPico_AssetFileDeleteResult::InitParams(ppfAssetFileDeleteResult* InppfAssetFileDeleteResultHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetFileDeleteResult::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetFileDeleteResult::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetFileDeleteResult_GetAssetId(InppfAssetFileDeleteResultHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -576,9 +983,29 @@ ppfID UPico_AssetFileDeleteResult::GetppfAssetId()
     return ppfAssetId;
 }
 
+void FPicoAssetCatalogEntry::InitParams(ppfAssetDetails* InppfAssetDetailsHandle)
+{
+#if PLATFORM_ANDROID
+    AssetId = ppf_AssetDetails_GetAssetId(InppfAssetDetailsHandle);
+    Version = ppf_AssetDetails_GetVersion(InppfAssetDetailsHandle);
+    AssetType = UTF8_TO_TCHAR(ppf_AssetDetails_GetAssetType(InppfAssetDetailsHandle));
+    DownloadStatus = UTF8_TO_TCHAR(ppf_AssetDetails_GetDownloadStatus(InppfAssetDetailsHandle));
+    FilePath = UTF8_TO_TCHAR(ppf_AssetDetails_GetFilepath(InppfAssetDetailsHandle));
+    Filename = UTF8_TO_TCHAR(ppf_AssetDetails_GetFilename(InppfAssetDetailsHandle));
+    IapStatus = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapStatus(InppfAssetDetailsHandle));
+    Metadata = UTF8_TO_TCHAR(ppf_AssetDetails_GetMetadata(InppfAssetDetailsHandle));
+    IapSku = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapSku(InppfAssetDetailsHandle));
+    IapName = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapName(InppfAssetDetailsHandle));
+    IapPrice = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapPrice(InppfAssetDetailsHandle));
+    IapCurrency = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapCurrency(InppfAssetDetailsHandle));
+    IapDescription = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapDescription(InppfAssetDetailsHandle));
+    IapIconUrl = UTF8_TO_TCHAR(ppf_AssetDetails_GetIapIcon(InppfAssetDetailsHandle));
+#endif
+}
+
 void UPico_AssetDetails::InitParams(ppfAssetDetails* InppfAssetDetailsHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetDetails::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetDetails::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetDetails_GetAssetId(InppfAssetDetailsHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -675,7 +1102,7 @@ ppfID UPico_AssetDetails::GetppfAssetId()
 
 void UPico_AssetFileDownloadResult::InitParams(ppfAssetFileDownloadResult* InppfAssetFileDownloadResultHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetFileDownloadResult::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetFileDownloadResult::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetFileDownloadResult_GetAssetId(InppfAssetFileDownloadResultHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -700,7 +1127,7 @@ ppfID UPico_AssetFileDownloadResult::GetppfAssetId()
 
 void UPico_AssetDetailsArray::InitParams(ppfAssetDetailsArray* InppfAssetDetailsArrayHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetDetailsArray::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetDetailsArray::InitParams"));
 #if PLATFORM_ANDROID
     Size = ppf_AssetDetailsArray_GetSize(InppfAssetDetailsArrayHandle);
     for (int32 i = 0; i < Size; i++)
@@ -743,7 +1170,7 @@ FString UPico_AssetDetailsArray::GetNextPageParam()
 
 void UPico_AssetFileDownloadCancelResult::InitParams(ppfAssetFileDownloadCancelResult* InppfAssetFileDownloadCancelResultHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetFileDownloadCancelResult::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetFileDownloadCancelResult::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetFileDownloadCancelResult_GetAssetId(InppfAssetFileDownloadCancelResultHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -774,7 +1201,7 @@ ppfID UPico_AssetFileDownloadCancelResult::GetppfAssetId()
 
 void UPico_AssetFileDownloadUpdate::InitParams(ppfAssetFileDownloadUpdate* InppfAssetFileDownloadUpdateHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetFileDownloadUpdate::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetFileDownloadUpdate::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetFileDownloadUpdate_GetAssetId(InppfAssetFileDownloadUpdateHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -823,7 +1250,7 @@ ppfID UPico_AssetFileDownloadUpdate::GetppfAssetId()
 
 void UPico_AssetStatus::InitParams(ppfAssetStatus* InppfAssetStatusHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetStatus::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetStatus::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetStatus_GetAssetId(InppfAssetStatusHandle);
     AssetId = uint64ToFString(ppfAssetId);
@@ -860,7 +1287,7 @@ ppfID UPico_AssetStatus::GetppfAssetId()
 
 void UPico_AssetFileDeleteForSafety::InitParams(ppfAssetFileDeleteForSafety* InppfAssetFileDeleteForSafetyHandle)
 {
-    UE_LOG(PicoAssetFile, Log, TEXT("UPico_AssetFileDeleteForSafety::InitParams"));
+    PICO_LOG_EVENT(PicoAssetFile, Verbose, TEXT("UPico_AssetFileDeleteForSafety::InitParams"));
 #if PLATFORM_ANDROID
     ppfAssetId = ppf_AssetFileDeleteForSafety_GetAssetId(InppfAssetFileDeleteForSafetyHandle);
     AssetId = uint64ToFString(ppfAssetId);
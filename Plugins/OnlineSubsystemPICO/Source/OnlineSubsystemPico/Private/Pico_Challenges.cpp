@@ -33,9 +33,9 @@ void FPicoChallengesInterface::OnChallengeInviteAcceptedOrLaunchAppNotification(
 	UE_LOG(PicoChallenges, Log, TEXT("FPicoChallengesInterface::OnChallengeInviteAcceptedOrLaunchAppNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoChallenges, Error, TEXT("OnChallengeInviteAcceptedOrLaunchAppNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		ChallengeInviteAcceptedOrLaunchAppNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, FString());
 	}
@@ -57,8 +57,8 @@ bool FPicoChallengesInterface::Get(const FString& ChallengeID, FChallengeGet InG
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("Get return failed:%s"), *ErrorMessage);
 				this->GetDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InGetDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -85,8 +85,8 @@ bool FPicoChallengesInterface::GetEntries(const FString& ChallengeID, int PageId
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("GetEntries return failed:%s"), *ErrorMessage);
 				this->GetEntriesDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -112,8 +112,8 @@ bool FPicoChallengesInterface::GetEntriesAfterRank(ppfID ChallengeID, int PageId
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("GetEntriesAfterRank return failed:%s"), *ErrorMessage);
 				this->GetEntriesAfterRankDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -151,8 +151,8 @@ bool FPicoChallengesInterface::GetEntriesByIds(const FString& ChallengeID, int P
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("GetEntriesByIds return failed:%s"), *ErrorMessage);
 				this->GetEntriesByIdsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -224,8 +224,8 @@ bool FPicoChallengesInterface::GetList(FPico_ChallengeOptions ChallengeOptions,
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("GetList return failed:%s"), *ErrorMessage);
 				this->GetListDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -252,8 +252,8 @@ bool FPicoChallengesInterface::Join(const FString& ChallengeID, FChallengeJoin I
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("Join return failed:%s"), *ErrorMessage);
 				this->JoinDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -280,8 +280,8 @@ bool FPicoChallengesInterface::Leave( const FString& ChallengeID, FChallengeLeav
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("Leave return failed:%s"), *ErrorMessage);
 				this->LeaveDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -319,8 +319,8 @@ bool FPicoChallengesInterface::Invite(const FString& ChallengeID, const TArray<F
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("Invite return failed:%s"), *ErrorMessage);
 				this->InviteDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -347,9 +347,9 @@ bool FPicoChallengesInterface::LaunchInvitableUserFlow(const FString& ChallengeI
 		{
 			if (bIsError)
 			{
-				const ppfErrorHandle Error = ppf_Message_GetError(Message);
-				const int ErrorCode = ppf_Error_GetCode(Error);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+				const ppfErrorHandle Error = PicoMessageGetError(Message);
+				const int ErrorCode = PicoErrorGetCode(Error);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 				UE_LOG(PicoChallenges, Log, TEXT("LaunchInvitableUserFlow return failed:%s"), *ErrorMessage);
 				this->LaunchInvitableUserFlowDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -29,9 +29,9 @@ bool FPicoCloudStorageInterface::StartNewBackup(FStartNewCloud_Backup InDelegate
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                int ErrorCode = ppf_Error_GetCode(Error);
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoCloudStorage, Log, TEXT("StartNewBackup return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 this->CloudStartNewBackupDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
                 InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
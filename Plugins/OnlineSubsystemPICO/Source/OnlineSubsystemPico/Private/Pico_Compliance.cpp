@@ -40,9 +40,9 @@ bool FPicoComplianceInterface::DetectSensitive(EDetectSensitiveScene DetectSensi
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                int ErrorCode = ppf_Error_GetCode(Error);
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoCompliance, Log, TEXT("DetectSensitive return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 this->DetectSensitiveDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
                 InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -30,9 +30,9 @@ bool FPicoHighlightInterface::CaptureScreen(FCaptureScreenResult InCaptureScreen
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("CaptureScreen return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InCaptureScreenResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
             }
@@ -59,9 +59,9 @@ bool FPicoHighlightInterface::ListMedia(const FString& SessionId, FListMediaResu
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("ListMedia return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InListMediaResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
             }
@@ -88,9 +88,9 @@ bool FPicoHighlightInterface::SaveMedia(const FString& JobId, const FString& Ses
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("SaveMedia return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InSaveMediaResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
             }
@@ -115,9 +115,9 @@ bool FPicoHighlightInterface::ShareMedia(const FString& JobId, const FString& Se
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("ShareMedia return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InShareMediaResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
             }
@@ -142,9 +142,9 @@ bool FPicoHighlightInterface::StartRecord(FStartRecordResult InStartRecordResult
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("StartRecord return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InStartRecordResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
             }
@@ -169,9 +169,9 @@ bool FPicoHighlightInterface::StopRecord(FStopRecordResult InStopRecordResultDel
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("StopRecord return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InStopRecordResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
             }
@@ -198,9 +198,9 @@ bool FPicoHighlightInterface::StartSession(FStartSessionResult InStartSessionRes
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoHighlight, Log, TEXT("StartSession return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 InStartSessionResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, FString());
             }
@@ -118,9 +118,9 @@ bool FPicoIAPInterface::ConsumePurchase(const FString& SKU, FConsumePurchaseDele
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("PicoConsumePurchase return failed:%s"), *ErrorMessage);
                 this->ConsumePurchaseDelegate.ExecuteIfBound(true, ErrorMessage);
@@ -167,9 +167,9 @@ bool FPicoIAPInterface::GetProductsBySKU(TArray<FString> ProductSKUs, int32 Coun
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("GetProductsBySKU return failed:%s"), *ErrorMessage);
                 this->GetProductsBySKUDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -196,9 +196,9 @@ bool FPicoIAPInterface::GetNextProductsArrayPage(UPico_ProductArray* InProductAr
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("GetNextProductsArrayPage return failed:%s"), *ErrorMessage);
                 this->GetNextProductArrayPageDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -225,9 +225,9 @@ bool FPicoIAPInterface::GetViewerPurchases(FGetViewerPurchasesDelegate InGetView
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("GetViewerPurchases return failed:%s"), *ErrorMessage);
                 this->GetViewerPurchasesDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -254,9 +254,9 @@ bool FPicoIAPInterface::GetNextPurchaseArrayPage(UPico_PurchaseArray* InPurchase
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("GetNextPurchaseArrayPage return failed:%s"), *ErrorMessage);
                 this->GetNextPurchaseArrayPageDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -283,9 +283,9 @@ bool FPicoIAPInterface::LaunchCheckoutFlow(const FString& SKU, const FString& Pr
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("LaunchCheckoutFlow return failed:%s"), *ErrorMessage);
                 this->LaunchCheckoutFlowDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -313,9 +313,9 @@ bool FPicoIAPInterface::LaunchCheckoutFlowV2(const FString& SKU, const FString&
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("LaunchCheckoutFlow_V2 return failed:%s"), *ErrorMessage);
                 this->LaunchCheckoutFlow_V2Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -346,9 +346,9 @@ bool FPicoIAPInterface::GetSubscriptionStatus(const FString& SKU, FGetSubscripti
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("GetSubscriptionStatus return failed:%s"), *ErrorMessage);
                 this->GetSubscriptionStatusDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -378,9 +378,9 @@ bool FPicoIAPInterface::LaunchCheckoutFlowV3(const FString& SKU, const FString&
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoIAP, Log, TEXT("LaunchCheckoutFlow_V3 return failed:%s"), *ErrorMessage);
                 this->LaunchCheckoutFlow_V3Delegate.ExecuteIfBound(true, ErrorMessage, nullptr);
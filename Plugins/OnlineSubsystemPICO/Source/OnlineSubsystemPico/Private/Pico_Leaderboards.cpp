@@ -15,7 +15,14 @@ DEFINE_LOG_CATEGORY(PicoLeaderboards);
 FPicoLeaderboardsInterface::FPicoLeaderboardsInterface(FOnlineSubsystemPico& InSubsystem) :
 	PicoSubsystem(InSubsystem)
 {
-	
+	if (GConfig)
+	{
+		float CacheTTL = DefaultCacheTTL;
+		GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("LeaderboardCacheTTLSeconds"), CacheTTL, GEngineIni);
+		DefaultCacheTTL = FMath::Max(CacheTTL, 0.f);
+		GConfig->GetInt(TEXT("OnlineSubsystemPico"), TEXT("MaxCachedLeaderboardPages"), MaxCachedPages, GEngineIni);
+		GConfig->GetBool(TEXT("OnlineSubsystemPico"), TEXT("bPrefetchLeaderboardPages"), bPrefetchNextPage, GEngineIni);
+	}
 }
 FPicoLeaderboardsInterface::~FPicoLeaderboardsInterface()
 {
@@ -32,9 +39,9 @@ bool FPicoLeaderboardsInterface::Get(const FString& LeaderboardName, FGet InGetD
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("Get return failed:%s"), *ErrorMessage);
 				this->GetDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -64,9 +71,9 @@ bool FPicoLeaderboardsInterface::GetEntries(const FString& LeaderboardName, int
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("GetEntries return failed:%s"), *ErrorMessage);
 				this->GetEntriesDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -84,6 +91,225 @@ bool FPicoLeaderboardsInterface::GetEntries(const FString& LeaderboardName, int
 	return true;
 }
 
+// ppf_Leaderboard_GetEntries, cached
+bool FPicoLeaderboardsInterface::GetEntriesCached(const FString& LeaderboardName, int PageIdx, int PageSize,
+                                                  ppfLeaderboardFilterType Filter, ppfLeaderboardStartAt StartAt,
+                                                  const FPicoLeaderboardPageDelegate& InPageDelegate, bool bForceRefresh)
+{
+	FPicoLeaderboardPageKey Key;
+	Key.LeaderboardName = LeaderboardName;
+	Key.PageIdx = PageIdx;
+	Key.PageSize = PageSize;
+	Key.Filter = Filter;
+	Key.StartAt = StartAt;
+
+	if (!bForceRefresh)
+	{
+		if (const FPicoLeaderboardPage* CachedPage = FindFreshPage(Key))
+		{
+			UE_LOG(PicoLeaderboards, Verbose, TEXT("GetEntriesCached %s page %d served from cache"), *LeaderboardName, PageIdx);
+			InPageDelegate.ExecuteIfBound(false, FString(), *CachedPage);
+			return true;
+		}
+	}
+
+	FailStaleInFlightPages();
+	if (FInFlightLeaderboardPage* InFlight = FindCurrentInFlightPage(Key))
+	{
+		UE_LOG(PicoLeaderboards, Verbose, TEXT("GetEntriesCached %s page %d joined in-flight request"), *LeaderboardName, PageIdx);
+		InFlight->Waiters.Add(InPageDelegate);
+		return true;
+	}
+
+	UE_LOG(PicoLeaderboards, Log, TEXT("FPicoLeaderboardsInterface::GetEntriesCached %s page %d"), *LeaderboardName, PageIdx);
+	FInFlightLeaderboardPage* InFlight = RequestPage(Key);
+	if (InFlight == nullptr)
+	{
+		UE_LOG(PicoLeaderboards, Log, TEXT("GetEntriesCached %s page %d send request failed"), *LeaderboardName, PageIdx);
+		return false;
+	}
+	InFlight->Waiters.Add(InPageDelegate);
+	return true;
+}
+
+void FPicoLeaderboardsInterface::SetLeaderboardCacheTTL(const FString& LeaderboardName, double Seconds)
+{
+	LeaderboardCacheTTLs.Add(LeaderboardName, FMath::Max(Seconds, 0.0));
+	if (Seconds <= 0.0)
+	{
+		InvalidateLeaderboardCache(LeaderboardName);
+	}
+}
+
+void FPicoLeaderboardsInterface::InvalidateLeaderboardCache(const FString& LeaderboardName)
+{
+	if (LeaderboardName.IsEmpty())
+	{
+		CachedPages.Reset();
+		++GlobalGeneration;
+		return;
+	}
+	++LeaderboardGenerations.FindOrAdd(LeaderboardName);
+	for (auto It = CachedPages.CreateIterator(); It; ++It)
+	{
+		if (It.Key().LeaderboardName == LeaderboardName)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+double FPicoLeaderboardsInterface::GetCacheTTL(const FString& LeaderboardName) const
+{
+	const double* TTL = LeaderboardCacheTTLs.Find(LeaderboardName);
+	return TTL ? *TTL : DefaultCacheTTL;
+}
+
+uint32 FPicoLeaderboardsInterface::GetGeneration(const FString& LeaderboardName) const
+{
+	const uint32* Generation = LeaderboardGenerations.Find(LeaderboardName);
+	return GlobalGeneration + (Generation ? *Generation : 0);
+}
+
+const FPicoLeaderboardPage* FPicoLeaderboardsInterface::FindFreshPage(const FPicoLeaderboardPageKey& Key) const
+{
+	const FPicoLeaderboardPage* Page = CachedPages.Find(Key);
+	if (Page && FPlatformTime::Seconds() - Page->FetchTime < GetCacheTTL(Key.LeaderboardName))
+	{
+		return Page;
+	}
+	return nullptr;
+}
+
+FPicoLeaderboardsInterface::FInFlightLeaderboardPage* FPicoLeaderboardsInterface::FindCurrentInFlightPage(const FPicoLeaderboardPageKey& Key)
+{
+	const uint32 Generation = GetGeneration(Key.LeaderboardName);
+	return InFlightPages.FindByPredicate([&Key, Generation](const FInFlightLeaderboardPage& InFlight)
+	{
+		return InFlight.Generation == Generation && InFlight.Key == Key;
+	});
+}
+
+FPicoLeaderboardsInterface::FInFlightLeaderboardPage* FPicoLeaderboardsInterface::RequestPage(const FPicoLeaderboardPageKey& Key)
+{
+	ppfRequest RequestId = ppf_Leaderboard_GetEntries(TCHAR_TO_UTF8(*Key.LeaderboardName), Key.PageSize, Key.PageIdx, Key.Filter, Key.StartAt);
+	if (RequestId == 0)
+	{
+		return nullptr;
+	}
+	const uint32 Serial = ++NextRequestSerial;
+	PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
+		[Serial, this](ppfMessageHandle Message, bool bIsError)
+		{
+			OnPageReceived(Serial, Message, bIsError);
+		}));
+
+	FInFlightLeaderboardPage& InFlight = InFlightPages.AddDefaulted_GetRef();
+	InFlight.Key = Key;
+	InFlight.Serial = Serial;
+	InFlight.StartTime = FPlatformTime::Seconds();
+	InFlight.Generation = GetGeneration(Key.LeaderboardName);
+	return &InFlight;
+}
+
+void FPicoLeaderboardsInterface::OnPageReceived(uint32 Serial, ppfMessageHandle Message, bool bIsError)
+{
+	const int32 InFlightIndex = InFlightPages.IndexOfByPredicate([Serial](const FInFlightLeaderboardPage& InFlight)
+	{
+		return InFlight.Serial == Serial;
+	});
+	if (InFlightIndex == INDEX_NONE)
+	{
+		return;
+	}
+	if (bIsError)
+	{
+		auto Error = PicoMessageGetError(Message);
+		FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+		FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+		ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+		FailInFlightPage(InFlightIndex, ErrorMessage);
+		return;
+	}
+	FInFlightLeaderboardPage InFlight = MoveTemp(InFlightPages[InFlightIndex]);
+	InFlightPages.RemoveAtSwap(InFlightIndex, 1, false);
+	const FPicoLeaderboardPageKey& Key = InFlight.Key;
+
+	FPicoLeaderboardPage Page;
+
+	Page.InitParams(ppf_Message_GetLeaderboardEntryArray(Message));
+	const bool bHasNextPage = Page.bHasNextPage;
+	for (const FPicoLeaderboardPageDelegate& Waiter : InFlight.Waiters)
+	{
+		Waiter.ExecuteIfBound(false, FString(), Page);
+	}
+
+	if (InFlight.Generation != GetGeneration(Key.LeaderboardName) || GetCacheTTL(Key.LeaderboardName) <= 0.0)
+	{
+		return;
+	}
+	AddCachedPage(Key, MoveTemp(Page));
+
+	if (bPrefetchNextPage && bHasNextPage)
+	{
+		FPicoLeaderboardPageKey NextKey = Key;
+		++NextKey.PageIdx;
+		if (!FindCurrentInFlightPage(NextKey) && !FindFreshPage(NextKey))
+		{
+			UE_LOG(PicoLeaderboards, Verbose, TEXT("GetEntriesCached prefetching %s page %d"), *NextKey.LeaderboardName, NextKey.PageIdx);
+			RequestPage(NextKey);
+		}
+	}
+}
+
+void FPicoLeaderboardsInterface::FailInFlightPage(int32 InFlightIndex, const FString& ErrorMessage)
+{
+	FInFlightLeaderboardPage InFlight = MoveTemp(InFlightPages[InFlightIndex]);
+	InFlightPages.RemoveAtSwap(InFlightIndex, 1, false);
+	UE_LOG(PicoLeaderboards, Log, TEXT("GetEntriesCached return failed:%s"), *ErrorMessage);
+	const FPicoLeaderboardPage Page;
+	for (const FPicoLeaderboardPageDelegate& Waiter : InFlight.Waiters)
+	{
+		Waiter.ExecuteIfBound(true, ErrorMessage, Page);
+	}
+}
+
+void FPicoLeaderboardsInterface::FailStaleInFlightPages()
+{
+	const double Now = FPlatformTime::Seconds();
+	for (int32 InFlightIndex = InFlightPages.Num() - 1; InFlightIndex >= 0; --InFlightIndex)
+	{
+		// A waiter may start new requests, which only append past the index being walked
+		if (InFlightIndex < InFlightPages.Num() && Now - InFlightPages[InFlightIndex].StartTime >= InFlightPageTimeOut)
+		{
+			FailInFlightPage(InFlightIndex, TEXT("Request timed out"));
+		}
+	}
+}
+
+void FPicoLeaderboardsInterface::AddCachedPage(const FPicoLeaderboardPageKey& Key, FPicoLeaderboardPage&& Page)
+{
+	if (!CachedPages.Contains(Key) && CachedPages.Num() >= FMath::Max(MaxCachedPages, 1))
+	{
+		// Evict the oldest page; the cache is small so a linear scan is cheaper than keeping an LRU list
+		const FPicoLeaderboardPageKey* OldestKey = nullptr;
+		double OldestTime = TNumericLimits<double>::Max();
+		for (const TPair<FPicoLeaderboardPageKey, FPicoLeaderboardPage>& Cached : CachedPages)
+		{
+			if (Cached.Value.FetchTime < OldestTime)
+			{
+				OldestTime = Cached.Value.FetchTime;
+				OldestKey = &Cached.Key;
+			}
+		}
+		if (OldestKey)
+		{
+			CachedPages.Remove(FPicoLeaderboardPageKey(*OldestKey));
+		}
+	}
+	CachedPages.Add(Key, MoveTemp(Page));
+}
+
 // ppf_Leaderboard_GetEntriesAfterRank
 bool FPicoLeaderboardsInterface::GetEntriesAfterRank(const FString& LeaderboardName, int PageIdx, int PageSize, 
                                                      unsigned long long AfterRank,
@@ -96,9 +322,9 @@ bool FPicoLeaderboardsInterface::GetEntriesAfterRank(const FString& LeaderboardN
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("GetEntriesAfterRank return failed:%s"), *ErrorMessage);
 				this->GetEntriesAfterRankDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -140,9 +366,9 @@ bool FPicoLeaderboardsInterface::GetEntriesByIds(const FString& LeaderboardName,
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("GetEntriesByIds return failed:%s"), *ErrorMessage);
 				this->GetEntriesByIdsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -175,13 +401,13 @@ bool FPicoLeaderboardsInterface::WriteEntry(const FString& LeaderboardName, cons
 	
 	ppfRequest RequestId = ppf_Leaderboard_WriteEntry(TCHAR_TO_UTF8(*LeaderboardName), Score, UTF8Data.GetData(), Size, ForceUpdate);
 	PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
-		[InWriteEntryDelegate, this](ppfMessageHandle Message, bool bIsError)
+		[InWriteEntryDelegate, LeaderboardName, this](ppfMessageHandle Message, bool bIsError)
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("WriteEntry return failed:%s"), *ErrorMessage);
 				this->WriteEntryDelegate.ExecuteIfBound(true, ErrorMessage, false);
@@ -191,6 +417,10 @@ bool FPicoLeaderboardsInterface::WriteEntry(const FString& LeaderboardName, cons
 			{
                 UE_LOG(PicoLeaderboards, Log, TEXT("WriteEntry Successfully"));
                 bool Result = ppf_LeaderboardUpdateStatus_GetDidUpdate(ppf_Message_GetLeaderboardUpdateStatus(Message));
+                if (Result)
+                {
+                    InvalidateLeaderboardCache(LeaderboardName);
+                }
                 this->WriteEntryDelegate.ExecuteIfBound(false, FString(), Result);
                 InWriteEntryDelegate.ExecuteIfBound(false, FString(), Result);
 			}
@@ -215,13 +445,13 @@ bool FPicoLeaderboardsInterface::WriteEntryWithSupplementaryMetric(const FString
 	
 	ppfRequest RequestId = ppf_Leaderboard_WriteEntryWithSupplementaryMetric(TCHAR_TO_UTF8(*LeaderboardName), Score, SupplementaryMetric, UTF8Data.GetData(), Size, ForceUpdate);
 	PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
-		[InWriteEntryWithSupplementaryMetricDelegate, this](ppfMessageHandle Message, bool bIsError)
+		[InWriteEntryWithSupplementaryMetricDelegate, LeaderboardName, this](ppfMessageHandle Message, bool bIsError)
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+				auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
 				UE_LOG(PicoLeaderboards, Log, TEXT("WriteEntryWithSupplementaryMetric return failed:%s"), *ErrorMessage);
 				this->WriteEntryWithSupplementaryMetricDelegate.ExecuteIfBound(true, ErrorMessage, false);
@@ -231,6 +461,10 @@ bool FPicoLeaderboardsInterface::WriteEntryWithSupplementaryMetric(const FString
 			{
                 UE_LOG(PicoLeaderboards, Log, TEXT("WriteEntryWithSupplementaryMetric Successfully"));
                 bool Result = ppf_LeaderboardUpdateStatus_GetDidUpdate(ppf_Message_GetLeaderboardUpdateStatus(Message));
+                if (Result)
+                {
+                    InvalidateLeaderboardCache(LeaderboardName);
+                }
                 this->WriteEntryWithSupplementaryMetricDelegate.ExecuteIfBound(false, FString(), Result);
                 InWriteEntryWithSupplementaryMetricDelegate.ExecuteIfBound(false, FString(), Result);
 			}
@@ -359,6 +593,46 @@ void UOnlinePicoLeaderboardsFunction::WriteEntryWithSupplementaryMetric(
 }
 
 
+// FPicoLeaderboardEntryData
+void FPicoLeaderboardEntryData::InitParams(ppfLeaderboardEntryHandle ppfLeaderboardEntryHandle)
+{
+	ID = ppf_LeaderboardEntry_GetID(ppfLeaderboardEntryHandle);
+	Rank = ppf_LeaderboardEntry_GetRank(ppfLeaderboardEntryHandle);
+	Score = ppf_LeaderboardEntry_GetScore(ppfLeaderboardEntryHandle);
+	DisplayScore = UTF8_TO_TCHAR(ppf_LeaderboardEntry_GetDisplayScore(ppfLeaderboardEntryHandle));
+	Timestamp = ppf_LeaderboardEntry_GetTimestamp(ppfLeaderboardEntryHandle);
+	ppfUserHandle UserHandle = ppf_LeaderboardEntry_GetUser(ppfLeaderboardEntryHandle);
+	if (UserHandle != nullptr)
+	{
+		UserID = UTF8_TO_TCHAR(ppf_User_GetID(UserHandle));
+		UserDisplayName = UTF8_TO_TCHAR(ppf_User_GetDisplayName(UserHandle));
+	}
+	const int32 ExtraDataLength = ppf_LeaderboardEntry_GetExtraDataLength(ppfLeaderboardEntryHandle);
+	ExtraData.SetNumUninitialized(ExtraDataLength);
+	if (ExtraDataLength > 0)
+	{
+		FMemory::Memcpy(ExtraData.GetData(), ppf_LeaderboardEntry_GetExtraData(ppfLeaderboardEntryHandle), ExtraDataLength);
+	}
+	ppfSupplementaryMetricHandle SupplementaryMetricHandle = ppf_LeaderboardEntry_GetSupplementaryMetric(ppfLeaderboardEntryHandle);
+	bHasSupplementaryMetric = SupplementaryMetricHandle != nullptr;
+	SupplementaryMetric = bHasSupplementaryMetric ? ppf_SupplementaryMetric_GetMetric(SupplementaryMetricHandle) : 0;
+}
+
+// FPicoLeaderboardPage
+void FPicoLeaderboardPage::InitParams(ppfLeaderboardEntryArrayHandle InppfLeaderboardEntryArrayHandle)
+{
+	const int32 Size = ppf_LeaderboardEntryArray_GetSize(InppfLeaderboardEntryArrayHandle);
+	Entries.SetNum(Size);
+	for (int32 i = 0; i < Size; i++)
+	{
+		Entries[i].InitParams(ppf_LeaderboardEntryArray_GetElement(InppfLeaderboardEntryArrayHandle, i));
+	}
+	bHasNextPage = ppf_LeaderboardEntryArray_HasNextPage(InppfLeaderboardEntryArrayHandle);
+	bHasPreviousPage = ppf_LeaderboardEntryArray_HasPreviousPage(InppfLeaderboardEntryArrayHandle);
+	TotalCount = ppf_LeaderboardEntryArray_GetTotalCount(InppfLeaderboardEntryArrayHandle);
+	FetchTime = FPlatformTime::Seconds();
+}
+
 // UPico_LeaderboardEntry
 void UPico_LeaderboardEntry::InitParams(ppfLeaderboardEntryHandle ppfLeaderboardEntryHandle)
 {
@@ -39,9 +39,9 @@ void FPicoMatchmakingInterface::OnMatchmakingMatchFoundNotification(ppfMessageHa
 	UE_LOG(PicoMatchmaking, Log, TEXT("FPicoMatchmakingInterface::OnMatchmakingMatchFoundNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoMatchmaking, Error, TEXT("MatchmakingMatchFoundNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		MatchmakingMatchFoundNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, nullptr);
 	}
@@ -58,9 +58,9 @@ void FPicoMatchmakingInterface::OnMatchmakingCancelNotification(ppfMessageHandle
 	UE_LOG(PicoMatchmaking, Log, TEXT("FPicoMatchmakingInterface::OnMatchmakingCancelNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoMatchmaking, Error, TEXT("MatchmakingCancelNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		MatchmakingCancelNotify.Broadcast(bIsError, ErrorCode, ErrorMessage);
 	}
@@ -91,9 +91,9 @@ bool FPicoMatchmakingInterface::ReportResultsInsecure(const FString& RoomID, con
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("ReportResultsInsecure return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->ReportResultsInsecureDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -119,9 +119,9 @@ bool FPicoMatchmakingInterface::GetStats(const FString& Pool, uint32 MaxLevel, E
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("GetStats return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetStatsDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -147,9 +147,9 @@ bool FPicoMatchmakingInterface::Browse2(const FString& Pool, FPicoMatchmakingOpt
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("Browse2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->Browse2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -174,9 +174,9 @@ bool FPicoMatchmakingInterface::Browse2CustomPage(const FString& Pool, FPicoMatc
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("Browse2CustomPage return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->Browse2CustomPageDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -202,9 +202,9 @@ bool FPicoMatchmakingInterface::Cancel(FMatchmakingCancel InDelegate)
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("Cancel return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->CancelDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -228,9 +228,9 @@ bool FPicoMatchmakingInterface::CreateAndEnqueueRoom2(const FString& Pool, FPico
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("CreateAndEnqueueRoom2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->CreateAndEnqueueRoom2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -256,9 +256,9 @@ bool FPicoMatchmakingInterface::Enqueue2(const FString& Pool, FPicoMatchmakingOp
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("Enqueue2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->Enqueue2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -284,9 +284,9 @@ bool FPicoMatchmakingInterface::GetAdminSnapshot(FMatchmakingGetAdminSnapshot In
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("GetAdminSnapshot return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetAdminSnapshotDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -312,9 +312,9 @@ bool FPicoMatchmakingInterface::StartMatch(const FString& RoomID, FMatchmakingSt
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoMatchmaking, Log, TEXT("StartMatch return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->StartMatchDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				InDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -4,51 +4,391 @@
 #include "Pico_Networking.h"
 #include "OnlineSubsystemUtils.h"
 #include "OnlineSubsystemPico.h"
+#include "PicoLog.h"
 
 DEFINE_LOG_CATEGORY(PicoNetworking);
+
+namespace
+{
+    /** The ppf packet size limit */
+    constexpr int32 MaxPacketSize = 512;
+
+    /**
+     * Prefix of a ppf packet carrying coalesced packets, followed by the sender's coalescing token, then every packet
+     * as a little-endian uint16 size and its bytes. Only peers that accepted the sender's offer look for it.
+     */
+    constexpr uint8 CoalescedPacketMagic[] = { 0xC0, 0x5A };
+    constexpr int32 CoalescedMagicSize = UE_ARRAY_COUNT(CoalescedPacketMagic);
+    constexpr int32 CoalescedHeaderSize = CoalescedMagicSize + 4;
+    constexpr int32 CoalescedSizeFieldSize = 2;
+
+    /** Control message layout: Magic (8) | Control (1) | Token (4) */
+    constexpr uint8 CoalescingControlMagic[8] = { 'P', 'P', 'F', 'C', 'O', 'A', 'L', 'S' };
+    constexpr int32 CoalescingControlSize = UE_ARRAY_COUNT(CoalescingControlMagic) + 1 + 4;
+
+    enum class ECoalescingControl : uint8
+    {
+        /** The sender coalesces packets if the receiver splits them, carries the token of its coalesced packets */
+        Offer = 1,
+        Accept = 2,
+    };
+
+    void WriteUInt32(uint8* Dest, uint32 Value)
+    {
+        for (int32 ByteIndex = 0; ByteIndex < 4; ++ByteIndex)
+        {
+            Dest[ByteIndex] = static_cast<uint8>(Value >> (8 * ByteIndex));
+        }
+    }
+
+    uint32 ReadUInt32(const uint8* Src)
+    {
+        return Src[0] | (Src[1] << 8) | (Src[2] << 16) | (static_cast<uint32>(Src[3]) << 24);
+    }
+
+    void WriteCoalescedHeader(uint8* Dest, uint32 Token)
+    {
+        FMemory::Memcpy(Dest, CoalescedPacketMagic, CoalescedMagicSize);
+        WriteUInt32(Dest + CoalescedMagicSize, Token);
+    }
+
+    bool HasCoalescedHeader(const uint8* Bytes, int32 Size, uint32 Token)
+    {
+        return Size >= CoalescedHeaderSize
+            && FMemory::Memcmp(Bytes, CoalescedPacketMagic, CoalescedMagicSize) == 0
+            && ReadUInt32(Bytes + CoalescedMagicSize) == Token;
+    }
+
+    /** Whether the packet sizes add up to exactly the size of the ppf packet */
+    bool IsValidCoalescedPacket(const uint8* Bytes, int32 Size)
+    {
+        int32 Offset = CoalescedHeaderSize;
+        while (Offset + CoalescedSizeFieldSize <= Size)
+        {
+            const int32 PacketSize = Bytes[Offset] | (Bytes[Offset + 1] << 8);
+            Offset += CoalescedSizeFieldSize + PacketSize;
+        }
+        return Offset == Size;
+    }
+
+    bool ReadCoalescingControl(const uint8* Bytes, int32 Size, ECoalescingControl& OutControl, uint32& OutToken)
+    {
+        if (Size != CoalescingControlSize || FMemory::Memcmp(Bytes, CoalescingControlMagic, sizeof(CoalescingControlMagic)) != 0)
+        {
+            return false;
+        }
+        const uint8 Control = Bytes[sizeof(CoalescingControlMagic)];
+        if (Control != static_cast<uint8>(ECoalescingControl::Offer) && Control != static_cast<uint8>(ECoalescingControl::Accept))
+        {
+            return false;
+        }
+        OutControl = static_cast<ECoalescingControl>(Control);
+        OutToken = ReadUInt32(Bytes + sizeof(CoalescingControlMagic) + 1);
+        return true;
+    }
+
+    bool SendCoalescingControl(const ANSICHAR* UserIdUTF8, ECoalescingControl Control, uint32 Token)
+    {
+        uint8 Message[CoalescingControlSize];
+        FMemory::Memcpy(Message, CoalescingControlMagic, sizeof(CoalescingControlMagic));
+        Message[sizeof(CoalescingControlMagic)] = static_cast<uint8>(Control);
+        WriteUInt32(Message + sizeof(CoalescingControlMagic) + 1, Token);
+        return ppf_Net_SendPacket2(UserIdUTF8, sizeof(Message), Message, true);
+    }
+}
+
 FPicoNetworkingInterface::FPicoNetworkingInterface(FOnlineSubsystemPico& InSubsystem) :
     PicoSubsystem(InSubsystem)
 {
-
+    if (GConfig)
+    {
+        float CoalescingWindow = 0.f;
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("NetworkingSendCoalescingSeconds"), CoalescingWindow, GEngineIni);
+        SendCoalescingWindow = FMath::Max(CoalescingWindow, 0.f);
+    }
+    // Tells the coalesced packets of this run apart from plain packets that start with the same bytes
+    CoalescingToken = static_cast<uint32>(FGuid::NewGuid().A) | 1u;
+    OnRoomUpdateNotificationHandle =
+        PicoSubsystem.GetOrAddNotify(ppfMessageType_Notification_Room_RoomUpdate)
+        .AddRaw(this, &FPicoNetworkingInterface::OnRoomUpdateNotification);
+    OnRoomLeaveNotificationHandle =
+        PicoSubsystem.GetOrAddNotify(ppfMessageType_Room_Leave)
+        .AddRaw(this, &FPicoNetworkingInterface::OnRoomLeaveNotification);
 }
 
 FPicoNetworkingInterface::~FPicoNetworkingInterface()
 {
+    if (OnRoomUpdateNotificationHandle.IsValid())
+    {
+        OnRoomUpdateNotificationHandle.Reset();
+    }
+    if (OnRoomLeaveNotificationHandle.IsValid())
+    {
+        OnRoomLeaveNotificationHandle.Reset();
+    }
+}
+
+int32 FPicoNetworkingInterface::FindOrAddPeer(const FString& UserId)
+{
+    if (const int32* PeerIndex = PeerIndexByUserId.Find(UserId))
+    {
+        return *PeerIndex;
+    }
+
+    const int32 PeerIndex = Peers.Add(FPeer());
+    FPeer& Peer = Peers[PeerIndex];
+    Peer.UserId = UserId;
+    FTCHARToUTF8 UserIdUTF8(*UserId);
+    Peer.UserIdUTF8.Append(UserIdUTF8.Get(), UserIdUTF8.Length() + 1);
+    PeerIndexByUserId.Add(UserId, PeerIndex);
+
+    // Only ids that read back to the same number are keyed by it, others are looked up by their string
+    const ppfID SenderId = FCStringAnsi::Strtoui64(Peer.UserIdUTF8.GetData(), nullptr, 10);
+    if (SenderId != 0 && UserId == FString::Printf(TEXT("%llu"), SenderId))
+    {
+        Peer.SenderId = SenderId;
+        PeerIndexBySenderId.Add(SenderId, PeerIndex);
+    }
+    return PeerIndex;
+}
+
+int32 FPicoNetworkingInterface::FindOrAddPeer(const ANSICHAR* UserIdUTF8)
+{
+    // ppf user ids are numbers, looking them up as such avoids converting every sender id
+    if (const int32* PeerIndex = PeerIndexBySenderId.Find(FCStringAnsi::Strtoui64(UserIdUTF8, nullptr, 10)))
+    {
+        if (FCStringAnsi::Strcmp(Peers[*PeerIndex].UserIdUTF8.GetData(), UserIdUTF8) == 0)
+        {
+            return *PeerIndex;
+        }
+    }
+    return FindOrAddPeer(FString(UTF8_TO_TCHAR(UserIdUTF8)));
+}
+
+void FPicoNetworkingInterface::RemovePeer(const FString& UserId)
+{
+    if (const int32* PeerIndex = PeerIndexByUserId.Find(UserId))
+    {
+        RemovePeerAt(*PeerIndex);
+    }
+}
+
+void FPicoNetworkingInterface::RemovePeerAt(int32 PeerIndex)
+{
+    FPeer& Peer = Peers[PeerIndex];
+    FlushPendingSend(Peer);
+    PeerIndexByUserId.Remove(Peer.UserId);
+    if (Peer.SenderId != 0)
+    {
+        PeerIndexBySenderId.Remove(Peer.SenderId);
+    }
+    Peers.RemoveAt(PeerIndex);
+}
+
+void FPicoNetworkingInterface::OnRoomUpdateNotification(ppfMessageHandle Message, bool bIsError)
+{
+    ppfRoomHandle Room = bIsError ? nullptr : ppf_Message_GetRoom(Message);
+    ppfUserArrayHandle Users = Room != nullptr ? ppf_Room_GetUsers(Room) : nullptr;
+    if (Users == nullptr)
+    {
+        return;
+    }
+    TSet<FString> RoomUserIds;
+    const int32 NumUsers = static_cast<int32>(ppf_UserArray_GetSize(Users));
+    for (int32 UserIndex = 0; UserIndex < NumUsers; ++UserIndex)
+    {
+        RoomUserIds.Add(UTF8_TO_TCHAR(ppf_User_GetID(ppf_UserArray_GetElement(Users, UserIndex))));
+    }
+    for (auto It = Peers.CreateIterator(); It; ++It)
+    {
+        if (!RoomUserIds.Contains(It->UserId))
+        {
+            RemovePeerAt(It.GetIndex());
+        }
+    }
+}
+
+void FPicoNetworkingInterface::OnRoomLeaveNotification(ppfMessageHandle Message, bool bIsError)
+{
+    if (bIsError)
+    {
+        return;
+    }
+    for (auto It = Peers.CreateIterator(); It; ++It)
+    {
+        RemovePeerAt(It.GetIndex());
+    }
+}
+
+const FString& FPicoNetworkingInterface::GetPeerUserId(int32 PeerIndex) const
+{
+    static const FString InvalidPeerUserId;
+    return Peers.IsValidIndex(PeerIndex) ? Peers[PeerIndex].UserId : InvalidPeerUserId;
+}
 
+bool FPicoNetworkingInterface::SendPacket(const FString& UserId, const TArray<uint8>& BinaryArray)
+{
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("FPicoNetworkingInterface::SendPacket"), BinaryArray.Num());
+    return SendPacketView(UserId, BinaryArray, false);
 }
 
+bool FPicoNetworkingInterface::SendPacket(const FString& UserId, const TArray<uint8>& BinaryArray, bool bReliable)
+{
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("FPicoNetworkingInterface::SendPacketReliable"), BinaryArray.Num(), bReliable);
+    return SendPacketView(UserId, BinaryArray, bReliable);
+}
 
-bool FPicoNetworkingInterface::SendPacket(const FString& UserId, TArray<uint8> BinaryArray)
+bool FPicoNetworkingInterface::SendPacketToCurrentRoom(const TArray<uint8>& BinaryArray)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("FPicoNetworkingInterface::SendPacket"));
-    return ppf_Net_SendPacket(TCHAR_TO_UTF8(*UserId), BinaryArray.Num(), BinaryArray.GetData());
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("FPicoNetworkingInterface::SendPacketToCurrentRoom"), BinaryArray.Num());
+    return SendPacketViewToCurrentRoom(BinaryArray, false);
 }
 
-bool FPicoNetworkingInterface::SendPacket(const FString& UserId, TArray<uint8> BinaryArray, bool bReliable)
+bool FPicoNetworkingInterface::SendPacketToCurrentRoom(const TArray<uint8>& BinaryArray, bool bReliable)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("FPicoNetworkingInterface::SendPacketReliable"));
-    return ppf_Net_SendPacket2(TCHAR_TO_UTF8(*UserId), BinaryArray.Num(), BinaryArray.GetData(), bReliable);
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("FPicoNetworkingInterface::SendPacketToCurrentRoomReliable"), BinaryArray.Num(), bReliable);
+    return SendPacketViewToCurrentRoom(BinaryArray, bReliable);
+}
+
+bool FPicoNetworkingInterface::SendPacketView(const FString& UserId, TArrayView<const uint8> Data, bool bReliable)
+{
+    FPeer& Peer = Peers[FindOrAddPeer(UserId)];
+
+    // Packets are only coalesced for peers that agreed to split them, the others keep getting plain packets
+    if (SendCoalescingWindow > 0.0 && Peer.SendCoalescing == ECoalescingState::None)
+    {
+        if (SendCoalescingControl(Peer.UserIdUTF8.GetData(), ECoalescingControl::Offer, CoalescingToken))
+        {
+            Peer.SendCoalescing = ECoalescingState::Offered;
+        }
+    }
+
+    const int32 FramedSize = CoalescedSizeFieldSize + Data.Num();
+    const bool bFitsCoalesced = CoalescedHeaderSize + FramedSize <= MaxPacketSize;
+    if (bReliable || SendCoalescingWindow <= 0.0 || Peer.SendCoalescing != ECoalescingState::Accepted || !bFitsCoalesced)
+    {
+        // Keep the order of packets to this peer
+        FlushPendingSend(Peer);
+        TArrayView<const uint8> SendData = Data;
+        // A plain packet the peer would take for a coalesced one is sent as a coalesced packet of its own
+        TArray<uint8, TInlineAllocator<MaxPacketSize>> Escaped;
+        if (Peer.SendCoalescing == ECoalescingState::Accepted && HasCoalescedHeader(Data.GetData(), Data.Num(), CoalescingToken))
+        {
+            if (!bFitsCoalesced)
+            {
+                PICO_LOG_RATE_LIMITED(PicoNetworking, Warning, 1.0, TEXT("Cannot send %d bytes to %s, they start like a coalesced packet"), Data.Num(), *Peer.UserId);
+                return false;
+            }
+            Escaped.AddUninitialized(CoalescedHeaderSize);
+            WriteCoalescedHeader(Escaped.GetData(), CoalescingToken);
+            Escaped.Add(static_cast<uint8>(Data.Num() & 0xFF));
+            Escaped.Add(static_cast<uint8>(Data.Num() >> 8));
+            Escaped.Append(Data.GetData(), Data.Num());
+            SendData = Escaped;
+        }
+        const bool bSent = bReliable
+            ? ppf_Net_SendPacket2(Peer.UserIdUTF8.GetData(), SendData.Num(), SendData.GetData(), true)
+            : ppf_Net_SendPacket(Peer.UserIdUTF8.GetData(), SendData.Num(), SendData.GetData());
+        if (bSent)
+        {
+            Peer.Stats.PacketsSent++;
+            Peer.Stats.BytesSent += Data.Num();
+        }
+        return bSent;
+    }
+
+    if (Peer.PendingSend.Num() + FramedSize > MaxPacketSize)
+    {
+        FlushPendingSend(Peer);
+    }
+    if (Peer.PendingSend.Num() == 0)
+    {
+        Peer.PendingSend.AddUninitialized(CoalescedHeaderSize);
+        WriteCoalescedHeader(Peer.PendingSend.GetData(), CoalescingToken);
+        Peer.PendingSendTime = FPlatformTime::Seconds();
+    }
+    Peer.PendingSend.Add(static_cast<uint8>(Data.Num() & 0xFF));
+    Peer.PendingSend.Add(static_cast<uint8>(Data.Num() >> 8));
+    Peer.PendingSend.Append(Data.GetData(), Data.Num());
+    Peer.PendingSendPackets++;
+    Peer.PendingSendBytes += Data.Num();
+    return true;
+}
+
+bool FPicoNetworkingInterface::SendPacketViewToCurrentRoom(TArrayView<const uint8> Data, bool bReliable)
+{
+    const bool bSent = bReliable
+        ? ppf_Net_SendPacketToCurrentRoom2(Data.Num(), Data.GetData(), true)
+        : ppf_Net_SendPacketToCurrentRoom(Data.Num(), Data.GetData());
+    if (bSent)
+    {
+        RoomStats.PacketsSent++;
+        RoomStats.BytesSent += Data.Num();
+    }
+    return bSent;
+}
+
+bool FPicoNetworkingInterface::FlushPendingSend(FPeer& Peer)
+{
+    if (Peer.PendingSend.Num() == 0)
+    {
+        return true;
+    }
+
+    const bool bSent = ppf_Net_SendPacket(Peer.UserIdUTF8.GetData(), Peer.PendingSend.Num(), Peer.PendingSend.GetData());
+    if (bSent)
+    {
+        Peer.Stats.PacketsSent += Peer.PendingSendPackets;
+        Peer.Stats.BytesSent += Peer.PendingSendBytes;
+        if (Peer.PendingSendPackets > 1)
+        {
+            Peer.Stats.CoalescedSends++;
+        }
+    }
+    else
+    {
+        PICO_LOG_RATE_LIMITED(PicoNetworking, Warning, 1.0, TEXT("Sending %d coalesced bytes to %s failed"), Peer.PendingSend.Num(), *Peer.UserId);
+    }
+    Peer.PendingSend.Reset();
+    Peer.PendingSendPackets = 0;
+    Peer.PendingSendBytes = 0;
+    return bSent;
 }
 
-bool FPicoNetworkingInterface::SendPacketToCurrentRoom(TArray<uint8> BinaryArray)
+void FPicoNetworkingInterface::FlushCoalescedPackets(bool bForce)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("FPicoNetworkingInterface::SendPacketToCurrentRoom"));
-    return ppf_Net_SendPacketToCurrentRoom(BinaryArray.Num(), BinaryArray.GetData());
+    const double Now = FPlatformTime::Seconds();
+    for (FPeer& Peer : Peers)
+    {
+        if (Peer.PendingSend.Num() > 0 && (bForce || Now - Peer.PendingSendTime >= SendCoalescingWindow))
+        {
+            FlushPendingSend(Peer);
+        }
+    }
 }
 
-bool FPicoNetworkingInterface::SendPacketToCurrentRoom(TArray<uint8> BinaryArray, bool bReliable)
+void FPicoNetworkingInterface::SetSendCoalescingWindow(float Seconds)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("FPicoNetworkingInterface::SendPacketToCurrentRoomReliable"));
-    return ppf_Net_SendPacketToCurrentRoom2(BinaryArray.Num(), BinaryArray.GetData(), bReliable);
+    SendCoalescingWindow = FMath::Max(Seconds, 0.f);
+    if (SendCoalescingWindow <= 0.0)
+    {
+        FlushCoalescedPackets(true);
+    }
 }
 
 bool FPicoNetworkingInterface::ReadPacket(TArray<uint8>& OutBinaries, FString& OutSendId)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("FPicoNetworkingInterface::ReadPacket"));
-    auto Packet = ppf_Net_ReadPacket();
-    if (Packet)
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("FPicoNetworkingInterface::ReadPacket"));
+    while (auto Packet = ppf_Net_ReadPacket())
     {
-        OutBinaries.Empty();
+        // Coalescing offers are not accepted here, this does not split coalesced packets
+        const ANSICHAR* SenderID = ppf_Packet_GetSenderID(Packet);
+        if (HandleCoalescingControl(SenderID, static_cast<const uint8*>(ppf_Packet_GetBytes(Packet)), static_cast<int32>(ppf_Packet_GetSize(Packet)), false))
+        {
+            ppf_Packet_Free(Packet);
+            continue;
+        }
+        OutBinaries.Reset();
 
         int32 Num = ppf_Packet_GetSize(Packet);
         const uint8* Datas = (const uint8*)ppf_Packet_GetBytes(Packet);
@@ -60,9 +400,112 @@ bool FPicoNetworkingInterface::ReadPacket(TArray<uint8>& OutBinaries, FString& O
     return false;
 }
 
-bool UOnlinePicoNetworkingFunction::SendPacket(UObject* WorldContextObject, const FString& UserId, TArray<uint8> BinaryArray, bool bReliable)
+int32 FPicoNetworkingInterface::ReadPackets(FPicoPacketBatch& OutBatch, int32 MaxPackets)
+{
+    OutBatch.Reset();
+    int32 NumRead = 0;
+    while (MaxPackets <= 0 || NumRead < MaxPackets)
+    {
+        auto Packet = ppf_Net_ReadPacket();
+        if (!Packet)
+        {
+            break;
+        }
+        ++NumRead;
+
+        const ANSICHAR* SenderID = ppf_Packet_GetSenderID(Packet);
+        const int32 Size = static_cast<int32>(ppf_Packet_GetSize(Packet));
+        const uint8* Bytes = static_cast<const uint8*>(ppf_Packet_GetBytes(Packet));
+        if (HandleCoalescingControl(SenderID, Bytes, Size, true))
+        {
+            ppf_Packet_Free(Packet);
+            continue;
+        }
+
+        const int32 PeerIndex = FindOrAddPeer(SenderID ? SenderID : "");
+        const FPeer& Peer = Peers[PeerIndex];
+        if (Peer.bReceivesCoalesced && HasCoalescedHeader(Bytes, Size, Peer.ReceiveCoalescingToken))
+        {
+            if (!IsValidCoalescedPacket(Bytes, Size))
+            {
+                PICO_LOG_RATE_LIMITED(PicoNetworking, Warning, 1.0, TEXT("Dropped a malformed coalesced packet from %s"), *Peer.UserId);
+                ppf_Packet_Free(Packet);
+                continue;
+            }
+
+            int32 Offset = CoalescedHeaderSize;
+            while (Offset < Size)
+            {
+                const int32 PacketSize = Bytes[Offset] | (Bytes[Offset + 1] << 8);
+                Offset += CoalescedSizeFieldSize;
+                AddReceivedPacket(OutBatch, PeerIndex, Bytes + Offset, PacketSize);
+                Offset += PacketSize;
+            }
+        }
+        else
+        {
+            AddReceivedPacket(OutBatch, PeerIndex, Bytes, Size);
+        }
+        ppf_Packet_Free(Packet);
+    }
+    return OutBatch.Packets.Num();
+}
+
+bool FPicoNetworkingInterface::HandleCoalescingControl(const ANSICHAR* SenderID, const uint8* Bytes, int32 Size, bool bCanSplit)
+{
+    ECoalescingControl Control;
+    uint32 Token = 0;
+    if (!ReadCoalescingControl(Bytes, Size, Control, Token))
+    {
+        return false;
+    }
+    FPeer& Peer = Peers[FindOrAddPeer(SenderID ? SenderID : "")];
+    if (Control == ECoalescingControl::Offer)
+    {
+        if (bCanSplit && SendCoalescingControl(Peer.UserIdUTF8.GetData(), ECoalescingControl::Accept, Token))
+        {
+            Peer.bReceivesCoalesced = true;
+            Peer.ReceiveCoalescingToken = Token;
+        }
+    }
+    else if (Peer.SendCoalescing == ECoalescingState::Offered && Token == CoalescingToken)
+    {
+        Peer.SendCoalescing = ECoalescingState::Accepted;
+    }
+    return true;
+}
+
+void FPicoNetworkingInterface::AddReceivedPacket(FPicoPacketBatch& OutBatch, int32 PeerIndex, const uint8* Bytes, int32 Size)
+{
+    FPicoReceivedPacket& Received = OutBatch.Packets.AddDefaulted_GetRef();
+    Received.PeerIndex = PeerIndex;
+    Received.Offset = OutBatch.Data.Num();
+    Received.Size = Size;
+    OutBatch.Data.Append(Bytes, Size);
+
+    FPicoPeerPacketStats& Stats = Peers[PeerIndex].Stats;
+    Stats.PacketsReceived++;
+    Stats.BytesReceived += Size;
+}
+
+const FPicoPeerPacketStats* FPicoNetworkingInterface::FindPeerPacketStats(const FString& UserId) const
+{
+    const int32* PeerIndex = PeerIndexByUserId.Find(UserId);
+    return PeerIndex ? &Peers[*PeerIndex].Stats : nullptr;
+}
+
+void FPicoNetworkingInterface::ResetPacketStats()
+{
+    for (FPeer& Peer : Peers)
+    {
+        Peer.Stats = FPicoPeerPacketStats();
+    }
+    RoomStats = FPicoPeerPacketStats();
+}
+
+bool UOnlinePicoNetworkingFunction::SendPacket(UObject* WorldContextObject, const FString& UserId, const TArray<uint8>& BinaryArray, bool bReliable)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("UOnlinePicoNetworkingFunction::SendPacket"));
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("UOnlinePicoNetworkingFunction::SendPacket"), BinaryArray.Num(), bReliable);
     FOnlineSubsystemPico* Subsystem = static_cast<FOnlineSubsystemPico*>(Online::GetSubsystem(GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull), PICO_SUBSYSTEM));
     if (Subsystem && Subsystem->GetPicoNetworkingInterface())
     {
@@ -71,9 +514,9 @@ bool UOnlinePicoNetworkingFunction::SendPacket(UObject* WorldContextObject, cons
     return false;
 }
 
-bool UOnlinePicoNetworkingFunction::SendPacketToCurrentRoom(UObject* WorldContextObject, TArray<uint8> BinaryArray, bool bReliable)
+bool UOnlinePicoNetworkingFunction::SendPacketToCurrentRoom(UObject* WorldContextObject, const TArray<uint8>& BinaryArray, bool bReliable)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("UOnlinePicoNetworkingFunction::SendPacketToCurrentRoom"));
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("UOnlinePicoNetworkingFunction::SendPacketToCurrentRoom"), BinaryArray.Num(), bReliable);
     FOnlineSubsystemPico* Subsystem = static_cast<FOnlineSubsystemPico*>(Online::GetSubsystem(GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull), PICO_SUBSYSTEM));
     if (Subsystem && Subsystem->GetPicoNetworkingInterface())
     {
@@ -84,7 +527,7 @@ bool UOnlinePicoNetworkingFunction::SendPacketToCurrentRoom(UObject* WorldContex
 
 bool UOnlinePicoNetworkingFunction::ReadPacket(UObject* WorldContextObject, TArray<uint8>& OutBinaries, FString& SendUserID)
 {
-    UE_LOG(PicoNetworking, Log, TEXT("UOnlinePicoNetworkingFunction::ReadPacket"));
+    PICO_LOG_EVENT(PicoNetworking, Verbose, TEXT("UOnlinePicoNetworkingFunction::ReadPacket"));
     FOnlineSubsystemPico* Subsystem = static_cast<FOnlineSubsystemPico*>(Online::GetSubsystem(GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull), PICO_SUBSYSTEM));
     if (Subsystem && Subsystem->GetPicoNetworkingInterface())
     {
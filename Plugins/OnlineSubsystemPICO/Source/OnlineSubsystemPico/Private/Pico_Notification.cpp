@@ -58,9 +58,9 @@ bool FPicoNotificationInterface::GetRoomInviteNotifications(int PageIdx, int Pag
 		{
 			if (bIsError)
 			{
-				const ppfErrorHandle Error = ppf_Message_GetError(Message);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				const int ErrorCode = ppf_Error_GetCode(Error);
+				const ppfErrorHandle Error = PicoMessageGetError(Message);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				const int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoNotification, Log, TEXT("GetRoomInviteNotifications return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->RoomInviteNotificationsDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnRoomInviteNotificationsCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -87,9 +87,9 @@ bool FPicoNotificationInterface::MarkAsRead(const FString& NotificationID, FNoti
 		{
 			if (bIsError)
 			{
-				const ppfErrorHandle Error = ppf_Message_GetError(Message);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				const int ErrorCode = ppf_Error_GetCode(Error);
+				const ppfErrorHandle Error = PicoMessageGetError(Message);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				const int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoNotification, Log, TEXT("MarkAsRead return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->MarkAsReadDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				OnMarkAsReadCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -344,9 +344,9 @@ void FPicoRoomInterface::OnRoomUpdateNotification(ppfMessageHandle Message, bool
 	UE_LOG(PicoRoom, Log, TEXT("FPicoRoomInterface::OnRoomUpdateNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoRoom, Error, TEXT("RoomUpdateNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		RoomUpdateNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, nullptr);
 	}
@@ -364,9 +364,9 @@ void FPicoRoomInterface::OnRoomUpdateOwnerNotification(ppfMessageHandle Message,
 	UE_LOG(PicoRoom, Log, TEXT("FPicoRoomInterface::OnRoomUpdateOwnerNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoRoom, Error, TEXT("RoomUpdateOwnerNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		RoomUpdateOwnerNotify.Broadcast(bIsError, ErrorCode, ErrorMessage);
 	}
@@ -382,9 +382,9 @@ void FPicoRoomInterface::OnRoomJoinNotification(ppfMessageHandle Message, bool b
 	UE_LOG(PicoRoom, Log, TEXT("FPicoRoomInterface::OnRoomJoinNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoRoom, Error, TEXT("RoomJoinNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		RoomJoinNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, nullptr);
 	}
@@ -402,9 +402,9 @@ void FPicoRoomInterface::OnRoomLeaveNotification(ppfMessageHandle Message, bool
 	UE_LOG(PicoRoom, Log, TEXT("FPicoRoomInterface::OnRoomLeaveNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoRoom, Error, TEXT("RoomLeaveNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		RoomUpdateNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, nullptr);
 	}
@@ -422,9 +422,9 @@ void FPicoRoomInterface::OnRoomInviteAcceptedNotification(ppfMessageHandle Messa
 	UE_LOG(PicoRoom, Log, TEXT("FPicoRoomInterface::OnRoomInviteAcceptedNotification"));
 	if (bIsError)
 	{
-		const ppfErrorHandle Error = ppf_Message_GetError(Message);
-		const int ErrorCode = ppf_Error_GetCode(Error);
-		const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+		const ppfErrorHandle Error = PicoMessageGetError(Message);
+		const int ErrorCode = PicoErrorGetCode(Error);
+		const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
 		UE_LOG(PicoRoom, Error, TEXT("RoomInviteAcceptedNotification error! ErrorCode: %d, ErrorMessage: %s"), ErrorCode, *ErrorMessage);
 		RoomInviteAcceptedNotify.Broadcast(bIsError, ErrorCode, ErrorMessage, FString());
 	}
@@ -472,9 +472,9 @@ bool FPicoRoomInterface::LaunchInvitableUserFlow(const FString& RoomID, FRoomLau
 		{
 			if (bIsError)
 			{
-				const ppfErrorHandle Error = ppf_Message_GetError(Message);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				const int ErrorCode = ppf_Error_GetCode(Error);
+				const ppfErrorHandle Error = PicoMessageGetError(Message);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				const int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("LaunchInvitableUserFlow return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->LaunchInvitableUserFlowDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				OnLaunchInvitableUserFlowCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -508,9 +508,9 @@ bool FPicoRoomInterface::UpdateDataStore(const FString& RoomID, const TMap<FStri
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-            	int ErrorCode = ppf_Error_GetCode(Error);
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+            	int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoRoom, Log, TEXT("UpdateDataStore return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 this->UpdateDataStoreDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
                 OnUpdateDataStoreCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -535,9 +535,9 @@ bool FPicoRoomInterface::CreateAndJoinPrivate2(ERoomJoinPolicy JoinPolicy, uint3
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("CreateAndJoinPrivate2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->CreateAndJoinPrivate2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnCreateAndJoinPrivate2Callback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -562,9 +562,9 @@ bool FPicoRoomInterface::Get(const FString& RoomID, FRoomGet OnGetCallback)
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("Get return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -589,9 +589,9 @@ bool FPicoRoomInterface::GetCurrent(FRoomGetCurrent OnGetCurrentCallback)
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("GetCurrent return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetCurrentDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetCurrentCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -616,9 +616,9 @@ bool FPicoRoomInterface::GetCurrentForUser(const FString& UserId, FRoomGetCurren
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("GetCurrentForUser return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetCurrentForUserDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetCurrentForUserCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -643,9 +643,9 @@ bool FPicoRoomInterface::GetInvitableUsers2(FPicoRoomOptions RoomOptions, FRoomG
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("GetInvitableUsers2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetInvitableUsers2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetInvitableUsers2Callback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -670,9 +670,9 @@ bool FPicoRoomInterface::GetModeratedRooms(int PageIndex, int PageSize, FRoomGet
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("GetModeratedRooms return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetModeratedRoomsDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetModeratedRoomsCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -697,9 +697,9 @@ bool FPicoRoomInterface::InviteUser(const FString& RoomID, const FString& Token,
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("InviteUser return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->InviteUserDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnInviteUserCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -724,9 +724,9 @@ bool FPicoRoomInterface::Join2(const FString& RoomID, FPicoRoomOptions RoomOptio
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("Join2 return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->Join2Delegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnJoin2Callback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -751,9 +751,9 @@ bool FPicoRoomInterface::KickUser(const FString& RoomID, const FString& UserID,
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("KickUser return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->KickUserDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnKickUserCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -778,9 +778,9 @@ bool FPicoRoomInterface::Leave(const FString& RoomID, FRoomLeave OnLeaveCallback
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("Leave return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->LeaveDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnLeaveCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -804,9 +804,9 @@ bool FPicoRoomInterface::SetDescription(const FString& RoomID, const FString& De
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("SetDescription return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->SetDescriptionDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnSetDescriptionCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -830,9 +830,9 @@ bool FPicoRoomInterface::UpdateMembershipLockStatus(const FString& RoomID, ERoom
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("UpdateMembershipLockStatus return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->UpdateMembershipLockStatusDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnUpdateMembershipLockStatusCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -856,9 +856,9 @@ bool FPicoRoomInterface::UpdateOwner(const FString& RoomID, const FString& UserI
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("UpdateOwner return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->UpdateOwnerDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage);
 				OnUpdateOwnerCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage);
@@ -883,9 +883,9 @@ bool FPicoRoomInterface::UpdatePrivateRoomJoinPolicy(const FString& RoomID, ERoo
 		{
 			if (bIsError)
 			{
-				auto Error = ppf_Message_GetError(Message);
-				FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				int ErrorCode = ppf_Error_GetCode(Error);
+				auto Error = PicoMessageGetError(Message);
+				FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("UpdatePrivateRoomJoinPolicy return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->UpdatePrivateRoomJoinPolicyDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnUpdatePrivateRoomJoinPolicyCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -910,9 +910,9 @@ bool FPicoRoomInterface::GetNamedRooms(int PageIndex, int PageSize, FRoomGetName
 		{
 			if (bIsError)
 			{
-				const auto Error = ppf_Message_GetError(Message);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				const int ErrorCode = ppf_Error_GetCode(Error);
+				const auto Error = PicoMessageGetError(Message);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				const int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("GetNamedRooms return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->GetNamedRoomsDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnGetNamedRoomsCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -937,9 +937,9 @@ bool FPicoRoomInterface::JoinOrCreateNamedRoom(ERoomJoinPolicy JoinPolicy, bool
 		{
 			if (bIsError)
 			{
-				const auto Error = ppf_Message_GetError(Message);
-				const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-				const int ErrorCode = ppf_Error_GetCode(Error);
+				const auto Error = PicoMessageGetError(Message);
+				const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+				const int ErrorCode = PicoErrorGetCode(Error);
 				UE_LOG(PicoRoom, Log, TEXT("JoinOrCreateNamedRoom return failed: %d, %s"), ErrorCode, *ErrorMessage);
 				this->JoinOrCreateNamedRoomDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
 				OnRoomJoinOrCreateNamedRoomCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -31,8 +31,8 @@ bool FPicoSportInterface::GetDailySummary(int64 BeginTime, int64 EndTime, FGetDa
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
                 UE_LOG(PicoSport, Log, TEXT("GetDailySummary return failed:%s"), *ErrorMessage);
                 this->GetDailySummaryDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
                 InGetDailySummaryDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -61,8 +61,8 @@ bool FPicoSportInterface::GetSummary(int64 BeginTime, int64 EndTime, FGetSummary
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
                 UE_LOG(PicoSport, Log, TEXT("GetSummary return failed:%s"), *ErrorMessage);
                 this->GetSummaryDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
                 InGetSummaryDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -91,8 +91,8 @@ bool FPicoSportInterface::GetSportUserInfo(FGetSportUserInfo InGetSportUserInfoD
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
                 UE_LOG(PicoSport, Log, TEXT("GetSportUserInfo return failed:%s"), *ErrorMessage);
                 this->GetSportUserInfoDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
                 InGetSportUserInfoDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -265,6 +265,40 @@ void UPico_User::InitParams(ppfUser* ppfUserHandle)
 
 }
 
+void UPico_User::InitParams(const FPicoUserProfile& Profile)
+{
+    DisplayName = Profile.DisplayName;
+    ImageUrl = Profile.ImageUrl;
+    ID = Profile.ID;
+    InviteToken = Profile.InviteToken;
+    SmallImageUrl = Profile.SmallImageUrl;
+    PresencePackage = Profile.PresencePackage;
+    if (Profile.PresenceStatus == ppfUserPresenceStatus_OffLine)
+    {
+        UserPresenceStatus = EUserPresenceStatus::OffLine;
+    }
+    else if (Profile.PresenceStatus == ppfUserPresenceStatus_OnLine)
+    {
+        UserPresenceStatus = EUserPresenceStatus::OnLine;
+    }
+    if (Profile.Gender == ppfGender_Female)
+    {
+        UserGender = EUserGender::Female;
+    }
+    else if (Profile.Gender == ppfGender_Male)
+    {
+        UserGender = EUserGender::Male;
+    }
+    Presence = Profile.Presence;
+    PresenceDeeplinkMessage = Profile.PresenceDeeplinkMessage;
+    PresenceDestinationApiName = Profile.PresenceDestinationApiName;
+    PresenceLobbySessionId = Profile.PresenceLobbySessionId;
+    PresenceMatchSessionId = Profile.PresenceMatchSessionId;
+    PresenceExtra = Profile.PresenceExtra;
+    StoreRegion = Profile.StoreRegion;
+    PresenceIsJoinable = Profile.bPresenceIsJoinable;
+}
+
 FString UPico_User::GetDisplayName()
 {
     return DisplayName;
@@ -364,6 +398,25 @@ void UPico_UserArray::InitParams(ppfUserArray* InppfUserArrayHandle)
     }
 }
 
+void UPico_UserArray::InitParams(ppfUserArray* InppfUserArrayHandle, const TArray<FPicoUserProfile>& Profiles)
+{
+    Size = Profiles.Num();
+    UserArray.Reserve(Size);
+    for (const FPicoUserProfile& Profile : Profiles)
+    {
+        UPico_User* ThisElement = NewObject<UPico_User>();
+        ThisElement->InitParams(Profile);
+        UserArray.Add(ThisElement);
+    }
+    bHasNextPage = ppf_UserArray_HasNextPage(InppfUserArrayHandle);
+
+    NextPageParam = FString();
+    if (bHasNextPage)
+    {
+        NextPageParam = ppf_UserArray_GetNextPageParam(InppfUserArrayHandle);
+    }
+}
+
 UPico_User* UPico_UserArray::GetElement(int32 Index)
 {
     if (UserArray.IsValidIndex(Index))
@@ -451,15 +504,345 @@ bool UPico_UserAndRoomArray::HasNextPage()
     return bHasNextPage;
 }
 
+// FPicoUserProfile
+void FPicoUserProfile::InitParams(ppfUserHandle ppfUserHandle)
+{
+    ID = UTF8_TO_TCHAR(ppf_User_GetID(ppfUserHandle));
+    DisplayName = UTF8_TO_TCHAR(ppf_User_GetDisplayName(ppfUserHandle));
+    ImageUrl = UTF8_TO_TCHAR(ppf_User_GetImageUrl(ppfUserHandle));
+    SmallImageUrl = UTF8_TO_TCHAR(ppf_User_GetSmallImageUrl(ppfUserHandle));
+    const char* Token = ppf_User_GetInviteToken(ppfUserHandle);
+    InviteToken = Token != nullptr ? UTF8_TO_TCHAR(Token) : FString();
+    PresencePackage = UTF8_TO_TCHAR(ppf_User_GetPresencePackage(ppfUserHandle));
+    PresenceStatus = ppf_User_GetPresenceStatus(ppfUserHandle);
+    Gender = ppf_User_GetGender(ppfUserHandle);
+    Presence = UTF8_TO_TCHAR(ppf_User_GetPresence(ppfUserHandle));
+    PresenceDeeplinkMessage = UTF8_TO_TCHAR(ppf_User_GetPresenceDeeplinkMessage(ppfUserHandle));
+    PresenceDestinationApiName = UTF8_TO_TCHAR(ppf_User_GetPresenceDestinationApiName(ppfUserHandle));
+    PresenceLobbySessionId = UTF8_TO_TCHAR(ppf_User_GetPresenceLobbySessionId(ppfUserHandle));
+    PresenceMatchSessionId = UTF8_TO_TCHAR(ppf_User_GetPresenceMatchSessionId(ppfUserHandle));
+    PresenceExtra = UTF8_TO_TCHAR(ppf_User_GetPresenceExtra(ppfUserHandle));
+    StoreRegion = UTF8_TO_TCHAR(ppf_User_GetStoreRegion(ppfUserHandle));
+#if PLATFORM_ANDROID
+    bPresenceIsJoinable = ppf_User_GetPresenceIsJoinable(ppfUserHandle);
+#endif
+    FetchTime = FPlatformTime::Seconds();
+}
+
+void FPicoUserProfile::InitArray(ppfUserArrayHandle InppfUserArrayHandle, TArray<FPicoUserProfile>& OutProfiles)
+{
+    const int32 Size = ppf_UserArray_GetSize(InppfUserArrayHandle);
+    OutProfiles.SetNum(Size);
+    for (int32 i = 0; i < Size; i++)
+    {
+        OutProfiles[i].InitParams(ppf_UserArray_GetElement(InppfUserArrayHandle, i));
+    }
+}
+
 FPicoUserInterface::FPicoUserInterface(FOnlineSubsystemPico& InSubsystem) :
     PicoSubsystem(InSubsystem)
 {
+    if (GConfig)
+    {
+        float CacheTTL = ProfileCacheTTL;
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("UserProfileCacheTTLSeconds"), CacheTTL, GEngineIni);
+        ProfileCacheTTL = FMath::Max(CacheTTL, 0.f);
+        GConfig->GetInt(TEXT("OnlineSubsystemPico"), TEXT("MaxCachedUserProfiles"), MaxCachedProfiles, GEngineIni);
+        float InFlightTimeOut = InFlightProfileTimeOut;
+        GConfig->GetFloat(TEXT("OnlineSubsystemPico"), TEXT("UserProfileRequestTimeOutSeconds"), InFlightTimeOut, GEngineIni);
+        InFlightProfileTimeOut = FMath::Max(InFlightTimeOut, 1.f);
+    }
+    // Room updates mean the members' profiles may have changed, their cached copies are dropped
+    OnRoomUpdateNotificationHandle =
+        PicoSubsystem.GetOrAddNotify(ppfMessageType_Notification_Room_RoomUpdate)
+        .AddRaw(this, &FPicoUserInterface::OnRoomUpdateNotification);
 
+    InFlightTimeOutTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateRaw(this, &FPicoUserInterface::TickInFlightTimeOuts), 1.f);
 }
 
 FPicoUserInterface::~FPicoUserInterface()
 {
+    if (OnRoomUpdateNotificationHandle.IsValid())
+    {
+        OnRoomUpdateNotificationHandle.Reset();
+    }
+
+    if (InFlightTimeOutTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(InFlightTimeOutTickerHandle);
+        InFlightTimeOutTickerHandle.Reset();
+    }
+}
+
+bool FPicoUserInterface::GetUserProfile(const FString& UserId, const FPicoUserProfileDelegate& InProfileDelegate, bool bForceRefresh)
+{
+    if (!bForceRefresh)
+    {
+        if (const FPicoUserProfile* CachedProfile = FindFreshProfile(UserId))
+        {
+            ++ProfileCacheStats.Hits;
+            InProfileDelegate.ExecuteIfBound(false, FString(), *CachedProfile);
+            return true;
+        }
+    }
+    ++ProfileCacheStats.Misses;
+
+    if (FInFlightUserProfile* InFlight = InFlightProfiles.Find(UserId))
+    {
+        ++ProfileCacheStats.Merged;
+        InFlight->Waiters.Add(InProfileDelegate);
+        return true;
+    }
+
+    UE_LOG(PicoUser, Log, TEXT("FPicoUserInterface::GetUserProfile"));
+    ppfRequest RequestId = ppf_User_Get(TCHAR_TO_UTF8(*UserId));
+    if (RequestId == 0)
+    {
+        ++ProfileCacheStats.Failures;
+        return false;
+    }
+    ++ProfileCacheStats.Requests;
+    FInFlightUserProfile& InFlight = InFlightProfiles.Add(UserId);
+    InFlight.RequestId = RequestId;
+    InFlight.StartTime = FPlatformTime::Seconds();
+    InFlight.Waiters.Add(InProfileDelegate);
+    PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
+        [UserId, RequestId, this](ppfMessageHandle Message, bool bIsError)
+        {
+            OnUserProfileReceived(UserId, RequestId, Message, bIsError);
+        }));
+    return true;
+}
+
+void FPicoUserInterface::GetUserProfiles(const TArray<FString>& UserIds, const FPicoUserProfilesDelegate& InProfilesDelegate)
+{
+    struct FUserProfilesBatch
+    {
+        TArray<FPicoUserProfile> Profiles;
+        TArray<FString> FailedUserIds;
+        int32 Remaining = 0;
+        FPicoUserProfilesDelegate Delegate;
+
+        void CompleteOne()
+        {
+            if (--Remaining == 0)
+            {
+                Delegate.ExecuteIfBound(Profiles, FailedUserIds);
+            }
+        }
+    };
+
+    TSharedRef<FUserProfilesBatch> Batch = MakeShared<FUserProfilesBatch>();
+    Batch->Profiles.Reserve(UserIds.Num());
+    Batch->Delegate = InProfilesDelegate;
+    // One extra count keeps cache hits from completing the batch before every lookup was issued
+    Batch->Remaining = UserIds.Num() + 1;
+    for (const FString& UserId : UserIds)
+    {
+        const bool bSent = GetUserProfile(UserId, FPicoUserProfileDelegate::CreateLambda(
+            [Batch, UserId](bool bIsError, const FString& ErrorMessage, const FPicoUserProfile& Profile)
+            {
+                if (bIsError)
+                {
+                    Batch->FailedUserIds.Add(UserId);
+                }
+                else
+                {
+                    Batch->Profiles.Add(Profile);
+                }
+                Batch->CompleteOne();
+            }));
+        if (!bSent)
+        {
+            Batch->FailedUserIds.Add(UserId);
+            Batch->CompleteOne();
+        }
+    }
+    Batch->CompleteOne();
+}
+
+void FPicoUserInterface::AddUserProfilesToCache(const TArray<FPicoUserProfile>& Profiles)
+{
+    if (ProfileCacheTTL <= 0.0)
+    {
+        return;
+    }
+    for (const FPicoUserProfile& Profile : Profiles)
+    {
+        if (!Profile.ID.IsEmpty())
+        {
+            CachedProfiles.Add(Profile.ID, Profile);
+        }
+    }
+    TrimProfileCache();
+}
+
+void FPicoUserInterface::InvalidateUserProfile(const FString& UserId)
+{
+    if (UserId.IsEmpty())
+    {
+        CachedProfiles.Reset();
+    }
+    else
+    {
+        CachedProfiles.Remove(UserId);
+    }
+}
+
+void FPicoUserInterface::SetUserProfileCacheTTL(double Seconds)
+{
+    ProfileCacheTTL = FMath::Max(Seconds, 0.0);
+    if (ProfileCacheTTL <= 0.0)
+    {
+        CachedProfiles.Reset();
+    }
+}
+
+const FPicoUserProfile* FPicoUserInterface::FindFreshProfile(const FString& UserId) const
+{
+    const FPicoUserProfile* Profile = CachedProfiles.Find(UserId);
+    if (Profile && FPlatformTime::Seconds() - Profile->FetchTime < ProfileCacheTTL)
+    {
+        return Profile;
+    }
+    return nullptr;
+}
 
+void FPicoUserInterface::FailInFlightProfile(const FString& UserId, const FString& ErrorMessage)
+{
+    FInFlightUserProfile InFlight;
+    if (!InFlightProfiles.RemoveAndCopyValue(UserId, InFlight))
+    {
+        return;
+    }
+    ++ProfileCacheStats.Failures;
+    UE_LOG(PicoUser, Log, TEXT("GetUserProfile return failed:%s"), *ErrorMessage);
+    const FPicoUserProfile Profile;
+    for (const FPicoUserProfileDelegate& Waiter : InFlight.Waiters)
+    {
+        Waiter.ExecuteIfBound(true, ErrorMessage, Profile);
+    }
+}
+
+void FPicoUserInterface::OnUserProfileReceived(const FString& UserId, ppfRequest RequestId, ppfMessageHandle Message, bool bIsError)
+{
+    // The entry may belong to a newer request if this one was given up as stale
+    const FInFlightUserProfile* Pending = InFlightProfiles.Find(UserId);
+    if (Pending == nullptr || Pending->RequestId != RequestId)
+    {
+        return;
+    }
+    if (bIsError)
+    {
+        auto Error = PicoMessageGetError(Message);
+        FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+        FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
+        ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
+        FailInFlightProfile(UserId, ErrorMessage);
+        return;
+    }
+
+    FInFlightUserProfile InFlight;
+    InFlightProfiles.RemoveAndCopyValue(UserId, InFlight);
+
+    FPicoUserProfile Profile;
+    Profile.InitParams(ppf_Message_GetUser(Message));
+    const double RequestSeconds = Profile.FetchTime - InFlight.StartTime;
+    ProfileCacheStats.TotalRequestSeconds += RequestSeconds;
+    ProfileCacheStats.MaxRequestSeconds = FMath::Max(ProfileCacheStats.MaxRequestSeconds, RequestSeconds);
+
+    // A room update or user list that arrived while the request was in flight is newer than this response
+    const FPicoUserProfile* CachedProfile = CachedProfiles.Find(UserId);
+    if (ProfileCacheTTL > 0.0 && !InFlight.bInvalidated && (CachedProfile == nullptr || CachedProfile->FetchTime < InFlight.StartTime))
+    {
+        CachedProfiles.Add(UserId, Profile);
+        TrimProfileCache();
+    }
+    for (const FPicoUserProfileDelegate& Waiter : InFlight.Waiters)
+    {
+        Waiter.ExecuteIfBound(false, FString(), Profile);
+    }
+}
+
+void FPicoUserInterface::OnRoomUpdateNotification(ppfMessageHandle Message, bool bIsError)
+{
+    if (bIsError || ProfileCacheTTL <= 0.0)
+    {
+        return;
+    }
+    ppfRoomHandle Room = ppf_Message_GetRoom(Message);
+    ppfUserArrayHandle Users = Room != nullptr ? ppf_Room_GetUsers(Room) : nullptr;
+    if (Users == nullptr)
+    {
+        return;
+    }
+    const int32 Size = ppf_UserArray_GetSize(Users);
+    for (int32 i = 0; i < Size; i++)
+    {
+        const FString UserId = UTF8_TO_TCHAR(ppf_User_GetID(ppf_UserArray_GetElement(Users, i)));
+        CachedProfiles.Remove(UserId);
+        if (FInFlightUserProfile* InFlight = InFlightProfiles.Find(UserId))
+        {
+            InFlight->bInvalidated = true;
+        }
+    }
+}
+
+bool FPicoUserInterface::TickInFlightTimeOuts(float DeltaTime)
+{
+    // Fails requests the task manager never expires, so their waiters are not kept forever
+    const double Now = FPlatformTime::Seconds();
+    TArray<FString> TimedOutUserIds;
+    for (const TPair<FString, FInFlightUserProfile>& InFlight : InFlightProfiles)
+    {
+        if (Now - InFlight.Value.StartTime >= InFlightProfileTimeOut)
+        {
+            TimedOutUserIds.Add(InFlight.Key);
+        }
+    }
+    for (const FString& UserId : TimedOutUserIds)
+    {
+        FailInFlightProfile(UserId, TEXT("Request timed out"));
+    }
+    return true;
+}
+
+void FPicoUserInterface::TrimProfileCache()
+{
+    const int32 MaxProfiles = FMath::Max(MaxCachedProfiles, 1);
+    if (CachedProfiles.Num() <= MaxProfiles)
+    {
+        return;
+    }
+    const double Now = FPlatformTime::Seconds();
+    for (auto It = CachedProfiles.CreateIterator(); It; ++It)
+    {
+        if (Now - It.Value().FetchTime >= ProfileCacheTTL)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    if (CachedProfiles.Num() <= MaxProfiles)
+    {
+        return;
+    }
+    // Still full of live entries: drop the oldest quarter at once so trimming is not repeated on every insert
+    TArray<TPair<double, FString>> ByAge;
+    ByAge.Reserve(CachedProfiles.Num());
+    for (const TPair<FString, FPicoUserProfile>& Cached : CachedProfiles)
+    {
+        ByAge.Emplace(Cached.Value.FetchTime, Cached.Key);
+    }
+    ByAge.Sort([](const TPair<double, FString>& A, const TPair<double, FString>& B)
+    {
+        return A.Key < B.Key;
+    });
+    const int32 NumToRemove = CachedProfiles.Num() - MaxProfiles * 3 / 4;
+    for (int32 i = 0; i < NumToRemove; i++)
+    {
+        CachedProfiles.Remove(ByAge[i].Value);
+    }
 }
 
 bool FPicoUserInterface::GetLoginUser(FGetLoginUser InGetLoginUserDelegate)
@@ -471,9 +854,9 @@ bool FPicoUserInterface::GetLoginUser(FGetLoginUser InGetLoginUserDelegate)
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetLoginUser return failed:%s"), *ErrorMessage);
                 this->GetLoginUserDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -482,8 +865,11 @@ bool FPicoUserInterface::GetLoginUser(FGetLoginUser InGetLoginUserDelegate)
             else
             {
                 UE_LOG(PicoUser, Log, TEXT("GetLoginUser Successfully"));
+                TArray<FPicoUserProfile> Profiles;
+                Profiles.AddDefaulted_GetRef().InitParams(ppf_Message_GetUser(Message));
+                AddUserProfilesToCache(Profiles);
                 UPico_User* Pico_User = NewObject<UPico_User>();
-                Pico_User->InitParams(ppf_Message_GetUser(Message));
+                Pico_User->InitParams(Profiles[0]);
                 this->GetLoginUserDelegate.ExecuteIfBound(false, FString(), Pico_User);
                 InGetLoginUserDelegate.ExecuteIfBound(false, FString(), Pico_User);
             }
@@ -494,16 +880,11 @@ bool FPicoUserInterface::GetLoginUser(FGetLoginUser InGetLoginUserDelegate)
 bool FPicoUserInterface::GetUserInfo(const FString& UserId, FGetUserInfo InGetUserInfoDelegate)
 {
     UE_LOG(PicoUser, Log, TEXT("FPicoUserInterface::GetUserInfo"));
-    ppfRequest RequestId = ppf_User_Get(TCHAR_TO_UTF8(*UserId));
-    PicoSubsystem.AddAsyncTask(RequestId, FPicoMessageOnCompleteDelegate::CreateLambda(
-        [InGetUserInfoDelegate, this](ppfMessageHandle Message, bool bIsError)
+    return GetUserProfile(UserId, FPicoUserProfileDelegate::CreateLambda(
+        [InGetUserInfoDelegate, this](bool bIsError, const FString& ErrorMessage, const FPicoUserProfile& Profile)
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
-                ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetUserInfo return failed:%s"), *ErrorMessage);
                 this->GetUserInfoDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
                 InGetUserInfoDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -512,12 +893,11 @@ bool FPicoUserInterface::GetUserInfo(const FString& UserId, FGetUserInfo InGetUs
             {
                 UE_LOG(PicoUser, Log, TEXT("GetUserInfo Successfully"));
                 UPico_User* Pico_User = NewObject<UPico_User>();
-                Pico_User->InitParams(ppf_Message_GetUser(Message));
+                Pico_User->InitParams(Profile);
                 this->GetUserInfoDelegate.ExecuteIfBound(false, FString(), Pico_User);
                 InGetUserInfoDelegate.ExecuteIfBound(false, FString(), Pico_User);
             }
         }));
-    return true;
 }
 
 bool FPicoUserInterface::GetLoggedInUserAndRoom(FGetLoggedInUserFriendsAndRooms InGetLoggedInuserFriendsAndRoomsCallback)
@@ -529,9 +909,9 @@ bool FPicoUserInterface::GetLoggedInUserAndRoom(FGetLoggedInUserFriendsAndRooms
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetLoggedInUserAndRoom return failed:%s"), *ErrorMessage);
                 this->GetLoggedInUserFriendsAndRoomsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -558,9 +938,9 @@ bool FPicoUserInterface::GetNextUserAndRoomArrayPage(UPico_UserAndRoomArray* InU
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetNextUserAndRoomArrayPage return failed:%s"), *ErrorMessage);
                 this->GetNextUserAndRoomArrayPageDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -587,9 +967,9 @@ bool FPicoUserInterface::GetUserFriends(FGetLoggedInUserFriends InGetLoggedInUse
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetUserFriends return failed:%s"), *ErrorMessage);
                 this->GetLoggedInUserFriendsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -598,8 +978,12 @@ bool FPicoUserInterface::GetUserFriends(FGetLoggedInUserFriends InGetLoggedInUse
             else
             {
                 UE_LOG(PicoUser, Log, TEXT("GetUserFriends return Sucessed"));
+                ppfUserArrayHandle UserArrayHandle = ppf_Message_GetUserArray(Message);
+                TArray<FPicoUserProfile> Profiles;
+                FPicoUserProfile::InitArray(UserArrayHandle, Profiles);
+                AddUserProfilesToCache(Profiles);
                 auto LoggedInUserFriends = NewObject<UPico_UserArray>();
-                LoggedInUserFriends->InitParams(ppf_Message_GetUserArray(Message));
+                LoggedInUserFriends->InitParams(UserArrayHandle, Profiles);
                 this->GetLoggedInUserFriendsDelegate.ExecuteIfBound(false, FString(), LoggedInUserFriends);
                 InGetLoggedInUserFriendsCallback.ExecuteIfBound(false, FString(), LoggedInUserFriends);
             }
@@ -616,9 +1000,9 @@ bool FPicoUserInterface::GetNextUserPage(UPico_UserArray* InUserArray, FGetNextU
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetNextUserPage return failed:%s"), *ErrorMessage);
                 this->GetNextUserFriendsPageDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -628,8 +1012,12 @@ bool FPicoUserInterface::GetNextUserPage(UPico_UserArray* InUserArray, FGetNextU
             {
                 ppfMessageType messageType = ppf_Message_GetType(Message);
                 UE_LOG(PicoUser, Log, TEXT("GetNextUserPage Successfully"));
+                ppfUserArrayHandle UserArrayHandle = ppf_Message_GetUserArray(Message);
+                TArray<FPicoUserProfile> Profiles;
+                FPicoUserProfile::InitArray(UserArrayHandle, Profiles);
+                AddUserProfilesToCache(Profiles);
                 UPico_UserArray* NextUserArrayPage = NewObject<UPico_UserArray>();
-                NextUserArrayPage->InitParams(ppf_Message_GetUserArray(Message));
+                NextUserArrayPage->InitParams(UserArrayHandle, Profiles);
                 this->GetNextUserFriendsPageDelegate.ExecuteIfBound(false, FString(), NextUserArrayPage);
                 OnGetNextUserPageCallback.ExecuteIfBound(false, FString(), NextUserArrayPage);
             }
@@ -646,9 +1034,9 @@ bool FPicoUserInterface::LaunchFriendRequestFlow(const FString& UserId, FLaunchF
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("LaunchFriendRequestFlow return failed:%s"), *ErrorMessage);
                 this->LaunchFriendRequestDelegate.ExecuteIfBound(true, ErrorMessage, false, false);
@@ -677,9 +1065,9 @@ bool FPicoUserInterface::GetAccessToken(FGetAccessTokenResult OnGetAccessTokenRe
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetAccessToken return failed:%s"), *ErrorMessage);
                 this->GetAccesstokenDelegate.ExecuteIfBound(true, ErrorMessage, FString());
@@ -693,7 +1081,7 @@ bool FPicoUserInterface::GetAccessToken(FGetAccessTokenResult OnGetAccessTokenRe
                 this->GetAccesstokenDelegate.ExecuteIfBound(false, FString(), AccessToken);
                 OnGetAccessTokenResultCallback.ExecuteIfBound(false, FString(), AccessToken);
             }
-        }));
+        }), /* bCanTimeOut */ false);
     return true;
 }
 
@@ -719,9 +1107,9 @@ bool FPicoUserInterface::GetRelations(TArray<FString> UserIDs, FGetUserRelationR
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetRelations return failed:%s"), *ErrorMessage);
                 this->GetUserRelationDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -751,9 +1139,9 @@ bool FPicoUserInterface::EntitlementCheck(bool bKillApp, FEntitlementCheckResult
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoUser, Log, TEXT("EntitlementCheck return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 this->EntitlementCheckResultDelegate.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
                 OnEntitlementCheckResultCallback.ExecuteIfBound(true, ErrorCode, ErrorMessage, nullptr);
@@ -782,9 +1170,9 @@ bool FPicoUserInterface::GetIDToken(FGetIDToken OnGetIDTokenResultCallback)
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetIDToken return failed:%s"), *ErrorMessage);
                 this->GetIDTokenDelegate.ExecuteIfBound(true, ErrorMessage, FString());
@@ -814,9 +1202,9 @@ bool FPicoUserInterface::GetOrgScopedID(const FString& UserId, FGetOrgScopedID O
         {
             if (bIsError)
             {
-                const ppfErrorHandle Error = ppf_Message_GetError(Message);
-                const FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                const int ErrorCode = ppf_Error_GetCode(Error);
+                const ppfErrorHandle Error = PicoMessageGetError(Message);
+                const FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                const int ErrorCode = PicoErrorGetCode(Error);
                 UE_LOG(PicoUser, Log, TEXT("GetOrgScopedID return failed: %d, %s"), ErrorCode, *ErrorMessage);
                 this->GetOrgScopedIDDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
                 OnGetOrgScopedIDCallback.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -843,9 +1231,9 @@ bool FPicoUserInterface::GetAuthorizePermissions(FGetPermissionResult OnGetPermi
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("GetAuthorizePermissions return failed:%s"), *ErrorMessage);
                 this->GetAuthorizePermissionsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -882,9 +1270,9 @@ bool FPicoUserInterface::RequestUserPermissions(TArray<FString> Permissions, FGe
         {
             if (bIsError)
             {
-                auto Error = ppf_Message_GetError(Message);
-                FString ErrorMessage = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
-                FString ErrorCode = FString::FromInt(ppf_Error_GetCode(Error));
+                auto Error = PicoMessageGetError(Message);
+                FString ErrorMessage = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
+                FString ErrorCode = FString::FromInt(PicoErrorGetCode(Error));
                 ErrorMessage = ErrorMessage + FString(". Error Code: ") + ErrorCode;
                 UE_LOG(PicoUser, Log, TEXT("RequestUserPermissions return failed:%s"), *ErrorMessage);
                 this->RequestUserPermissionsDelegate.ExecuteIfBound(true, ErrorMessage, nullptr);
@@ -4,6 +4,7 @@
 #include "RTCPicoUserInterface.h"
 #include "OnlineSubsystemPicoPrivate.h"
 #include "PPF_RtcEngineInitResult.h"
+#include "PicoLog.h"
 
 #if PLATFORM_WINDOWS
 #include <stdio.h>
@@ -258,6 +259,98 @@ FRTCPicoUserInterface::~FRTCPicoUserInterface()
     }
 }
 
+int32 FRTCPicoUserInterface::InternRtcId(const char* UTF8Id)
+{
+    if (UTF8Id == nullptr)
+    {
+        return INDEX_NONE;
+    }
+    const int32 Length = FCStringAnsi::Strlen(UTF8Id);
+    const uint32 Hash = FCrc::MemCrc32(UTF8Id, Length);
+    const uint64 Use = ++RtcIdUseCount;
+    for (auto It = RtcIdHandlesByHash.CreateConstKeyIterator(Hash); It; ++It)
+    {
+        FRtcIdTableEntry& Entry = *RtcIdTable[It.Value()];
+        if (FCStringAnsi::Strcmp(Entry.UTF8Id.GetData(), UTF8Id) == 0)
+        {
+            Entry.LastUse = Use;
+            return It.Value();
+        }
+    }
+
+    int32 Handle = RtcIdTable.Num();
+    if (Handle < RtcIdTableCapacity)
+    {
+        RtcIdTable.Add(MakeUnique<FRtcIdTableEntry>());
+    }
+    else
+    {
+        // Evict the least recently used ID, the IDs of the current report keep their handles
+        Handle = INDEX_NONE;
+        uint64 OldestUse = RtcIdPinnedFrom;
+        for (int32 Index = 0; Index < RtcIdTable.Num(); Index++)
+        {
+            if (RtcIdTable[Index]->LastUse < OldestUse)
+            {
+                OldestUse = RtcIdTable[Index]->LastUse;
+                Handle = Index;
+            }
+        }
+        if (Handle == INDEX_NONE)
+        {
+            return INDEX_NONE;
+        }
+        RtcIdHandlesByHash.RemoveSingle(RtcIdTable[Handle]->Hash, Handle);
+        // The handle now names another ID, its streams must count as new
+        for (auto It = PreviousRemoteVolumes.CreateIterator(); It; ++It)
+        {
+            if (static_cast<int32>(It.Key() >> 32) == Handle || static_cast<int32>((It.Key() >> 8) & 0xFFFFFF) == Handle)
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    FRtcIdTableEntry& Entry = *RtcIdTable[Handle];
+    Entry.Hash = Hash;
+    Entry.UTF8Id.Reset();
+    Entry.UTF8Id.Append(UTF8Id, Length + 1);
+    Entry.Id = UTF8_TO_TCHAR(UTF8Id);
+    Entry.LastUse = Use;
+    RtcIdHandlesByHash.Add(Hash, Handle);
+    return Handle;
+}
+
+const FString& FRTCPicoUserInterface::GetCachedRtcId(const char* UTF8Id, FString& Fallback)
+{
+    const int32 Handle = InternRtcId(UTF8Id);
+    if (Handle != INDEX_NONE)
+    {
+        return RtcIdTable[Handle]->Id;
+    }
+    Fallback = UTF8Id != nullptr ? FString(UTF8_TO_TCHAR(UTF8Id)) : FString();
+    return Fallback;
+}
+
+const FString& FRTCPicoUserInterface::GetRtcIdByHandle(int32 Handle) const
+{
+    static const FString EmptyId;
+    return RtcIdTable.IsValidIndex(Handle) ? RtcIdTable[Handle]->Id : EmptyId;
+}
+
+void FRTCPicoUserInterface::ResetRtcIdTable()
+{
+    RtcIdTable.Reset();
+    RtcIdHandlesByHash.Reset();
+    RtcIdPinnedFrom = 0;
+    PreviousRemoteVolumes.Reset();
+}
+
+void FRTCPicoUserInterface::SetRtcRemoteAudioVolumeChangeThreshold(int32 Threshold)
+{
+    RemoteAudioVolumeChangeThreshold = Threshold;
+}
+
 void FRTCPicoUserInterface::GetToken(const FString& UserId, const FString& RoomId, int Ttl, int InValue, const FOnGetTokenComplete& Delegate)
 {
     UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::GetToken!"));
@@ -526,8 +619,8 @@ void FRTCPicoUserInterface::OnQueryGetTokenComplete(ppfMessageHandle Message, bo
     FString ErrorStr;
     if (bIsError)
     {
-        auto Error = ppf_Message_GetError(Message);
-        ErrorStr = UTF8_TO_TCHAR(ppf_Error_GetMessage(Error));
+        auto Error = PicoMessageGetError(Message);
+        ErrorStr = UTF8_TO_TCHAR(PicoErrorGetMessage(Error));
         Delegate.ExecuteIfBound(FString(), false, ErrorStr);
         return;
     }
@@ -578,6 +671,7 @@ void FRTCPicoUserInterface::OnLeaveRoomResult(ppfMessageHandle Message, bool bIs
     auto LeaveRoomResult = ppf_Message_GetRtcLeaveRoomResult(Message);
     FString RoomId = UTF8_TO_TCHAR(ppf_RtcLeaveRoomResult_GetRoomId(LeaveRoomResult));
     RtcLeaveRoomCallback.Broadcast(RoomId);
+    ResetRtcIdTable();
 }
 
 void FRTCPicoUserInterface::OnUserJoinRoomResult(ppfMessageHandle Message, bool bIsError)
@@ -762,30 +856,48 @@ void FRTCPicoUserInterface::OnAudioPlaybackDeviceChangeNotification(ppfMessageHa
 
 void FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("Remote audio properties report notification error!"));
         return;
     }
-    ppfRtcRemoteAudioPropertiesReportHandle RtcRemoteAudioProperitesReport = ppf_Message_GetRtcRemoteAudioPropertiesReport(Message);
-    size_t S_AudioPropertiesInfosSize = ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfosSize(RtcRemoteAudioProperitesReport);
-    int TotalRemoteVolume = ppf_RtcRemoteAudioPropertiesReport_GetTotalRemoteVolume(RtcRemoteAudioProperitesReport);
-    TArray<FString> RoomIdArray;
-    TArray<FString> UserIdArray;
-    TArray<ERtcStreamIndex> StreamIndexArray;
-    TArray<int> VolumeArray;
-    for (size_t i = 0; i < S_AudioPropertiesInfosSize; i++)
+    if (!RtcRemoteAudioPropertiesSnapshotCallback.IsBound() && !RtcRemoteAudioPropertiesReportCallback.IsBound())
     {
-        auto AudioPropertiesInfos = ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfos(RtcRemoteAudioProperitesReport, i);
+        return;
+    }
+    ppfRtcRemoteAudioPropertiesReportHandle RtcRemoteAudioProperitesReport = ppf_Message_GetRtcRemoteAudioPropertiesReport(Message);
+    const int32 StreamNum = static_cast<int32>(ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfosSize(RtcRemoteAudioProperitesReport));
+
+    // The IDs of this report may evict older ones but not each other, only a report with more IDs than
+    // the table holds skips the streams past its capacity
+    RtcIdPinnedFrom = RtcIdUseCount + 1;
+
+    FRtcRemoteAudioPropertiesSnapshot& Snapshot = RemoteAudioPropertiesSnapshot;
+    Snapshot.TotalRemoteVolume = ppf_RtcRemoteAudioPropertiesReport_GetTotalRemoteVolume(RtcRemoteAudioProperitesReport);
+    Snapshot.RoomIds.SetNumUninitialized(StreamNum, false);
+    Snapshot.UserIds.SetNumUninitialized(StreamNum, false);
+    Snapshot.StreamIndexes.SetNumUninitialized(StreamNum, false);
+    Snapshot.Volumes.SetNumUninitialized(StreamNum, false);
+    Snapshot.ChangedStreams.Reset();
+    const int32 NumPreviousStreams = PreviousRemoteVolumes.Num();
+    // Streams whose IDs do not fit into the table are left out, an INDEX_NONE handle would corrupt the stream keys
+    int32 NumStreams = 0;
+    int32 NumSkippedStreams = 0;
+    for (int32 StreamInfoIndex = 0; StreamInfoIndex < StreamNum; StreamInfoIndex++)
+    {
+        auto AudioPropertiesInfos = ppf_RtcRemoteAudioPropertiesReport_GetAudioPropertiesInfos(RtcRemoteAudioProperitesReport, StreamInfoIndex);
         auto AudioPropertiesInfo = ppf_RtcRemoteAudioPropertiesInfo_GetAudioPropertiesInfo(AudioPropertiesInfos);
-        int Volume = ppf_RtcAudioPropertyInfo_GetVolume(AudioPropertiesInfo);
-        VolumeArray.Add(Volume);
+        const int32 Volume = ppf_RtcAudioPropertyInfo_GetVolume(AudioPropertiesInfo);
         auto StreamKey = ppf_RtcRemoteAudioPropertiesInfo_GetStreamKey(AudioPropertiesInfos);
-        FString RoomId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetRoomId(StreamKey));
-        RoomIdArray.Add(RoomId);
-        FString UserId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetUserId(StreamKey));
-        UserIdArray.Add(UserId);
+        const int32 RoomId = InternRtcId(ppf_RtcRemoteStreamKey_GetRoomId(StreamKey));
+        const int32 UserId = InternRtcId(ppf_RtcRemoteStreamKey_GetUserId(StreamKey));
+        if (RoomId == INDEX_NONE || UserId == INDEX_NONE)
+        {
+            NumSkippedStreams++;
+            continue;
+        }
+        const int32 i = NumStreams++;
         ppfRtcStreamIndex RtcStreamIndex = ppf_RtcRemoteStreamKey_GetStreamIndex(StreamKey);
         ERtcStreamIndex StreamIndex = ERtcStreamIndex::None;
         if (RtcStreamIndex == ppfRtcStreamIndex_Main)
@@ -796,16 +908,63 @@ void FRTCPicoUserInterface::OnRemoteAudioPropertiesReportNotification(ppfMessage
         {
             StreamIndex = ERtcStreamIndex::Screen;
         }
-        StreamIndexArray.Add(StreamIndex);
+        Snapshot.RoomIds[i] = RoomId;
+        Snapshot.UserIds[i] = UserId;
+        Snapshot.StreamIndexes[i] = StreamIndex;
+        Snapshot.Volumes[i] = Volume;
+
+        const uint64 StreamKeyId = (static_cast<uint64>(static_cast<uint32>(RoomId)) << 32) | (static_cast<uint64>(static_cast<uint32>(UserId)) << 8) | static_cast<uint64>(StreamIndex);
+        int32& PreviousVolume = PreviousRemoteVolumes.FindOrAdd(StreamKeyId, TNumericLimits<int32>::Min());
+        if (PreviousVolume == TNumericLimits<int32>::Min() || RemoteAudioVolumeChangeThreshold <= 0
+            || FMath::Abs(Volume - PreviousVolume) >= RemoteAudioVolumeChangeThreshold)
+        {
+            PreviousVolume = Volume;
+            Snapshot.ChangedStreams.Add(i);
+        }
+    }
+    if (NumSkippedStreams > 0)
+    {
+        PICO_LOG_RATE_LIMITED(RtcInterface, Warning, 5.0, TEXT("Remote audio properties report has %d streams, %d without room for their IDs were skipped"), StreamNum, NumSkippedStreams);
+        Snapshot.RoomIds.SetNum(NumStreams, false);
+        Snapshot.UserIds.SetNum(NumStreams, false);
+        Snapshot.StreamIndexes.SetNum(NumStreams, false);
+        Snapshot.Volumes.SetNum(NumStreams, false);
+    }
+    const bool bStreamSetChanged = NumPreviousStreams != NumStreams;
+    // Forget streams that left, so they count as new if they come back
+    if (PreviousRemoteVolumes.Num() != NumStreams)
+    {
+        PreviousRemoteVolumes.Reset();
+        for (int32 i = 0; i < NumStreams; i++)
+        {
+            const uint64 StreamKeyId = (static_cast<uint64>(static_cast<uint32>(Snapshot.RoomIds[i])) << 32) | (static_cast<uint64>(static_cast<uint32>(Snapshot.UserIds[i])) << 8) | static_cast<uint64>(Snapshot.StreamIndexes[i]);
+            PreviousRemoteVolumes.Add(StreamKeyId, Snapshot.Volumes[i]);
+        }
+    }
 
+    if (RemoteAudioVolumeChangeThreshold <= 0 || bStreamSetChanged || Snapshot.ChangedStreams.Num() > 0)
+    {
+        RtcRemoteAudioPropertiesSnapshotCallback.Broadcast(Snapshot);
+    }
+
+    if (RtcRemoteAudioPropertiesReportCallback.IsBound())
+    {
+        TArray<FString> RoomIdArray;
+        TArray<FString> UserIdArray;
+        RoomIdArray.Reserve(NumStreams);
+        UserIdArray.Reserve(NumStreams);
+        for (int32 i = 0; i < NumStreams; i++)
+        {
+            RoomIdArray.Add(GetRtcIdByHandle(Snapshot.RoomIds[i]));
+            UserIdArray.Add(GetRtcIdByHandle(Snapshot.UserIds[i]));
+        }
+        RtcRemoteAudioPropertiesReportCallback.Broadcast(Snapshot.TotalRemoteVolume, Snapshot.Volumes, RoomIdArray, UserIdArray, Snapshot.StreamIndexes);
     }
-    UE_LOG(RtcInterface, Log, TEXT("Remote audio properties broadcast!"));
-    RtcRemoteAudioPropertiesReportCallback.Broadcast(TotalRemoteVolume, VolumeArray, RoomIdArray, UserIdArray, StreamIndexArray);
 }
 
 void FRTCPicoUserInterface::OnLocalAudioPropertiesReportNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnLocalAudioPropertiesReportNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnLocalAudioPropertiesReportNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("Local audio properties report notification error!"));
@@ -1024,18 +1183,23 @@ void FRTCPicoUserInterface::OnRtcUserUnPublishInfoNotification(ppfMessageHandle
 
 void FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnGetRtcStreamSyncInfoNotification error!"));
         return;
     }
+    if (!RtcStreamSyncInfoCallback.IsBound() && !RtcStreamSyncInfoViewCallback.IsBound())
+    {
+        return;
+    }
     auto RtcStreamSyncInfo = ppf_Message_GetRtcStreamSyncInfo(Message);
-    FString Info = BytesToString(ppf_RtcStreamSyncInfo_GetData(RtcStreamSyncInfo), ppf_RtcStreamSyncInfo_GetLength(RtcStreamSyncInfo));
     ppfRtcSyncInfoStreamType pRtcSyncInfoStreamType = ppf_RtcStreamSyncInfo_GetStreamType(RtcStreamSyncInfo);
     auto RtcRemoteStreamKey = ppf_RtcStreamSyncInfo_GetStreamKey(RtcStreamSyncInfo);
-    FString UserId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetUserId(RtcRemoteStreamKey));
-    FString RoomId = UTF8_TO_TCHAR(ppf_RtcRemoteStreamKey_GetRoomId(RtcRemoteStreamKey));
+    FString UserIdFallback;
+    FString RoomIdFallback;
+    const FString& UserId = GetCachedRtcId(ppf_RtcRemoteStreamKey_GetUserId(RtcRemoteStreamKey), UserIdFallback);
+    const FString& RoomId = GetCachedRtcId(ppf_RtcRemoteStreamKey_GetRoomId(RtcRemoteStreamKey), RoomIdFallback);
     ppfRtcStreamIndex pRtcStreamIndex = ppf_RtcRemoteStreamKey_GetStreamIndex(RtcRemoteStreamKey);
     ERtcSyncInfoStreamType RtcSyncInfoStreamType = ERtcSyncInfoStreamType::None;
     if (pRtcSyncInfoStreamType == ppfRtcSyncInfoStreamType_Audio)
@@ -1052,7 +1216,13 @@ void FRTCPicoUserInterface::OnGetRtcStreamSyncInfoNotification(ppfMessageHandle
     {
         RtcStreamIndex = ERtcStreamIndex::Screen;
     }
-    RtcStreamSyncInfoCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, Info);
+    const TArrayView<const uint8> Payload(ppf_RtcStreamSyncInfo_GetData(RtcStreamSyncInfo), ppf_RtcStreamSyncInfo_GetLength(RtcStreamSyncInfo));
+    RtcStreamSyncInfoViewCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, Payload);
+    if (RtcStreamSyncInfoCallback.IsBound())
+    {
+        FString Info = BytesToString(Payload.GetData(), Payload.Num());
+        RtcStreamSyncInfoCallback.Broadcast(RoomId, UserId, RtcStreamIndex, RtcSyncInfoStreamType, Info);
+    }
 }
 
 void FRTCPicoUserInterface::OnRtcMessageSendResultNotification(ppfMessageHandle Message, bool bIsError)
@@ -1072,26 +1242,40 @@ void FRTCPicoUserInterface::OnRtcMessageSendResultNotification(ppfMessageHandle
 
 void FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRtcBinaryMessageReceivedNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnRtcBinaryMessageReceivedNotification error!"));
         return;
     }
+    if (!RtcBinaryMessageViewReceivedCallback.IsBound() && !RtcBinaryMessageReceivedCallback.IsBound() && !RtcBinaryArrayMessageReceivedCallback.IsBound())
+    {
+        return;
+    }
     auto RtcBinaryMessageReceived = ppf_Message_GetRtcBinaryMessageReceived(Message);
-    FString UserId = UTF8_TO_TCHAR(ppf_RtcBinaryMessageReceived_GetUserId(RtcBinaryMessageReceived));
-    FString RoomId = UTF8_TO_TCHAR(ppf_RtcBinaryMessageReceived_GetRoomId(RtcBinaryMessageReceived));
+    FString UserIdFallback;
+    FString RoomIdFallback;
+    const FString& UserId = GetCachedRtcId(ppf_RtcBinaryMessageReceived_GetUserId(RtcBinaryMessageReceived), UserIdFallback);
+    const FString& RoomId = GetCachedRtcId(ppf_RtcBinaryMessageReceived_GetRoomId(RtcBinaryMessageReceived), RoomIdFallback);
 
-    FString Info = BytesToString(ppf_RtcBinaryMessageReceived_GetData(RtcBinaryMessageReceived), ppf_RtcBinaryMessageReceived_GetLength(RtcBinaryMessageReceived));
-    TArray<uint8> BinaryArray;
-    BinaryArray.Append(ppf_RtcBinaryMessageReceived_GetData(RtcBinaryMessageReceived), ppf_RtcBinaryMessageReceived_GetLength(RtcBinaryMessageReceived));
-    RtcBinaryMessageReceivedCallback.Broadcast(RoomId, UserId, Info);
-    RtcBinaryArrayMessageReceivedCallback.Broadcast(RoomId, UserId, BinaryArray);
+    // The payload stays owned by the message, listeners get a view of it and only the legacy callbacks pay for copies
+    const TArrayView<const uint8> Payload(ppf_RtcBinaryMessageReceived_GetData(RtcBinaryMessageReceived), ppf_RtcBinaryMessageReceived_GetLength(RtcBinaryMessageReceived));
+    RtcBinaryMessageViewReceivedCallback.Broadcast(RoomId, UserId, Payload);
+    if (RtcBinaryMessageReceivedCallback.IsBound())
+    {
+        FString Info = BytesToString(Payload.GetData(), Payload.Num());
+        RtcBinaryMessageReceivedCallback.Broadcast(RoomId, UserId, Info);
+    }
+    if (RtcBinaryArrayMessageReceivedCallback.IsBound())
+    {
+        TArray<uint8> BinaryArray(Payload.GetData(), Payload.Num());
+        RtcBinaryArrayMessageReceivedCallback.Broadcast(RoomId, UserId, MoveTemp(BinaryArray));
+    }
 }
 
 void FRTCPicoUserInterface::OnRtcRoomMessageReceivedNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRtcRoomMessageReceivedNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRtcRoomMessageReceivedNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnRtcRoomMessageReceivedNotification error!"));
@@ -1106,7 +1290,7 @@ void FRTCPicoUserInterface::OnRtcRoomMessageReceivedNotification(ppfMessageHandl
 
 void FRTCPicoUserInterface::OnRtcUserMessageReceivedNotification(ppfMessageHandle Message, bool bIsError)
 {
-    UE_LOG(RtcInterface, Log, TEXT("FRTCPicoUserInterface::OnRtcUserMessageReceivedNotification!"));
+    UE_LOG(RtcInterface, Verbose, TEXT("FRTCPicoUserInterface::OnRtcUserMessageReceivedNotification!"));
     if (bIsError)
     {
         UE_LOG(RtcInterface, Error, TEXT("OnRtcUserMessageReceivedNotification error!"));
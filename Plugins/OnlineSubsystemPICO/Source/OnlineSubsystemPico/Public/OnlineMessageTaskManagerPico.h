@@ -10,6 +10,59 @@
 
 DECLARE_DELEGATE_TwoParams(FPicoMessageOnCompleteDelegate, ppfMessageHandle, bool /*bIsTimeOut or bIsError*/);
 DECLARE_MULTICAST_DELEGATE_TwoParams(FPicoMulticastMessageOnCompleteDelegate, ppfMessageHandle, bool);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FPicoMulticastRequestOnTimeOutDelegate, ppfRequest, float /*ElapsedTime*/);
+DECLARE_DELEGATE_RetVal_OneParam(uint64, FPicoNotificationKeyDelegate, ppfMessageHandle);
+
+/** Error code reported for a request that got no response within the timeout window */
+#define PICO_REQUEST_TIMEOUT_ERROR_CODE (-408)
+
+/**
+ * Null-safe wrappers around the ppf error accessors. A timed out request calls its delegate
+ * with bIsError set and a null message, which these report as a timeout error.
+ */
+inline ppfErrorHandle PicoMessageGetError(ppfMessageHandle Message)
+{
+    return Message ? ppf_Message_GetError(Message) : nullptr;
+}
+
+inline const char* PicoErrorGetMessage(ppfErrorHandle Error)
+{
+    return Error ? ppf_Error_GetMessage(Error) : "Request timed out";
+}
+
+inline int PicoErrorGetCode(ppfErrorHandle Error)
+{
+    return Error ? ppf_Error_GetCode(Error) : PICO_REQUEST_TIMEOUT_ERROR_CODE;
+}
+
+/** How notifications of one type are delivered when several of them arrive within one tick */
+enum class EPicoNotificationDelivery : uint8
+{
+    /** Every notification is delivered as soon as it is popped */
+    Queue,
+    /** Only the latest notification per key is delivered, before the next message that is not merged or at the end of the tick */
+    Coalesce,
+    /** Only the latest notification of the type is delivered, before the next message that is not merged or at the end of the tick */
+    DropOlder,
+};
+
+struct FPicoNotificationPolicy
+{
+    EPicoNotificationDelivery Delivery = EPicoNotificationDelivery::Queue;
+
+    /** Returns what a Coalesce notification is about, e.g. the room id. Without it every notification of the type shares one key */
+    FPicoNotificationKeyDelegate GetKey;
+};
+
+struct FPicoNotificationStats
+{
+    /** Notifications popped from the queue */
+    uint64 Received = 0;
+    /** Notifications handed to the listeners */
+    uint64 Delivered = 0;
+    /** Notifications replaced by a newer one before they were delivered */
+    uint64 Merged = 0;
+};
 
 
 class FOnlineAsyncTaskPico : public FOnlineAsyncTaskBasic<class FOnlineSubsystemPico>
@@ -24,12 +77,14 @@ PACKAGE_SCOPE:
 private:
     ppfMessageHandle MessageHandle = nullptr;
     bool bIsError;
+    bool bCanTimeOut;
 
 public:
-    FOnlineAsyncTaskPico(class FOnlineSubsystemPico* InPicoSubsystem, ppfRequest InRequestId, FPicoMessageOnCompleteDelegate InDelegate) :
+    FOnlineAsyncTaskPico(class FOnlineSubsystemPico* InPicoSubsystem, ppfRequest InRequestId, FPicoMessageOnCompleteDelegate InDelegate, bool bInCanTimeOut = true) :
         FOnlineAsyncTaskBasic(InPicoSubsystem),
         RequestId(InRequestId),
-        Delegate(InDelegate)
+        Delegate(InDelegate),
+        bCanTimeOut(bInCanTimeOut)
     {
     }
 
@@ -78,6 +133,12 @@ public:
 
 
     void TaskReceiveMessage(ppfMessageHandle InMessageHandle, bool InbIsError);
+
+    /** Marks the task as failed because no response arrived within the timeout window and reports it to the delegate as an error with a null message */
+    void TaskTimeOut();
+
+    /** Whether the task is subject to the request timeout */
+    bool CanTimeOut() const;
 };
 
 class FOnlineAsyncEventPico : public FOnlineAsyncEvent<FOnlineSubsystemPico>
@@ -126,6 +187,37 @@ public:
     }
 };
 
+/**
+ * Hashed timing wheel used to expire pending requests.
+ * Scheduling and cancelling are O(1); each slot is visited once per revolution.
+ */
+class FPicoRequestTimingWheel
+{
+public:
+    FPicoRequestTimingWheel(int32 InNumSlots = 64, double InTickInterval = 0.25);
+
+    /** Schedules RequestId to expire TimeOut seconds after Now */
+    void Schedule(ppfRequest RequestId, double TimeOut, double Now);
+
+    /** Advances the wheel to Now and appends the requests whose deadline has passed */
+    void Advance(double Now, TArray<ppfRequest>& OutExpired);
+
+    void Reset();
+
+private:
+    struct FEntry
+    {
+        ppfRequest RequestId;
+        uint32 RemainingRounds;
+    };
+
+    TArray<TArray<FEntry>> Slots;
+    uint32 SlotMask;
+    double TickInterval;
+    uint64 CurrentTick;
+    bool bStarted;
+};
+
 class FOnlineAsyncTaskManagerPico : public FOnlineAsyncTaskManager
 {
 
@@ -134,19 +226,58 @@ private:
 
     TMap<uint64, FOnlineAsyncTaskPico*> RequestTaskMap;
 
+    FPicoRequestTimingWheel RequestTimingWheel;
+
+    TArray<ppfRequest> ExpiredRequests;
+
+    /** Drain every pending message per tick instead of dispatching a single one */
+    bool bDrainMessageQueue;
+
+    /** Maximum number of messages popped per tick in drain mode, 0 means no limit */
+    int32 MaxMessagesPerTick;
+
+    /** Maximum time in seconds spent popping messages per tick in drain mode, 0 means no limit */
+    double MaxDrainTimePerTick;
+
+    /** Seconds after which a request without response is expired */
+    float RequestTimeOut;
+
+    TMap<ppfMessageType, FPicoNotificationPolicy> NotificationPolicies;
+
+    TMap<ppfMessageType, FPicoNotificationStats> NotificationStats;
+
+    struct FPendingNotification
+    {
+        ppfMessageType MessageType;
+        uint64 Key;
+        ppfMessageHandle MessageHandle;
+    };
+
+    /** Coalesced notifications waiting for the next unmerged message or the end of the tick, in order of their first arrival */
+    TArray<FPendingNotification> PendingNotifications;
+
+    /** Swapped with PendingNotifications while delivering, so listeners may pump messages again */
+    TArray<FPendingNotification> DeliveringNotifications;
+
+    /** Dispatches a popped message to the matching request task or notification delegate, returns true if it was consumed */
+    bool DispatchMessage(ppfMessageHandle MessageHandle);
+
+    /** Holds a notification back for end-of-tick delivery, returns false if its policy delivers it right away */
+    bool DeferNotification(ppfMessageType MessageType, ppfMessageHandle MessageHandle, bool bIsError);
+
+    /** Delivers the held back notifications, called before any message that is not merged and at the end of the tick */
+    void DeliverPendingNotifications();
+
+    void ExpireTimedOutTasks();
+
 protected:
 
     /** Cached reference to the main online subsystem */
     class FOnlineSubsystemPico* PicoSubsystem;
 public:
-    FOnlineAsyncTaskManagerPico(class FOnlineSubsystemPico* InOnlineSubsystem) :
-        PicoSubsystem(InOnlineSubsystem)
-    {
-    }
+    FOnlineAsyncTaskManagerPico(class FOnlineSubsystemPico* InOnlineSubsystem);
 
-    ~FOnlineAsyncTaskManagerPico()
-    {
-    }
+    ~FOnlineAsyncTaskManagerPico();
 
     // FOnlineAsyncTaskManager
     virtual void OnlineTick() override;
@@ -158,5 +289,13 @@ public:
     FPicoMulticastMessageOnCompleteDelegate& GetOrAddNotifyDelegate(ppfMessageType MessageType);
 
     void RemoveNotifyDelegate(ppfMessageType MessageType, const FDelegateHandle& Delegate);
-};
 
+    /** Sets how notifications of MessageType are delivered when several arrive within one tick */
+    void SetNotificationPolicy(ppfMessageType MessageType, EPicoNotificationDelivery Delivery, FPicoNotificationKeyDelegate GetKey = FPicoNotificationKeyDelegate());
+
+    /** Counters of the notifications of MessageType, all zero if none was received */
+    FPicoNotificationStats GetNotificationStats(ppfMessageType MessageType) const;
+
+    /** Broadcast when a request is expired by the timing wheel before its response arrived */
+    FPicoMulticastRequestOnTimeOutDelegate OnRequestTimeOut;
+};
@@ -42,6 +42,7 @@ DECLARE_MULTICAST_DELEGATE_FourParams(FOnPicoSessionUserInviteAcceptedComplete,
 
 DECLARE_MULTICAST_DELEGATE_FourParams(FOnRoomUpdateComplete, const FString& /*RoomID*/, bool /*bWasSuccessful*/, int, /*ErrorCode,*/ const FString& /*ErrorMessage*/);
 DECLARE_MULTICAST_DELEGATE_FourParams(FOnMatchmakingFoundComplete, const FString& /*RoomID*/, bool /*bWasSuccessful*/, int, /*ErrorCode,*/ const FString& /*ErrorMessage*/);
+DECLARE_MULTICAST_DELEGATE_FourParams(FOnSessionBrowserDelta, const FString& /*Query*/, const TArray<FString>& /*AddedRoomIDs*/, const TArray<FString>& /*UpdatedRoomIDs*/, const TArray<FString>& /*RemovedRoomIDs*/);
 
 
 /** @addtogroup Function Function
@@ -91,6 +92,78 @@ private:
 
 	static void SaveLog(const ELogVerbosity::Type Verbosity, const FString& Log);
 
+	// <summary>What the room data store of a session last received from this client, used to send only changed keys.</summary>
+	struct FRoomDataStoreSyncState
+	{
+		// <summary>The room the hashes were sent to. A different room starts from an empty state.</summary>
+		ppfID RoomID = 0;
+
+		// <summary>Hash of the value string of each key as the room last reported it or this client last sent it.</summary>
+		TMap<FName, uint32> SentValueHashes;
+	};
+
+	// <summary>Data store sync state per session name.</summary>
+	TMap<FName, FRoomDataStoreSyncState> RoomDataStoreSyncStates;
+
+	/// <summary>Gets the sent value hashes of a session, emptied so that the data store of a room update replaces them and values changed by other members are sent again.</summary>
+	/// <param name="SessionName">The session the room belongs to.</param>
+	/// <param name="Room">The handle of the updated room.</param>
+	/// <returns>nullptr if the session has not sent to this room.</returns>
+	TMap<FName, uint32>* ResetRoomDataStoreHashes(FName SessionName, ppfRoomHandle Room);
+
+	// <summary>A data store key and its FName.</summary>
+	struct FDataStoreKeyName
+	{
+		TArray<ANSICHAR> UTF8Key;
+		FName Name;
+	};
+
+	// <summary>FNames of the data store keys seen so far by the hash of their UTF-8 string, so that room updates do not convert unchanged keys.</summary>
+	mutable TMap<uint32, FDataStoreKeyName> DataStoreKeyNames;
+
+	/// <summary>Gets the FName of a data store key through DataStoreKeyNames.</summary>
+	FName GetDataStoreKeyName(const char* UTF8Key) const;
+
+	// <summary>A room returned by a search, kept so that the next search of the same query only rebuilds the rooms that changed.</summary>
+	struct FBrowsedRoom
+	{
+		// <summary>Hash of the room fields the session is built from, see GetRoomFingerprint.</summary>
+		uint32 Fingerprint = 0;
+
+		TSharedPtr<FOnlineSession> Session;
+	};
+
+	// <summary>One pass of a search over its result set, diffed against the rooms the query returned last time.</summary>
+	struct FSessionBrowserPass
+	{
+		FString Query;
+
+		// <summary>Rooms of the previous pass. What is left in it at the end was removed.</summary>
+		TMap<ppfID, FBrowsedRoom> PreviousRooms;
+
+		TMap<ppfID, FBrowsedRoom> Rooms;
+		TArray<FString> AddedRoomIDs;
+		TArray<FString> UpdatedRoomIDs;
+	};
+
+	// <summary>Rooms of the last search per query, e.g. a matchmaking pool or a page of moderated rooms.</summary>
+	TMap<FString, TMap<ppfID, FBrowsedRoom>> BrowsedRooms;
+
+	// <summary>Hashes the room fields CreateSessionFromRoom reads: owner, capacity, users, policy and the data store.</summary>
+	static uint32 GetRoomFingerprint(ppfRoomHandle Room);
+
+	FSessionBrowserPass BeginSessionBrowserPass(const FString& Query);
+
+	/// <summary>Returns the session of a room of the pass, built again only if the room changed since the previous pass.</summary>
+	/// <param name="Pass">The pass the room belongs to.</param>
+	/// <param name="Room">The handle of the room.</param>
+	/// <param name="bOutRebuilt">Set to `true` if the room is new or changed.</param>
+	/// <returns>The session of the room.</returns>
+	TSharedRef<FOnlineSession> GetBrowsedSession(FSessionBrowserPass& Pass, ppfRoomHandle Room, bool& bOutRebuilt) const;
+
+	// <summary>Stores the rooms of the pass for the next search of its query and broadcasts the changes.</summary>
+	void EndSessionBrowserPass(FSessionBrowserPass& Pass);
+
 PACKAGE_SCOPE:
 
 	FDelegateHandle OnRoomNotificationUpdateHandle;
@@ -104,8 +177,9 @@ PACKAGE_SCOPE:
 
 	TSharedRef<FOnlineSession> CreateSessionFromRoom(ppfRoomHandle Room) const;
 
-	void UpdateSessionFromRoom(FNamedOnlineSession& Session, ppfRoomHandle Room) const;
-	void UpdateSessionSettingsFromDataStore(FOnlineSessionSettings& SessionSettings, ppfDataStoreHandle DataStore) const;
+	void UpdateSessionFromRoom(FNamedOnlineSession& Session, ppfRoomHandle Room, TMap<FName, uint32>* OutDataStoreHashes = nullptr) const;
+	/// <summary>Updates the settings from a data store, and fills OutDataStoreHashes with the hash of every value when it is set.</summary>
+	void UpdateSessionSettingsFromDataStore(FOnlineSessionSettings& SessionSettings, ppfDataStoreHandle DataStore, TMap<FName, uint32>* OutDataStoreHashes = nullptr) const;
 
 	void TickPendingInvites(float DeltaTime);
 
@@ -405,6 +479,12 @@ public:
 
 	FOnMatchmakingFoundComplete MatchmakingFoundCallback;
 	FOnRoomUpdateComplete RoomUpdateCallback;
+
+	// <summary>Rooms added, changed or removed between two searches of the same query.</summary>
+	FOnSessionBrowserDelta SessionBrowserDeltaCallback;
+
+	/// <summary>Forgets the rooms of previous searches, the next search reports every room as added.</summary>
+	void ClearSessionBrowserCache();
 	
 	FOnRoomInviteAcceptedComplete RoomInviteAcceptedCallback;
 	FOnPicoSessionUserInviteAcceptedComplete PicoSessionUserInviteAcceptedCallback;
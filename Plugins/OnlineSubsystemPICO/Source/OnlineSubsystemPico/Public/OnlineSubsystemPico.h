@@ -140,14 +140,24 @@ public:
 
     /**
      * Allows for the PicoSDK calls to be used directly with the Delegates in the Pico PSS
+     * Requests that wait on the user, like the access token flow, pass false for bCanTimeOut
      */
-    void AddAsyncTask(ppfRequest RequestId, FPicoMessageOnCompleteDelegate Delegate);
+    void AddAsyncTask(ppfRequest RequestId, FPicoMessageOnCompleteDelegate Delegate, bool bCanTimeOut = true);
 
     //    void AddAsyncTask(ppfRequest RequestId, FPicoMessageOnCompleteDelegate Delegate);
 
     FPicoMulticastMessageOnCompleteDelegate& GetOrAddNotify(ppfMessageType MessageType) const;
     void RemoveNotifyDelegate(ppfMessageType MessageType, const FDelegateHandle& Delegate) const;
 
+    /** Sets how notifications of MessageType are delivered when several arrive within one tick */
+    void SetNotificationPolicy(ppfMessageType MessageType, EPicoNotificationDelivery Delivery, FPicoNotificationKeyDelegate GetKey = FPicoNotificationKeyDelegate()) const;
+
+    /** Counters of the received, delivered and merged notifications of MessageType */
+    FPicoNotificationStats GetNotificationStats(ppfMessageType MessageType) const;
+
+    /** Broadcast when a request got no response within the request timeout, after its delegate was called with an error */
+    FPicoMulticastRequestOnTimeOutDelegate& OnRequestTimeOut() const;
+
 PACKAGE_SCOPE:
 
     /** Only the factory makes instances */
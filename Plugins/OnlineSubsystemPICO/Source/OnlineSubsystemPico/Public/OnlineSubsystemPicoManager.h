@@ -257,7 +257,7 @@ public:
     void OnRtcAudioChangePlaybackDevice(ERtcAudioPlaybackDevice RtcAudioPlaybackDevice);
     void OnRtcMediaDeviceChangeInfo(const FString& DeviceId, ERtcMediaDeviceType MediaDeciveType, ERtcMediaDeviceState MediaDeviceState, ERtcMediaDeviceError MediaDeviceError);
     void OnRtcLocalAudioPropertiesReport(TArray<ERtcStreamIndex> StreamIndexs, TArray<int> Volumes);
-    void OnRtcRemoteAudioPropertiesReport(int TotalRemoteVolume, TArray<int> Volumes, const TArray<FString>& RoomIds, const TArray<FString>& UserIds, TArray<ERtcStreamIndex> StreamIndexs);
+    void OnRtcRemoteAudioPropertiesReport(const FRtcRemoteAudioPropertiesSnapshot& Snapshot);
     void OnRtcWarn(int MessageCode);
     void OnRtcError(int MessageCode);
     void OnRtcConnectStateChanged(const FString& StringMessage);
@@ -267,10 +267,9 @@ public:
     // Rtc V2
     void OnRtcUserPublishInfo(const FString& RoomId, const FString& UserId, ERtcMediaStreamType MediaStreamType);
     void OnRtcUserUnPublishInfo(const FString& RoomId, const FString& UserId, ERtcMediaStreamType MediaStreamType, ERtcStreamRemoveReason Reason);
-    void OnGetRtcStreamSyncInfo(const FString& RoomId, const FString& UserId, ERtcStreamIndex StreamIndex, ERtcSyncInfoStreamType RtcSyncInfoStreamType, const FString& Info);
+    void OnGetRtcStreamSyncInfo(const FString& RoomId, const FString& UserId, ERtcStreamIndex StreamIndex, ERtcSyncInfoStreamType RtcSyncInfoStreamType, TArrayView<const uint8> Payload);
     void OnRtcMessageSendResult(int64 MessageId, int32 Error, const FString& RoomId);
-    void OnRtcBinaryMessageReceived(const FString& RoomId, const FString& UserId, const FString& Info);
-    void OnRtcBinaryArrayMessageReceived(const FString& RoomId, const FString& UserId, TArray<uint8> BinaryArray);
+    void OnRtcBinaryMessageReceived(const FString& RoomId, const FString& UserId, TArrayView<const uint8> Payload);
     void OnRtcRoomMessageReceived(const FString& RoomId, const FString& UserId, const FString& Message);
     void OnRtcUserMessageReceived(const FString& RoomId, const FString& UserId, const FString& Message);
     void OnRtcTokenWilExpire(const FString& Message);
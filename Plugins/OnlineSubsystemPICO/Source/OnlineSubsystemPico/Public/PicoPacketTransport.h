@@ -0,0 +1,134 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PPF_Platform.h"
+
+/** Transport counters and estimates of one peer */
+struct FPicoTransportStats
+{
+	uint64 FramesSent = 0;
+	uint64 FramesReceived = 0;
+	/** Net driver packets carried by the frames */
+	uint64 PacketsSent = 0;
+	uint64 PacketsReceived = 0;
+	uint64 BytesSent = 0;
+	uint64 BytesReceived = 0;
+	uint64 FramesAcked = 0;
+	/** Frames that left the acknowledgement window without being acknowledged */
+	uint64 FramesLost = 0;
+	uint64 DuplicateFrames = 0;
+	uint64 OutOfOrderFrames = 0;
+	/** Frames dropped because they arrived behind the acknowledgement window */
+	uint64 LateFrames = 0;
+	/** Smoothed round trip time and its mean deviation in seconds */
+	double SmoothedRTT = 0.0;
+	double RTTVariance = 0.0;
+	/** Exponential average of the fraction of frames lost */
+	double LossRate = 0.0;
+};
+
+/** Messages with which two net drivers agree on using the packet transport for their connection */
+enum class EPicoTransportControl : uint8
+{
+	/** Sent by a client before its first packet, which is held until the server answers */
+	Offer = 1,
+	Accept = 2,
+	Reject = 3,
+};
+
+DECLARE_DELEGATE_ThreeParams(FPicoTransportSendFrame, ppfID /*PeerID*/, const uint8* /*Data*/, int32 /*Size*/);
+
+/**
+ * Frames the packets sent to each peer: packets sent within a tick are aggregated into one frame up to
+ * the frame size, and every frame carries a sequence number and a selective acknowledgement of the
+ * frames received from that peer, from which round trip time and loss are estimated.
+ * Lost frames are not resent and packets are not reordered, reliability and ordering stay with the net connection.
+ * Frames are only exchanged with peers that accepted the transport through the control messages.
+ */
+class ONLINESUBSYSTEMPICO_API FPicoPacketTransport
+{
+public:
+	/** Bytes every frame starts with, and bytes in front of every packet it carries */
+	static constexpr int32 FrameHeaderSize = 12;
+	static constexpr int32 PacketSizeFieldSize = 2;
+	/** Control messages have exactly this size, and the version must match for an offer to be accepted */
+	static constexpr int32 ControlMessageSize = 10;
+	static constexpr uint8 ProtocolVersion = 1;
+
+	static void WriteControlMessage(EPicoTransportControl Control, uint8 (&OutData)[ControlMessageSize]);
+
+	/** Returns false if the data is not a control message */
+	static bool ReadControlMessage(const uint8* Data, int32 Size, EPicoTransportControl& OutControl, uint8& OutVersion);
+
+	/** Frames are handed to SendFrame, which sends them with ppf_Net_SendPacket or to a loopback */
+	FPicoPacketTransport(FPicoTransportSendFrame InSendFrame, int32 InMaxFrameSize);
+
+	/** Largest packet that fits into a frame on its own, net connections must not send larger ones */
+	int32 GetMaxPacketSize() const
+	{
+		return MaxFrameSize - FrameHeaderSize - PacketSizeFieldSize;
+	}
+
+	/**
+	 * Queues a packet for the peer, it goes out with the next Flush or as soon as the frame is full.
+	 * Returns false and drops the packet if it is larger than GetMaxPacketSize.
+	 */
+	bool Send(ppfID PeerID, const uint8* Data, int32 Size, double Now);
+
+	/** Sends the queued frame of every peer */
+	void Flush(double Now);
+
+	/**
+	 * Reads a frame received from the peer and calls OnPacket for every packet it carries, duplicates are dropped.
+	 * Returns false if the data is not a well formed frame.
+	 */
+	bool Receive(ppfID PeerID, const uint8* Data, int32 Size, double Now, TFunctionRef<void(const uint8*, int32)> OnPacket);
+
+	/** Sends the frame queued for the peer and forgets its sequence and acknowledgement state, called when its connection closes */
+	void RemovePeer(ppfID PeerID, double Now);
+
+	const FPicoTransportStats* FindStats(ppfID PeerID) const;
+
+private:
+	/** Frames newer than the latest received one minus this are acknowledged individually */
+	static constexpr int32 AckWindow = 32;
+	static constexpr int32 SentHistorySize = 64;
+
+	struct FSentFrame
+	{
+		uint16 Sequence = 0;
+		double SendTime = 0.0;
+		bool bPending = false;
+	};
+
+	struct FPeer
+	{
+		uint16 NextSequence = 0;
+		FSentFrame SentFrames[SentHistorySize];
+		/** Whether the peer acknowledged anything yet, and whether the round trip time has a first sample */
+		bool bPeerSendsAcks = false;
+		bool bHasRTTSample = false;
+
+		bool bHasReceived = false;
+		uint16 LatestReceived = 0;
+		/** Bit i is set if frame LatestReceived - 1 - i was received */
+		uint32 ReceivedBits = 0;
+		double LatestReceivedTime = 0.0;
+
+		/** Frame being filled, starts with space for the header which is written when it is sent */
+		TArray<uint8> PendingFrame;
+		FPicoTransportStats Stats;
+	};
+
+	void SendPendingFrame(ppfID PeerID, FPeer& Peer, double Now);
+	void ProcessAcks(FPeer& Peer, uint16 AckSequence, uint32 AckBits, double AckDelay, double Now);
+	/** Returns false if the frame was already received or is too old to tell */
+	bool RecordReceived(FPeer& Peer, uint16 Sequence, double Now);
+	void ResolveFrame(FPeer& Peer, FSentFrame& Frame, bool bAcked);
+
+	FPicoTransportSendFrame SendFrame;
+	int32 MaxFrameSize;
+	TMap<ppfID, FPeer> Peers;
+};
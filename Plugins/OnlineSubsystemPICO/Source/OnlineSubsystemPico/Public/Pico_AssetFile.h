@@ -3,7 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "UObject/NoExportTypes.h"
+#include "UObject/StrongObjectPtr.h"
 #include "PPF_Platform.h"
 #include "OnlineSubsystemPicoNames.h"
 #include "OnlineSubsystemPico.h"
@@ -25,6 +27,37 @@ DECLARE_DYNAMIC_DELEGATE_ThreeParams(FGetAssetFileList, bool, bIsError, const FS
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FAssetFileDownloadUpdateNotify, UPico_AssetFileDownloadUpdate* /*AssetFileDownloadUpdateObj*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FAssetFileDeleteForSafetyNotify, UPico_AssetFileDeleteForSafety* /*AssetFileDeleteForSafetyObj*/);
+DECLARE_DELEGATE_TwoParams(FPicoAssetCatalogRefreshed, bool /*bIsError*/, const FString& /*ErrorMessage*/);
+
+/** Priority class of a download queued through FPicoAssetFileInterface::QueueDownloadById */
+enum class EPicoAssetDownloadPriority : uint8
+{
+    /** Needed now, always started before any waiting background download */
+    Foreground,
+    /** Prefetch, only started while no foreground download is waiting */
+    Background,
+};
+
+/** Plain copy of an asset's details, kept in the asset catalog without creating UObjects */
+struct ONLINESUBSYSTEMPICO_API FPicoAssetCatalogEntry
+{
+    ppfID AssetId = 0;
+    int32 Version = -1;
+    FString AssetType;
+    FString DownloadStatus;
+    FString FilePath;
+    FString Filename;
+    FString IapStatus;
+    FString Metadata;
+    FString IapSku;
+    FString IapName;
+    FString IapPrice;
+    FString IapCurrency;
+    FString IapDescription;
+    FString IapIconUrl;
+
+    void InitParams(ppfAssetDetails* InppfAssetDetailsHandle);
+};
 
 
 
@@ -45,6 +78,57 @@ private:
 	
 	FOnlineSubsystemPico& PicoSubsystem;
 
+    struct FQueuedAssetDownload
+    {
+        ppfID AssetId = 0;
+        TArray<FAssetFileDownloadResult> Delegates;
+    };
+
+    struct FActiveAssetDownload
+    {
+        /** Time of the last progress update */
+        double LastUpdateTime = 0.0;
+        bool bStallReported = false;
+        /** Waiting for the download request to complete */
+        TArray<FAssetFileDownloadResult> Delegates;
+        /** Response of the download request, handed to delegates that join after it completed */
+        TStrongObjectPtr<UPico_AssetFileDownloadResult> Result;
+    };
+
+    static constexpr int32 NumDownloadPriorities = 2;
+    /** Downloads waiting for a free slot, indexed by EPicoAssetDownloadPriority */
+    TArray<FQueuedAssetDownload> QueuedDownloads[NumDownloadPriorities];
+    /** Downloads holding a slot until they complete or are cancelled */
+    TMap<ppfID, FActiveAssetDownload> ActiveDownloads;
+    /** Time of the last progress broadcast per asset, used to throttle AssetFileDownloadUpdateCallback */
+    TMap<ppfID, double> LastProgressBroadcastTimes;
+    int32 MaxConcurrentDownloads = 2;
+    double ProgressBroadcastInterval = 0.25;
+    /** A download that has not reported progress for this long is reported as stalled, it keeps its slot */
+    double DownloadStallTimeout = 120.0;
+    /** Checks for stalled downloads even when no download event arrives */
+    FTSTicker::FDelegateHandle StallCheckTickerHandle;
+
+    TMap<ppfID, FPicoAssetCatalogEntry> AssetCatalog;
+    TSet<ppfID> RefreshedCatalogAssets;
+    TArray<FPicoAssetCatalogRefreshed> CatalogRefreshWaiters;
+    bool bCatalogRefreshInFlight = false;
+    /** Identifies the outstanding catalog page request, responses to an abandoned refresh are ignored */
+    uint32 CatalogPageSerial = 0;
+    double CatalogPageRequestTime = 0.0;
+    /** Fallback for page requests the task manager never expires, e.g. with the request timeout disabled */
+    double CatalogPageTimeOut = 30.0;
+
+    bool FindQueuedDownload(ppfID AssetId, int32& OutPriority, int32& OutIndex) const;
+    void StartQueuedDownloads();
+    bool StartDownload(FQueuedAssetDownload&& Download);
+    bool QueueDownload(ppfID AssetId, EPicoAssetDownloadPriority Priority, const FAssetFileDownloadResult& InDownloadDelegate);
+    void FinishDownload(ppfID AssetId);
+    bool TickStalledDownloads(float DeltaTime);
+    bool RequestCatalogPage(const char* NextPageParam);
+    void OnCatalogPageReceived(ppfMessageHandle Message, bool bIsError, uint32 Serial);
+    void FinishCatalogRefresh(bool bIsError, const FString& ErrorMessage);
+
 public:
 	FPicoAssetFileInterface(FOnlineSubsystemPico& InSubsystem);
     ~FPicoAssetFileInterface();
@@ -216,6 +300,74 @@ public:
     /// </returns>     
     bool GetAssetFileStatusByName(FString AssetFileName, FGetAssetFileStatus InGetAssetFileStatusByNameDelegate);
 
+    /// <summary>
+    /// Queues the download of an asset file by asset file ID. At most `MaxConcurrentAssetDownloads` queued
+    /// downloads run at once, and foreground downloads are started before background ones.
+    /// Queuing an asset that is already queued adds the delegate to that download and raises it to foreground if requested,
+    /// queuing an asset that is already downloading adds the delegate to the running download.
+    /// A download keeps its slot until it completes or is cancelled, also when it stops reporting progress.
+    /// </summary>
+    /// <param name="AssetFileID">The ID of the asset file to download.</param>
+    /// <param name="Priority">Foreground for assets needed now, Background for prefetching.</param>
+    /// <param name="InDownloadByIDDelegate">Will be executed when the download request has been completed.
+    /// Delegate will contain the requested object class (bool, bIsError, const FString&, ErrorMessage, UPico_AssetFileDownloadResult *, DownloadResult).</param>
+    /// <returns>Bool:
+    /// <ul>
+    /// <li>`true`: The download was queued</li>
+    /// <li>`false`: Queuing the download failed</li>
+    /// </ul>
+    /// </returns>
+    bool QueueDownloadById(FString AssetFileID, EPicoAssetDownloadPriority Priority, FAssetFileDownloadResult InDownloadByIDDelegate);
+
+    /// <summary>
+    /// Queues the download of an asset file by asset file name. The name is resolved to the asset file ID with
+    /// a status request first, the download is then queued like QueueDownloadById.
+    /// </summary>
+    /// <param name="AssetFileName">The name of the asset file to download.</param>
+    /// <param name="Priority">Foreground for assets needed now, Background for prefetching.</param>
+    /// <param name="InDownloadByNameDelegate">Will be executed when the download request has been completed or the name could not be resolved.
+    /// Delegate will contain the requested object class (bool, bIsError, const FString&, ErrorMessage, UPico_AssetFileDownloadResult *, DownloadResult).</param>
+    /// <returns>Bool:
+    /// <ul>
+    /// <li>`true`: The name is being resolved</li>
+    /// <li>`false`: The status request failed</li>
+    /// </ul>
+    /// </returns>
+    bool QueueDownloadByName(FString AssetFileName, EPicoAssetDownloadPriority Priority, FAssetFileDownloadResult InDownloadByNameDelegate);
+
+    /// <summary>
+    /// Removes a download that is still waiting in the queue. Downloads that already started are cancelled with DownloadCancelById.
+    /// </summary>
+    /// <param name="AssetFileID">The ID of the queued asset file.</param>
+    /// <returns>`true` if the download was waiting and has been removed.</returns>
+    bool RemoveQueuedDownload(FString AssetFileID);
+
+    /** Sets how many queued downloads may run at once. */
+    void SetMaxConcurrentDownloads(int32 InMaxConcurrentDownloads);
+
+    /** Sets the minimum interval between two progress broadcasts of the same asset, completion is always broadcast. */
+    void SetDownloadProgressInterval(float Seconds);
+
+    int32 GetNumActiveDownloads() const { return ActiveDownloads.Num(); }
+    int32 GetNumQueuedDownloads() const { return QueuedDownloads[0].Num() + QueuedDownloads[1].Num(); }
+
+    /// <summary>
+    /// Refreshes the asset catalog by walking every page of the asset file list. Assets whose version and
+    /// download status did not change are kept as they are, assets no longer listed are removed.
+    /// Calls made while a refresh is running wait for that refresh.
+    /// </summary>
+    /// <param name="InRefreshedDelegate">Will be executed when the refresh has been completed.</param>
+    /// <returns>Bool:
+    /// <ul>
+    /// <li>`true`: Sending request succeeded</li>
+    /// <li>`false`: Sending request failed</li>
+    /// </ul>
+    /// </returns>
+    bool RefreshAssetCatalog(FPicoAssetCatalogRefreshed InRefreshedDelegate);
+
+    /** Gets the asset catalog built by RefreshAssetCatalog. */
+    const TMap<ppfID, FPicoAssetCatalogEntry>& GetAssetCatalog() const { return AssetCatalog; }
+
     FDelegateHandle AssetFileDownloadUpdateHandle;
     void OnAssetFileDownloadUpdate(ppfMessageHandle Message, bool bIsError);
 
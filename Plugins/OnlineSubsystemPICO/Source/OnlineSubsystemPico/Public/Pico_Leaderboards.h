@@ -31,6 +31,62 @@ DECLARE_DYNAMIC_DELEGATE_ThreeParams(FGetEntriesByIds, bool, bIsError, const FSt
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FWriteEntry, bool, bIsError, const FString&, ErrorMessage, bool, WriteResult);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FWriteEntryWithSupplementaryMetric, bool, bIsError, const FString&, ErrorMessage, bool, WriteResult);
 
+/** Leaderboard entry copied out of the ppf message without creating UObjects. */
+struct FPicoLeaderboardEntryData
+{
+    ppfID ID = 0;
+    FString UserID;
+    FString UserDisplayName;
+    int32 Rank = 0;
+    int64 Score = 0;
+    FString DisplayScore;
+    uint64 Timestamp = 0;
+    bool bHasSupplementaryMetric = false;
+    int64 SupplementaryMetric = 0;
+    TArray<uint8> ExtraData;
+
+    void InitParams(ppfLeaderboardEntryHandle ppfLeaderboardEntryHandle);
+};
+
+/** One cached page of a leaderboard query. */
+struct FPicoLeaderboardPage
+{
+    TArray<FPicoLeaderboardEntryData> Entries;
+    int32 TotalCount = 0;
+    bool bHasNextPage = false;
+    bool bHasPreviousPage = false;
+    /** FPlatformTime::Seconds() when the page arrived */
+    double FetchTime = 0.0;
+
+    void InitParams(ppfLeaderboardEntryArrayHandle InppfLeaderboardEntryArrayHandle);
+};
+
+/** Identifies a GetEntries query; identical keys share a cache slot and an in-flight request. */
+struct FPicoLeaderboardPageKey
+{
+    FString LeaderboardName;
+    int32 PageIdx = 0;
+    int32 PageSize = 0;
+    ppfLeaderboardFilterType Filter = ppfLeaderboard_FilterNone;
+    ppfLeaderboardStartAt StartAt = ppfLeaderboard_StartAtTop;
+
+    bool operator==(const FPicoLeaderboardPageKey& Other) const
+    {
+        return PageIdx == Other.PageIdx && PageSize == Other.PageSize && Filter == Other.Filter && StartAt == Other.StartAt
+            && LeaderboardName == Other.LeaderboardName;
+    }
+
+    friend uint32 GetTypeHash(const FPicoLeaderboardPageKey& Key)
+    {
+        uint32 Hash = GetTypeHash(Key.LeaderboardName);
+        Hash = HashCombine(Hash, GetTypeHash(Key.PageIdx));
+        Hash = HashCombine(Hash, GetTypeHash(Key.PageSize));
+        return HashCombine(Hash, GetTypeHash(((int32)Key.Filter << 8) | (int32)Key.StartAt));
+    }
+};
+
+DECLARE_DELEGATE_ThreeParams(FPicoLeaderboardPageDelegate, bool /*bIsError*/, const FString& /*ErrorMessage*/, const FPicoLeaderboardPage& /*Page*/);
+
 /** @addtogroup Function Function
  *  This is the Function group
  *  @{
@@ -48,6 +104,39 @@ private:
 
     FOnlineSubsystemPico& PicoSubsystem;
 
+    struct FInFlightLeaderboardPage
+    {
+        FPicoLeaderboardPageKey Key;
+        uint32 Serial = 0;
+        double StartTime = 0.0;
+        /** Board generation when the request was sent; a write since then keeps new callers and the cache away from it */
+        uint32 Generation = 0;
+        TArray<FPicoLeaderboardPageDelegate> Waiters;
+    };
+
+    TMap<FPicoLeaderboardPageKey, FPicoLeaderboardPage> CachedPages;
+    /** Only a handful of requests are ever outstanding, so a flat array is searched linearly */
+    TArray<FInFlightLeaderboardPage> InFlightPages;
+    TMap<FString, double> LeaderboardCacheTTLs;
+    TMap<FString, uint32> LeaderboardGenerations;
+    uint32 GlobalGeneration = 0;
+    uint32 NextRequestSerial = 0;
+    double DefaultCacheTTL = 30.0;
+    int32 MaxCachedPages = 64;
+    /** Fallback for requests the task manager never expires, e.g. with the request timeout disabled */
+    double InFlightPageTimeOut = 30.0;
+    bool bPrefetchNextPage = true;
+
+    double GetCacheTTL(const FString& LeaderboardName) const;
+    uint32 GetGeneration(const FString& LeaderboardName) const;
+    const FPicoLeaderboardPage* FindFreshPage(const FPicoLeaderboardPageKey& Key) const;
+    FInFlightLeaderboardPage* FindCurrentInFlightPage(const FPicoLeaderboardPageKey& Key);
+    FInFlightLeaderboardPage* RequestPage(const FPicoLeaderboardPageKey& Key);
+    void OnPageReceived(uint32 Serial, ppfMessageHandle Message, bool bIsError);
+    void FailInFlightPage(int32 InFlightIndex, const FString& ErrorMessage);
+    void FailStaleInFlightPages();
+    void AddCachedPage(const FPicoLeaderboardPageKey& Key, FPicoLeaderboardPage&& Page);
+
 public:
     FPicoLeaderboardsInterface(FOnlineSubsystemPico& InSubsystem);
     ~FPicoLeaderboardsInterface();
@@ -118,6 +207,29 @@ public:
     /// </returns> 
     bool GetEntriesAfterRank(const FString& LeaderboardName, int PageIdx, int PageSize, unsigned long long AfterRank, FGetEntriesAfterRank InGetEntriesAfterRankDelegate);
 
+    /// <summary>Gets a list of leaderboard entries through the page cache.</summary>
+    /// <param name="LeaderboardName">Leaderboard name.</param>
+    /// <param name="PageIdx">Same as `GetEntries`.</param>
+    /// <param name="PageSize">Same as `GetEntries`.</param>
+    /// <param name="Filter">Same as `GetEntries`.</param>
+    /// <param name="StartAt">Same as `GetEntries`.</param>
+    /// <param name="InPageDelegate">Will be executed with the page. A fresh cached page is delivered before this call returns;
+    /// otherwise the delegate joins an identical request sent since the leaderboard was last written.</param>
+    /// <param name="bForceRefresh">Ignore the cached page.</param>
+    /// <returns>Bool: 
+    /// <ul>
+    /// <li>`true`: Sending request succeeded or the page was served from the cache</li>
+    /// <li>`false`: Sending request failed</li>
+    /// </ul>
+    /// </returns> 
+    bool GetEntriesCached(const FString& LeaderboardName, int PageIdx, int PageSize, ppfLeaderboardFilterType Filter, ppfLeaderboardStartAt StartAt, const FPicoLeaderboardPageDelegate& InPageDelegate, bool bForceRefresh = false);
+
+    /// <summary>Sets how long pages of a leaderboard stay valid in the cache. `0` disables caching for the leaderboard.</summary>
+    void SetLeaderboardCacheTTL(const FString& LeaderboardName, double Seconds);
+
+    /// <summary>Drops the cached pages of a leaderboard, or of all leaderboards if the name is empty.</summary>
+    void InvalidateLeaderboardCache(const FString& LeaderboardName);
+
 	/// <summary>Gets the leaderboard entries for a specified user.</summary>
 	/// <param name="leaderboardName">Leaderboard name.</param>
     /// <param name="pageSize">The number of entries to return on each page. The value ranges from 1 to 100.</param>
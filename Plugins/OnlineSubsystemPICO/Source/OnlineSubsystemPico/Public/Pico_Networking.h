@@ -15,6 +15,44 @@ DECLARE_LOG_CATEGORY_EXTERN(PicoNetworking, Log, All);
  * 
  */
 
+/** Packet counters of one peer, or of the current room for room sends. Failed sends are not counted. */
+struct FPicoPeerPacketStats
+{
+    uint64 PacketsSent = 0;
+    uint64 BytesSent = 0;
+    uint64 PacketsReceived = 0;
+    uint64 BytesReceived = 0;
+    /** ppf packets that carried more than one coalesced packet */
+    uint64 CoalescedSends = 0;
+};
+
+/** One packet read by ReadPackets, its bytes live in the batch's Data */
+struct FPicoReceivedPacket
+{
+    /** Pass to FPicoNetworkingInterface::GetPeerUserId to get the sender, valid until the peer is removed */
+    int32 PeerIndex = INDEX_NONE;
+    int32 Offset = 0;
+    int32 Size = 0;
+};
+
+/** Reusable receive buffer, keep one around and pass it to every ReadPackets call so reading does not allocate */
+struct FPicoPacketBatch
+{
+    TArray<uint8> Data;
+    TArray<FPicoReceivedPacket> Packets;
+
+    void Reset()
+    {
+        Data.Reset();
+        Packets.Reset();
+    }
+
+    TArrayView<const uint8> GetPacketData(const FPicoReceivedPacket& Packet) const
+    {
+        return TArrayView<const uint8>(Data.GetData() + Packet.Offset, Packet.Size);
+    }
+};
+
 /** @addtogroup Function Function
  *  This is the Function group
  *  @{
@@ -32,10 +70,65 @@ private:
 
     FOnlineSubsystemPico& PicoSubsystem;
 
+    enum class ECoalescingState : uint8
+    {
+        None,
+        /** Coalescing was offered, packets stay plain until the peer accepts */
+        Offered,
+        Accepted,
+    };
+
+    struct FPeer
+    {
+        FString UserId;
+        /** UserId converted to UTF-8 once, passed to ppf_Net_SendPacket and compared with incoming sender ids */
+        TArray<ANSICHAR> UserIdUTF8;
+        /** UserId as a number, 0 if it is not one */
+        ppfID SenderId = 0;
+        FPicoPeerPacketStats Stats;
+        /** Coalesced unreliable packets waiting to be sent as one ppf packet */
+        TArray<uint8> PendingSend;
+        double PendingSendTime = 0.0;
+        /** Packets and payload bytes in PendingSend, counted as sent once it is */
+        int32 PendingSendPackets = 0;
+        int32 PendingSendBytes = 0;
+        ECoalescingState SendCoalescing = ECoalescingState::None;
+        /** Whether this peer's coalesced packets are split, they start with its token */
+        bool bReceivesCoalesced = false;
+        uint32 ReceiveCoalescingToken = 0;
+    };
+
+    /** Removing a peer keeps the index of the others, its own index may be reused by the next new peer */
+    TSparseArray<FPeer> Peers;
+    TMap<FString, int32> PeerIndexByUserId;
+    /** Numeric sender ids parsed from ppf packets, so that receiving does not convert every sender id */
+    TMap<ppfID, int32> PeerIndexBySenderId;
+    FPicoPeerPacketStats RoomStats;
+    double SendCoalescingWindow = 0.0;
+    /** Written after the magic of the coalesced packets sent by this instance */
+    uint32 CoalescingToken = 0;
+
+    FDelegateHandle OnRoomUpdateNotificationHandle;
+    FDelegateHandle OnRoomLeaveNotificationHandle;
+
+    int32 FindOrAddPeer(const FString& UserId);
+    int32 FindOrAddPeer(const ANSICHAR* UserIdUTF8);
+    void RemovePeerAt(int32 PeerIndex);
+    bool FlushPendingSend(FPeer& Peer);
+    void AddReceivedPacket(FPicoPacketBatch& OutBatch, int32 PeerIndex, const uint8* Bytes, int32 Size);
+    /** Returns false if the packet is not a coalescing offer or acceptance, offers are only accepted when bCanSplit */
+    bool HandleCoalescingControl(const ANSICHAR* SenderID, const uint8* Bytes, int32 Size, bool bCanSplit);
+    /** Forgets the peers that are no longer in the room */
+    void OnRoomUpdateNotification(ppfMessageHandle Message, bool bIsError);
+    void OnRoomLeaveNotification(ppfMessageHandle Message, bool bIsError);
+
 public:
     FPicoNetworkingInterface(FOnlineSubsystemPico& InSubsystem);
     ~FPicoNetworkingInterface();
 
+    /** Sends coalesced packets whose window has elapsed, or all of them when bForce is set */
+    void FlushCoalescedPackets(bool bForce = false);
+
 
 public:
 
@@ -48,7 +141,7 @@ public:
     /// * `true`: success
     /// * `false`: failure
     /// </returns>
-    bool SendPacket(const FString& UserId, TArray<uint8> BinaryArray);
+    bool SendPacket(const FString& UserId, const TArray<uint8>& BinaryArray);
 
     /// <summary>
     /// Sends messages to a specified user. The maximum messaging frequency is 1000/s.
@@ -62,7 +155,7 @@ public:
     /// * `true`: success
     /// * `false`: failure
     /// </returns>
-    bool SendPacket(const FString& UserId, TArray<uint8> BinaryArray, bool bReliable);
+    bool SendPacket(const FString& UserId, const TArray<uint8>& BinaryArray, bool bReliable);
 
     /// <summary>
     /// Sends messages to other users in the room. The maximum messaging frequency is 1000/s.
@@ -72,7 +165,7 @@ public:
     /// * `true`: success
     /// * `false`: failure
     /// </returns>
-    bool SendPacketToCurrentRoom(TArray<uint8> BinaryArray);
+    bool SendPacketToCurrentRoom(const TArray<uint8>& BinaryArray);
 
     /// <summary>
     /// Sends messages to other users in the room. The maximum messaging frequency is 1000/s.
@@ -85,7 +178,7 @@ public:
     /// * `true`: success
     /// * `false`: failure
     /// </returns>
-    bool SendPacketToCurrentRoom(TArray<uint8> BinaryArray, bool bReliable);
+    bool SendPacketToCurrentRoom(const TArray<uint8>& BinaryArray, bool bReliable);
 
     /// <summary>
     /// Reads the messages from other users in the room.
@@ -98,6 +191,60 @@ public:
     /// </returns>
     bool ReadPacket(TArray<uint8>& OutBinaries, FString& OutSendId);
 
+    /// <summary>
+    /// Sends a message to a specified user without copying it. When a send coalescing window is set,
+    /// unreliable messages are gathered per user and sent together once the window has elapsed.
+    /// </summary>
+    /// <param name="UserId">The ID of the user to send messages to.</param>
+    /// <param name="Data">The message. The maximum bytes allowed is 512.</param>
+    /// <param name="bReliable">Whether messages between lost and resume will not be lost, see `SendPacket`.</param>
+    /// <returns>
+    /// * `true`: success, or the message was queued for coalescing
+    /// * `false`: failure
+    /// </returns>
+    bool SendPacketView(const FString& UserId, TArrayView<const uint8> Data, bool bReliable = false);
+
+    /// <summary>
+    /// Sends a message to other users in the room without copying it.
+    /// </summary>
+    /// <param name="Data">The message. The maximum bytes allowed is 512.</param>
+    /// <param name="bReliable">Whether messages between lost and resume will not be lost, see `SendPacketToCurrentRoom`.</param>
+    /// <returns>
+    /// * `true`: success
+    /// * `false`: failure
+    /// </returns>
+    bool SendPacketViewToCurrentRoom(TArrayView<const uint8> Data, bool bReliable = false);
+
+    /// <summary>
+    /// Reads all pending messages into a reusable batch. Coalesced messages are split back into the packets that were sent.
+    /// </summary>
+    /// <param name="OutBatch">Reset, then filled with the messages read. Its memory is reused across calls.</param>
+    /// <param name="MaxPackets">Stops after this many ppf packets, 0 reads until the queue is empty.</param>
+    /// <returns>The number of packets in the batch.</returns>
+    int32 ReadPackets(FPicoPacketBatch& OutBatch, int32 MaxPackets = 0);
+
+    /** Gets the user id of a peer index found in FPicoReceivedPacket. */
+    const FString& GetPeerUserId(int32 PeerIndex) const;
+
+    /// <summary>
+    /// Sets how long unreliable messages sent with SendPacketView are gathered before being sent as one packet.
+    /// 0 disables coalescing. Coalescing is offered to each user first and only used once they accept,
+    /// which users reading messages with ReadPackets do. Peers running an older version receive the offer as a message.
+    /// </summary>
+    /// <param name="Seconds">The coalescing window.</param>
+    void SetSendCoalescingWindow(float Seconds);
+
+    /** Gets the packet counters of a user, nullptr if no packet was exchanged with them. */
+    const FPicoPeerPacketStats* FindPeerPacketStats(const FString& UserId) const;
+
+    /** Gets the packet counters of messages sent to the current room. */
+    const FPicoPeerPacketStats& GetRoomPacketStats() const { return RoomStats; }
+
+    void ResetPacketStats();
+
+    /** Sends the coalesced packets of a user and forgets its state and counters, peers are also removed when they leave the room. */
+    void RemovePeer(const FString& UserId);
+
 };
 
 /** @} */
@@ -137,7 +284,7 @@ public:
     /// * `false`: failure
     /// </returns>
     UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "OnlinePico|Networking")
-    static bool SendPacket(UObject* WorldContextObject, const FString& UserId, TArray<uint8> BinaryArray, bool bReliable);
+    static bool SendPacket(UObject* WorldContextObject, const FString& UserId, const TArray<uint8>& BinaryArray, bool bReliable);
 
     /// <summary>
     /// Sends messages to other users in the room. The maximum messaging frequency is 1000/s.
@@ -152,7 +299,7 @@ public:
     /// * `false`: failure
     /// </returns>
     UFUNCTION(BlueprintCallable, meta = (WorldContext = "WorldContextObject"), Category = "OnlinePico|Networking")
-    static bool SendPacketToCurrentRoom(UObject* WorldContextObject, TArray<uint8> BinaryArray, bool bReliable);
+    static bool SendPacketToCurrentRoom(UObject* WorldContextObject, const TArray<uint8>& BinaryArray, bool bReliable);
 
     /// <summary>
     /// Reads the messages from other users in the room.
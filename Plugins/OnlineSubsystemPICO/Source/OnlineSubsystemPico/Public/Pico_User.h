@@ -2,6 +2,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "UObject/NoExportTypes.h"
 #include "PPF_Platform.h"
 #include "OnlineSubsystemPicoNames.h"
@@ -33,6 +34,59 @@ DECLARE_DYNAMIC_DELEGATE_FourParams(FEntitlementCheckResult, bool, bIsError, int
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FGetIDToken, bool, bIsError, const FString&, ErrorMessage, const FString&, IDToken);
 DECLARE_DYNAMIC_DELEGATE_ThreeParams(FGetOrgScopedID, bool, bIsError, const FString&, ErrorMessage, UPico_OrgScopedID*, OrgScopedID);
 
+/** Plain copy of a ppf user, converted from UTF-8 once and kept in the user profile cache. */
+struct FPicoUserProfile
+{
+    FString ID;
+    FString DisplayName;
+    FString ImageUrl;
+    FString SmallImageUrl;
+    FString InviteToken;
+    FString PresencePackage;
+    ppfUserPresenceStatus PresenceStatus = ppfUserPresenceStatus_Unknown;
+    ppfGender Gender = ppfGender_Unknown;
+    FString Presence;
+    FString PresenceDeeplinkMessage;
+    FString PresenceDestinationApiName;
+    FString PresenceLobbySessionId;
+    FString PresenceMatchSessionId;
+    FString PresenceExtra;
+    FString StoreRegion;
+    bool bPresenceIsJoinable = false;
+    /** FPlatformTime::Seconds() when the profile was read */
+    double FetchTime = 0.0;
+
+    void InitParams(ppfUserHandle ppfUserHandle);
+    static void InitArray(ppfUserArrayHandle InppfUserArrayHandle, TArray<FPicoUserProfile>& OutProfiles);
+};
+
+/** Counters of the user profile cache. */
+struct FPicoUserProfileCacheStats
+{
+    uint32 Hits = 0;
+    uint32 Misses = 0;
+    /** Misses that joined a request already in flight for the same user */
+    uint32 Merged = 0;
+    uint32 Requests = 0;
+    uint32 Failures = 0;
+    double TotalRequestSeconds = 0.0;
+    double MaxRequestSeconds = 0.0;
+
+    float GetHitRate() const
+    {
+        return Hits + Misses > 0 ? (float)Hits / (float)(Hits + Misses) : 0.f;
+    }
+
+    double GetAverageRequestSeconds() const
+    {
+        const uint32 Completed = Requests - Failures;
+        return Completed > 0 ? TotalRequestSeconds / Completed : 0.0;
+    }
+};
+
+DECLARE_DELEGATE_ThreeParams(FPicoUserProfileDelegate, bool /*bIsError*/, const FString& /*ErrorMessage*/, const FPicoUserProfile& /*Profile*/);
+DECLARE_DELEGATE_TwoParams(FPicoUserProfilesDelegate, const TArray<FPicoUserProfile>& /*Profiles*/, const TArray<FString>& /*FailedUserIds*/);
+
 /** @addtogroup Function Function
  *  This is the Function group
  *  @{
@@ -50,6 +104,32 @@ private:
 
     FOnlineSubsystemPico& PicoSubsystem;
 
+    struct FInFlightUserProfile
+    {
+        ppfRequest RequestId = 0;
+        double StartTime = 0.0;
+        // Set when a room update invalidated the user while the request was in flight, the response is then not cached
+        bool bInvalidated = false;
+        TArray<FPicoUserProfileDelegate> Waiters;
+    };
+
+    TMap<FString, FPicoUserProfile> CachedProfiles;
+    TMap<FString, FInFlightUserProfile> InFlightProfiles;
+    FPicoUserProfileCacheStats ProfileCacheStats;
+    double ProfileCacheTTL = 60.0;
+    int32 MaxCachedProfiles = 512;
+    // Fallback for requests the task manager never expires, e.g. with the request timeout disabled
+    double InFlightProfileTimeOut = 30.0;
+    FDelegateHandle OnRoomUpdateNotificationHandle;
+    FTSTicker::FDelegateHandle InFlightTimeOutTickerHandle;
+
+    const FPicoUserProfile* FindFreshProfile(const FString& UserId) const;
+    void OnUserProfileReceived(const FString& UserId, ppfRequest RequestId, ppfMessageHandle Message, bool bIsError);
+    void FailInFlightProfile(const FString& UserId, const FString& ErrorMessage);
+    void OnRoomUpdateNotification(ppfMessageHandle Message, bool bIsError);
+    bool TickInFlightTimeOuts(float DeltaTime);
+    void TrimProfileCache();
+
 public:
     FPicoUserInterface(FOnlineSubsystemPico& InSubsystem);
     ~FPicoUserInterface();
@@ -91,6 +171,38 @@ public:
     /// </returns>  
     bool GetUserInfo(const FString& UserId, FGetUserInfo InGetUserInfoDelegate);
 
+    /// <summary>Gets a user profile through the profile cache.</summary>
+    /// <param name="UserId">The ID of the user.</param>
+    /// <param name="InProfileDelegate">Will be executed with the profile. A fresh cached profile is delivered before this call returns;
+    /// otherwise the delegate joins any request already in flight for the same user.</param>
+    /// <param name="bForceRefresh">Ignore the cached profile.</param>
+    /// <returns>Bool:
+    /// <ul>
+    /// <li>`true`: Sending request succeeded or the profile was served from the cache</li>
+    /// <li>`false`: Sending request failed</li>
+    /// </ul>
+    /// </returns>  
+    bool GetUserProfile(const FString& UserId, const FPicoUserProfileDelegate& InProfileDelegate, bool bForceRefresh = false);
+
+    /// <summary>Gets several user profiles, requesting only the ones that are not cached. The delegate is executed once, after every user resolved.</summary>
+    /// <param name="UserIds">The IDs of the users.</param>
+    /// <param name="InProfilesDelegate">Will be executed with the found profiles and the IDs that failed.</param>
+    void GetUserProfiles(const TArray<FString>& UserIds, const FPicoUserProfilesDelegate& InProfilesDelegate);
+
+    /// <summary>Adds profiles read from another response, such as a friend list page, to the profile cache.</summary>
+    void AddUserProfilesToCache(const TArray<FPicoUserProfile>& Profiles);
+
+    /// <summary>Drops a cached profile, or all of them if the ID is empty.</summary>
+    void InvalidateUserProfile(const FString& UserId);
+
+    /// <summary>Sets how long cached profiles stay valid. `0` disables the cache.</summary>
+    void SetUserProfileCacheTTL(double Seconds);
+
+    const FPicoUserProfileCacheStats& GetUserProfileCacheStats() const
+    {
+        return ProfileCacheStats;
+    }
+
     /// <summary>Gets the friends of the logged-in user and the rooms the friends might be in. If a friend is not in any room, the 'room' field will be null.</summary>
     /// <param name="OnGetLoggedInuserFriendsAndRoomsCallback">Will be executed when the request has been completed. 
     /// Delegate will contain the requested object class (bool, bIsError, const FString&, ErrorMessage, UPico_UserAndRoomArray *, UserAndRoomArray).</param>
@@ -525,6 +637,7 @@ class ONLINESUBSYSTEMPICO_API UPico_User : public UObject
     GENERATED_BODY()
 public:
     void InitParams(ppfUser* ppfUserHandle);
+    void InitParams(const FPicoUserProfile& Profile);
 
 private:
     FString DisplayName = FString();
@@ -620,6 +733,8 @@ class ONLINESUBSYSTEMPICO_API UPico_UserArray : public UObject
 
 public:
     void InitParams(ppfUserArray* InppfUserArrayHandle);
+    /** Builds the users from profiles already read from the same array */
+    void InitParams(ppfUserArray* InppfUserArrayHandle, const TArray<FPicoUserProfile>& Profiles);
 
 private:
     UPROPERTY()
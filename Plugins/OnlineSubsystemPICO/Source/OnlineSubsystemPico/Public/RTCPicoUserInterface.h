@@ -220,10 +220,29 @@ DECLARE_MULTICAST_DELEGATE_FiveParams(FGetRtcStreamSyncInfo, const FString& /*Ro
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcMessageSendResult, int64 /*MessageId*/, int32 /*Error*/, const FString& /*RoomId*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcBinaryMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Info*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcBinaryArrayMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, TArray<uint8> /*BinaryArray*/)
+DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcBinaryMessageViewReceived, const FString& /*RoomId*/, const FString& /*UserId*/, TArrayView<const uint8> /*Payload*/)
+DECLARE_MULTICAST_DELEGATE_FiveParams(FGetRtcStreamSyncInfoView, const FString& /*RoomId*/, const FString& /*UserId*/, ERtcStreamIndex /*StreamIndex*/, ERtcSyncInfoStreamType /*RtcSyncInfoStreamType*/, TArrayView<const uint8> /*Payload*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcRoomMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Message*/)
 DECLARE_MULTICAST_DELEGATE_ThreeParams(FRtcUserMessageReceived, const FString& /*RoomId*/, const FString& /*UserId*/, const FString& /*Message*/)
 /// @endcond
 
+/// <summary>A remote audio properties report as parallel arrays, one element per remote stream. The same instance is refilled by every report.</summary>
+struct FRtcRemoteAudioPropertiesSnapshot
+{
+    /// <summary>Total volume of the remote users.</summary>
+    int TotalRemoteVolume = 0;
+    /// <summary>Room ID handles, resolve them with `FRTCPicoUserInterface::GetRtcIdByHandle`.</summary>
+    TArray<int32> RoomIds;
+    /// <summary>User ID handles, resolve them with `FRTCPicoUserInterface::GetRtcIdByHandle`.</summary>
+    TArray<int32> UserIds;
+    TArray<ERtcStreamIndex> StreamIndexes;
+    TArray<int32> Volumes;
+    /// <summary>Indexes of the streams that are new since the last report or whose volume moved by at least the change threshold.</summary>
+    TArray<int32> ChangedStreams;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FRtcRemoteAudioPropertiesSnapshotReport, const FRtcRemoteAudioPropertiesSnapshot& /*Snapshot*/);
+
 /** @addtogroup Function Function
  *  This is the Function group
  *  @{
@@ -299,6 +318,18 @@ public:
     /// </param>
     void RtcEnableAudioPropertiesReport(int Interval);
 
+    /// <summary>Sets how much the volume of a remote stream must change before the stream is listed in `FRtcRemoteAudioPropertiesSnapshot::ChangedStreams`.
+    /// With a threshold greater than `0`, `RtcRemoteAudioPropertiesSnapshotCallback` is skipped for reports in which no stream changed.</summary>
+    /// <param name="Threshold">The volume change threshold. `0` or a negative value lists every stream as changed.</param>
+    void SetRtcRemoteAudioVolumeChangeThreshold(int32 Threshold);
+
+    /// <summary>Gets the room or user ID behind a handle of `FRtcRemoteAudioPropertiesSnapshot`.
+    /// Handles stay valid until the local user leaves the room or the ID is evicted from the full ID table,
+    /// which never happens to the IDs of the latest report.</summary>
+    /// <param name="Handle">A room or user ID handle.</param>
+    /// <returns>The ID, or an empty string for an invalid handle.</returns>
+    const FString& GetRtcIdByHandle(int32 Handle) const;
+
     /// <summary>Leaves a room.</summary>
     /// <param name="RoomId">Room ID.</param>
     /// <returns>Int:
@@ -598,6 +629,54 @@ public:
 private:
     TArray<uint8> GetBytesByInt(int32 Inint);
 
+    /// <summary>A room or user ID as received from the RTC engine, and its converted form.</summary>
+    struct FRtcIdTableEntry
+    {
+        uint32 Hash;
+        TArray<ANSICHAR> UTF8Id;
+        FString Id;
+        /// <summary>Value of RtcIdUseCount when the ID was last looked up.</summary>
+        uint64 LastUse;
+    };
+
+    /// <summary>Maximum number of IDs kept in RtcIdTable.</summary>
+    static constexpr int32 RtcIdTableCapacity = 256;
+
+    /// <summary>IDs seen in high-rate notifications, the index of an entry is its handle.
+    /// Entries are heap allocated so returned references stay valid while the table grows.</summary>
+    TArray<TUniquePtr<FRtcIdTableEntry>> RtcIdTable;
+
+    /// <summary>Handles in RtcIdTable by the CRC of their UTF-8 ID, the ID itself is compared on a match.</summary>
+    TMultiMap<uint32, int32> RtcIdHandlesByHash;
+
+    /// <summary>Number of ID lookups so far, orders the entries for least recently used eviction.</summary>
+    uint64 RtcIdUseCount = 0;
+
+    /// <summary>Entries looked up since this count belong to the current remote audio properties report and are not evicted.</summary>
+    uint64 RtcIdPinnedFrom = 0;
+
+    /// <summary>Returns the handle of a UTF-8 room or user ID, adding it to the table the first time it is seen.
+    /// A full table evicts its least recently used ID and hands its handle to the new one.</summary>
+    /// <returns>The handle, or INDEX_NONE if every ID in the full table is pinned.</returns>
+    int32 InternRtcId(const char* UTF8Id);
+
+    /// <summary>Returns the converted form of a UTF-8 room or user ID without converting IDs that were already seen.</summary>
+    /// <param name="UTF8Id">The ID as returned by the RTC engine.</param>
+    /// <param name="Fallback">Receives the conversion when the ID cannot be added to the table.</param>
+    const FString& GetCachedRtcId(const char* UTF8Id, FString& Fallback);
+
+    /// <summary>Drops every interned ID, which invalidates the handles of the last remote audio properties snapshot.</summary>
+    void ResetRtcIdTable();
+
+    /// <summary>Reused by every remote audio properties report.</summary>
+    FRtcRemoteAudioPropertiesSnapshot RemoteAudioPropertiesSnapshot;
+
+    /// <summary>Volume of each stream in the previous report, keyed by room handle, user handle and stream index.</summary>
+    TMap<uint64, int32> PreviousRemoteVolumes;
+
+    /// <summary>See `SetRtcRemoteAudioVolumeChangeThreshold`.</summary>
+    int32 RemoteAudioVolumeChangeThreshold = 0;
+
 
 PACKAGE_SCOPE:
 
@@ -713,6 +792,12 @@ public:
     /// <summary>Gets the volume of each user's voice.</summary>
     FRtcRemoteAudioPropertiesReport RtcRemoteAudioPropertiesReportCallback;
 
+    /// <summary>
+    /// Sets the callback to get the remote audio properties report as a snapshot with interned room and user IDs.
+    /// @note The snapshot is reused by the next report. Copy what you need to keep.
+    /// </summary>
+    FRtcRemoteAudioPropertiesSnapshotReport RtcRemoteAudioPropertiesSnapshotCallback;
+
     /// <summary>Gets the volume of the current user's voice.</summary>
     FRtcLocalAudioPropertiesReport RtcLocalAudioPropertiesReportCallback;
 
@@ -770,6 +855,18 @@ public:
     /// </summary>
     FRtcBinaryArrayMessageReceived RtcBinaryArrayMessageReceivedCallback;
 
+    /// <summary>
+    /// Sets the callback to get notified when a to-room or to-user binary message is received.
+    /// @note The payload is only valid during the callback. Copy it if you need to keep it.
+    /// </summary>
+    FRtcBinaryMessageViewReceived RtcBinaryMessageViewReceivedCallback;
+
+    /// <summary>
+    /// Sets the callback to get notified when the stream sync info is received, with the info as raw bytes.
+    /// @note The payload is only valid during the callback. Copy it if you need to keep it.
+    /// </summary>
+    FGetRtcStreamSyncInfoView RtcStreamSyncInfoViewCallback;
+
     /// <summary>
     /// Sets the callback to get notified when a to-room message is received.
     /// </summary>
@@ -46,8 +46,6 @@ private:
 	FCriticalSection* SyncObject;
 };
 
-static constexpr int32_t MaxHandJointCount = 32;
-
 void StreamingDataReceiveWrapper::NotifyFovUpdated(const ps_common::DeviceFovInfo& fov_info)
 {
 	PDCDeviceFovInfo = fov_info;
@@ -62,17 +60,28 @@ void StreamingDataReceiveWrapper::NotifyIPDUpdated(float ipd)
 
 ps_common::Quaternion StreamingDataReceiveWrapper::GetControllerRotation(EControllerHand DeviceHand) const
 {
-	return (DeviceHand == EControllerHand::Left) ? LeftRotation : RightRotation;
+	FPICOXRDPDevicePoseSample Sample;
+	DevicePoseRing.ReadLatest(Sample);
+	return (DeviceHand == EControllerHand::Left) ? Sample.LeftRotation : Sample.RightRotation;
 }
 
 ps_common::Vector StreamingDataReceiveWrapper::GetHMDPosition() const
 {
-	return HMDPosition;
+	FPICOXRDPDevicePoseSample Sample;
+	DevicePoseRing.ReadLatest(Sample);
+	return Sample.HMDPosition;
 }
 
 ps_common::Quaternion StreamingDataReceiveWrapper::GetHMDRotation() const
 {
-	return HMDRotation;
+	FPICOXRDPDevicePoseSample Sample;
+	DevicePoseRing.ReadLatest(Sample);
+	return Sample.HMDRotation;
+}
+
+bool StreamingDataReceiveWrapper::GetDevicePoseSample(FPICOXRDPDevicePoseSample& OutSample, double Time) const
+{
+	return Time > 0.0 ? DevicePoseRing.ReadNearest(Time, OutSample) : DevicePoseRing.ReadLatest(OutSample);
 }
 
 bool StreamingDataReceiveWrapper::GetDeviceFovInfo(ps_common::DeviceFovInfo& FovInfo) const
@@ -91,7 +100,9 @@ bool StreamingDataReceiveWrapper::GetDeviceFovInfo(ps_common::DeviceFovInfo& Fov
 
 ps_common::Vector StreamingDataReceiveWrapper::GetControllerPosition(EControllerHand DeviceHand) const
 {
-	return (DeviceHand == EControllerHand::Left) ? LeftPosition : RightPosition;
+	FPICOXRDPDevicePoseSample Sample;
+	DevicePoseRing.ReadLatest(Sample);
+	return (DeviceHand == EControllerHand::Left) ? Sample.LeftPosition : Sample.RightPosition;
 }
 
 void StreamingDataReceiveWrapper::NotifyDevicePoseUpdated(const ps_common::DevicePose pose_arr[], size_t arr_size)
@@ -103,22 +114,22 @@ void StreamingDataReceiveWrapper::NotifyDevicePoseUpdated(const ps_common::Devic
 		case ps_common::DeviceType::kUndefined: break;
 		case ps_common::DeviceType::kHead:
 			{
-				HMDPosition = pose_arr[index].position();
-				HMDRotation = pose_arr[index].rotation();
+				DevicePoseStaging.HMDPosition = pose_arr[index].position();
+				DevicePoseStaging.HMDRotation = pose_arr[index].rotation();
 			}
 			break;
 		case ps_common::DeviceType::kHandController:
 			{
 				if (pose_arr[index].side_type() == ps_common::SideType::kLeft)
 				{
-					LeftPosition = pose_arr[index].position();
-					LeftRotation = pose_arr[index].rotation();
+					DevicePoseStaging.LeftPosition = pose_arr[index].position();
+					DevicePoseStaging.LeftRotation = pose_arr[index].rotation();
 					bLeftControllerActive = pose_arr[index].active();
 				}
 				else
 				{
-					RightPosition = pose_arr[index].position();
-					RightRotation = pose_arr[index].rotation();
+					DevicePoseStaging.RightPosition = pose_arr[index].position();
+					DevicePoseStaging.RightRotation = pose_arr[index].rotation();
 					bRightControllerActive = pose_arr[index].active();
 				}
 			}
@@ -126,6 +137,8 @@ void StreamingDataReceiveWrapper::NotifyDevicePoseUpdated(const ps_common::Devic
 		default: ;
 		}
 	}
+
+	DevicePoseRing.Write(DevicePoseStaging, FPlatformTime::Seconds());
 }
 
 void StreamingDataReceiveWrapper::NotifyControllerButtonUpdated(const ps_common::ControllerButton& button)
@@ -218,9 +231,6 @@ void StreamingDataReceiveWrapper::NotifyControllerStateUpdated(const ps_common::
 
 void StreamingDataReceiveWrapper::NotifyHandJointUpdated(const ps_common::HandJointLocations hand_joints[], size_t arr_size)
 {
-	LeftHand_joint_infos.Init(ps_common::HandJointLocation(), MaxHandJointCount);
-	RightHand_joint_infos.Init(ps_common::HandJointLocation(), MaxHandJointCount);
-
 	for (int index = 0; index < arr_size; index++)
 	{
 		switch (hand_joints[index].side_type)
@@ -229,23 +239,25 @@ void StreamingDataReceiveWrapper::NotifyHandJointUpdated(const ps_common::HandJo
 			break;
 		case ps_common::SideType::kLeft:
 			{
-				LeftHand_is_active = hand_joints[index].is_active;
 				if (hand_joints[index].is_active)
 				{
-					LeftHand_joint_count = hand_joints[index].joint_count;
-					FMemory::Memcpy(LeftHand_joint_infos.GetData(), hand_joints[index].joint_locations, sizeof(ps_common::HandJointLocation) * MaxHandJointCount);
-					FMemory::Memcpy(&LeftHandAimState, &hand_joints[index].aim_state, sizeof(ps_common::HandAimState));
+					FMemory::Memcpy(&HandStaging.Left, &hand_joints[index], sizeof(ps_common::HandJointLocations));
+				}
+				else
+				{
+					HandStaging.Left = ps_common::HandJointLocations();
 				}
 			}
 			break;
 		case ps_common::SideType::kRight:
 			{
-				RightHand_is_active = hand_joints[index].is_active;
 				if (hand_joints[index].is_active)
 				{
-					RightHand_joint_count = hand_joints[index].joint_count;
-					FMemory::Memcpy(RightHand_joint_infos.GetData(), hand_joints[index].joint_locations, sizeof(ps_common::HandJointLocation) * MaxHandJointCount);
-					FMemory::Memcpy(&RightHandAimState, &hand_joints[index].aim_state, sizeof(ps_common::HandAimState));
+					FMemory::Memcpy(&HandStaging.Right, &hand_joints[index], sizeof(ps_common::HandJointLocations));
+				}
+				else
+				{
+					HandStaging.Right = ps_common::HandJointLocations();
 				}
 			}
 			break;
@@ -254,11 +266,13 @@ void StreamingDataReceiveWrapper::NotifyHandJointUpdated(const ps_common::HandJo
 		default: ;
 		}
 	}
+
+	HandRing.Write(HandStaging, FPlatformTime::Seconds());
 }
 
 void StreamingDataReceiveWrapper::NotifyBodyJointsUpdated(const ps_common::BodyJointLocations& body_joints)
 {
-	FMemory::Memcpy(&BodyLocations, &body_joints, sizeof(ps_common::BodyJointLocations));
+	BodyRing.Write(body_joints, FPlatformTime::Seconds());
 }
 
 void StreamingDataReceiveWrapper::NotifyBodyTrackingState(int32_t status_code, int32_t error_code)
@@ -314,7 +328,9 @@ bool StreamingDataReceiveWrapper::GetStreamingConfig(StreamingConfig& streamingC
 
 bool StreamingDataReceiveWrapper::IsHandTrackingActived(EControllerHand DeviceHand) const
 {
-	return DeviceHand == EControllerHand::Left ? LeftHand_is_active : RightHand_is_active;
+	FPICOXRDPHandSample Sample;
+	HandRing.ReadLatest(Sample);
+	return DeviceHand == EControllerHand::Left ? Sample.Left.is_active : Sample.Right.is_active;
 }
 
 bool StreamingDataReceiveWrapper::IsEyeTrackingActived(EEyeSide Side) const
@@ -324,17 +340,29 @@ bool StreamingDataReceiveWrapper::IsEyeTrackingActived(EEyeSide Side) const
 
 uint32 StreamingDataReceiveWrapper::GetHandJointCount(EControllerHand DeviceHand) const
 {
-	return DeviceHand == EControllerHand::Left ? LeftHand_joint_count : RightHand_joint_count;
+	FPICOXRDPHandSample Sample;
+	HandRing.ReadLatest(Sample);
+	return DeviceHand == EControllerHand::Left ? Sample.Left.joint_count : Sample.Right.joint_count;
 }
 
-TArray<ps_common::HandJointLocation> StreamingDataReceiveWrapper::GetHandJointInfos(EControllerHand DeviceHand) const
+bool StreamingDataReceiveWrapper::GetHandJointLocations(EControllerHand DeviceHand, ps_common::HandJointLocations& OutJointLocations, double Time) const
 {
-	return DeviceHand == EControllerHand::Left ? LeftHand_joint_infos : RightHand_joint_infos;
+	FPICOXRDPHandSample Sample;
+	if (!(Time > 0.0 ? HandRing.ReadNearest(Time, Sample) : HandRing.ReadLatest(Sample)))
+	{
+		return false;
+	}
+
+	const ps_common::HandJointLocations& Hand = DeviceHand == EControllerHand::Left ? Sample.Left : Sample.Right;
+	FMemory::Memcpy(&OutJointLocations, &Hand, sizeof(ps_common::HandJointLocations));
+	return true;
 }
 
 ps_common::HandAimState StreamingDataReceiveWrapper::GetHandAimState(EControllerHand DeviceHand) const
 {
-	return DeviceHand == EControllerHand::Left ? LeftHandAimState : RightHandAimState;
+	FPICOXRDPHandSample Sample;
+	HandRing.ReadLatest(Sample);
+	return DeviceHand == EControllerHand::Left ? Sample.Left.aim_state : Sample.Right.aim_state;
 }
 
 ps_common::EyeTrackingDataPICO StreamingDataReceiveWrapper::GetEyeTrackingDataPICO() const
@@ -342,9 +370,9 @@ ps_common::EyeTrackingDataPICO StreamingDataReceiveWrapper::GetEyeTrackingDataPI
 	return EyeTrackingData;
 }
 
-ps_common::BodyJointLocations StreamingDataReceiveWrapper::GetBodyJointLocations() const
+bool StreamingDataReceiveWrapper::GetBodyJointLocations(ps_common::BodyJointLocations& OutBodyJoints, double Time) const
 {
-	return BodyLocations;
+	return Time > 0.0 ? BodyRing.ReadNearest(Time, OutBodyJoints) : BodyRing.ReadLatest(OutBodyJoints);
 }
 
 bool FPICOXRDPManager::bConnectToServiceSucceed = false;
@@ -557,7 +585,7 @@ bool FPICOXRDPManager::GetBodyTrackingPose(ps_common::BodyJointLocations& body_j
 {
 	if (StreamingDataWrapperPtr && IsStreaming())
 	{
-		body_joints = StreamingDataWrapperPtr->GetBodyJointLocations();
+		return StreamingDataWrapperPtr->GetBodyJointLocations(body_joints);
 	}
 	return false;
 }
@@ -601,11 +629,15 @@ bool FPICOXRDPManager::SendMessage(int SwapChainIndex)
 	LeftViewFrame.image.d3d11_shared_image.shared_handle = LeftDstTextureHandles[SwapChainIndex];
 	RightViewFrame.image.d3d11_shared_image.shared_handle = RightDstTextureHandles[SwapChainIndex];
 
-	LeftViewFrame.position = (StreamingDataWrapperPtr->GetHMDPosition());
-	LeftViewFrame.orientation = (StreamingDataWrapperPtr->GetHMDRotation());
+	// Both views must carry the same head pose
+	FPICOXRDPDevicePoseSample PoseSample;
+	StreamingDataWrapperPtr->GetDevicePoseSample(PoseSample);
+
+	LeftViewFrame.position = PoseSample.HMDPosition;
+	LeftViewFrame.orientation = PoseSample.HMDRotation;
 
-	RightViewFrame.position = (StreamingDataWrapperPtr->GetHMDPosition());
-	RightViewFrame.orientation = (StreamingDataWrapperPtr->GetHMDRotation());
+	RightViewFrame.position = PoseSample.HMDPosition;
+	RightViewFrame.orientation = PoseSample.HMDRotation;
 
 	submit_ViewFrames.Add(LeftViewFrame);
 	submit_ViewFrames.Add(RightViewFrame);
@@ -785,8 +817,10 @@ void FPICOXRDPManager::GetHMDPositionAndRotation(FVector& OutPostion, FQuat& Out
 {
 	if (StreamingDataWrapperPtr)
 	{
-		const ps_common::Vector position = StreamingDataWrapperPtr->GetHMDPosition();
-		const ps_common::Quaternion rotation = StreamingDataWrapperPtr->GetHMDRotation();
+		FPICOXRDPDevicePoseSample PoseSample;
+		StreamingDataWrapperPtr->GetDevicePoseSample(PoseSample);
+		const ps_common::Vector& position = PoseSample.HMDPosition;
+		const ps_common::Quaternion& rotation = PoseSample.HMDRotation;
 		OutPostion.X = position.x();
 		OutPostion.Y = position.y();
 		OutPostion.Z = position.z();
@@ -806,12 +840,14 @@ void FPICOXRDPManager::GetControllerPositionAndRotation(EControllerHand DeviceHa
 {
 	if (StreamingDataWrapperPtr)
 	{
-		const ps_common::Vector ControllerPosition = StreamingDataWrapperPtr->GetControllerPosition(DeviceHand);
+		FPICOXRDPDevicePoseSample PoseSample;
+		StreamingDataWrapperPtr->GetDevicePoseSample(PoseSample);
+		const ps_common::Vector& ControllerPosition = (DeviceHand == EControllerHand::Left) ? PoseSample.LeftPosition : PoseSample.RightPosition;
 		OutPostion.X = -ControllerPosition.z();
 		OutPostion.Y = ControllerPosition.x();
 		OutPostion.Z = ControllerPosition.y();
 		OutPostion = OutPostion * WorldScale;
-		const ps_common::Quaternion ControllerRotation = StreamingDataWrapperPtr->GetControllerRotation(DeviceHand);
+		const ps_common::Quaternion& ControllerRotation = (DeviceHand == EControllerHand::Left) ? PoseSample.LeftRotation : PoseSample.RightRotation;
 		OutQuat = FQuat(ControllerRotation.z(), -ControllerRotation.x(), -ControllerRotation.y(), ControllerRotation.w()).Rotator();
 	}
 	else
@@ -879,13 +915,11 @@ bool FPICOXRDPManager::GetHandTrackerJointLocations(EControllerHand DeviceHand,
 {
 	if (StreamingDataWrapperPtr && IsStreaming())
 	{
-		JointInfos.is_active = StreamingDataWrapperPtr->IsHandTrackingActived(DeviceHand);
-		if (JointInfos.is_active)
+		if (!StreamingDataWrapperPtr->GetHandJointLocations(DeviceHand, JointInfos))
 		{
-			JointInfos.joint_count = StreamingDataWrapperPtr->GetHandJointCount(DeviceHand);
-			JointInfos.side_type = ((DeviceHand == EControllerHand::Left) ? ps_common::SideType::kLeft : ps_common::SideType::kRight);
-			FMemory::Memcpy(JointInfos.joint_locations, StreamingDataWrapperPtr->GetHandJointInfos(DeviceHand).GetData(), sizeof(ps_common::HandJointLocation) * 32);
+			JointInfos.is_active = false;
 		}
+		JointInfos.side_type = ((DeviceHand == EControllerHand::Left) ? ps_common::SideType::kLeft : ps_common::SideType::kRight);
 		return true;
 	}
 	return false;
@@ -1,6 +1,7 @@
 //Unreal® Engine, Copyright 1998 – 2023, Epic Games, Inc. All rights reserved.
 
 #pragma once
+#include <atomic>
 #include "CoreMinimal.h"
 #if PLATFORM_WINDOWS
 #include "D3D11RHIPrivate.h"
@@ -26,6 +27,138 @@ enum class EEyeSide : uint8
 };
 
 
+/**
+ * Fixed size ring of timestamped samples written by the streaming SDK thread and read from any thread.
+ * Every slot is guarded by its own sequence counter (seqlock), so the writer never blocks and readers
+ * retry instead of observing a torn sample. SampleType must be trivially copyable.
+ */
+template<typename SampleType, uint32 Capacity = 8>
+class TPICOXRDPSampleRing
+{
+public:
+	/** Single producer only */
+	void Write(const SampleType& Sample, double Timestamp)
+	{
+		const uint32 Count = WriteCount.load(std::memory_order_relaxed);
+		FSlot& Slot = Slots[Count % Capacity];
+
+		const uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+		Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Slot.Timestamp = Timestamp;
+		FMemory::Memcpy(&Slot.Sample, &Sample, sizeof(SampleType));
+		Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+
+		WriteCount.store(Count + 1, std::memory_order_release);
+	}
+
+	bool ReadLatest(SampleType& OutSample, double* OutTimestamp = nullptr) const
+	{
+		// A slot can only be overwritten by a newer sample, so retrying from the new head always terminates
+		for (;;)
+		{
+			const uint32 Count = WriteCount.load(std::memory_order_acquire);
+			if (Count == 0)
+			{
+				return false;
+			}
+
+			double Timestamp;
+			if (ReadSlot((Count - 1) % Capacity, OutSample, Timestamp))
+			{
+				if (OutTimestamp)
+				{
+					*OutTimestamp = Timestamp;
+				}
+				return true;
+			}
+		}
+	}
+
+	/** Copies the retained sample whose timestamp is closest to Time */
+	bool ReadNearest(double Time, SampleType& OutSample, double* OutTimestamp = nullptr) const
+	{
+		const uint32 Count = WriteCount.load(std::memory_order_acquire);
+		if (Count == 0)
+		{
+			return false;
+		}
+
+		// Walk back from the newest sample while samples get closer to Time, skipping slots being rewritten
+		double BestDelta = TNumericLimits<double>::Max();
+		bool bFound = false;
+		SampleType Candidate;
+		const uint32 NumRetained = FMath::Min(Count, Capacity - 1);
+		for (uint32 Age = 0; Age < NumRetained; ++Age)
+		{
+			double Timestamp;
+			if (!ReadSlot((Count - 1 - Age) % Capacity, Candidate, Timestamp))
+			{
+				continue;
+			}
+
+			const double Delta = FMath::Abs(Timestamp - Time);
+			if (Delta >= BestDelta)
+			{
+				break;
+			}
+
+			BestDelta = Delta;
+			FMemory::Memcpy(&OutSample, &Candidate, sizeof(SampleType));
+			if (OutTimestamp)
+			{
+				*OutTimestamp = Timestamp;
+			}
+			bFound = true;
+		}
+
+		return bFound || ReadLatest(OutSample, OutTimestamp);
+	}
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint32> Sequence{0};
+		double Timestamp = 0.0;
+		SampleType Sample = {};
+	};
+
+	bool ReadSlot(uint32 Index, SampleType& OutSample, double& OutTimestamp) const
+	{
+		const FSlot& Slot = Slots[Index];
+		const uint32 SequenceBefore = Slot.Sequence.load(std::memory_order_acquire);
+		if (SequenceBefore & 1)
+		{
+			return false;
+		}
+
+		OutTimestamp = Slot.Timestamp;
+		FMemory::Memcpy(&OutSample, &Slot.Sample, sizeof(SampleType));
+		std::atomic_thread_fence(std::memory_order_acquire);
+		return Slot.Sequence.load(std::memory_order_relaxed) == SequenceBefore;
+	}
+
+	FSlot Slots[Capacity];
+	std::atomic<uint32> WriteCount{0};
+};
+
+/** HMD and controller poses published together, so a reader never mixes poses from two callbacks */
+struct FPICOXRDPDevicePoseSample
+{
+	ps_common::Vector HMDPosition = {};
+	ps_common::Quaternion HMDRotation = {};
+	ps_common::Vector LeftPosition = {};
+	ps_common::Quaternion LeftRotation = {};
+	ps_common::Vector RightPosition = {};
+	ps_common::Quaternion RightRotation = {};
+};
+
+struct FPICOXRDPHandSample
+{
+	ps_common::HandJointLocations Left = {};
+	ps_common::HandJointLocations Right = {};
+};
+
 class StreamingDataReceiveWrapper : public StreamingDriverInterfaceCallback
 {
 public:
@@ -68,12 +201,16 @@ public:
 	bool IsEyeTrackingActived(EEyeSide Side) const;
 
 	uint32 GetHandJointCount(EControllerHand DeviceHand) const;
-	TArray<ps_common::HandJointLocation> GetHandJointInfos(EControllerHand DeviceHand) const;
+	/** Copies the hand sample nearest to Time (latest when Time is 0) straight into OutJointLocations */
+	bool GetHandJointLocations(EControllerHand DeviceHand, ps_common::HandJointLocations& OutJointLocations, double Time = 0.0) const;
 
 	ps_common::HandAimState GetHandAimState(EControllerHand DeviceHand) const;
 	ps_common::EyeTrackingDataPICO GetEyeTrackingDataPICO() const;
 
-	ps_common::BodyJointLocations GetBodyJointLocations() const;
+	bool GetBodyJointLocations(ps_common::BodyJointLocations& OutBodyJoints, double Time = 0.0) const;
+
+	/** Copies the device pose sample nearest to Time (latest when Time is 0), timestamps are FPlatformTime::Seconds() */
+	bool GetDevicePoseSample(FPICOXRDPDevicePoseSample& OutSample, double Time = 0.0) const;
 
 	FOnDeviceConnectedResultsEvent OnDeviceConnectedResultsEvent;
 	FOnConnectFromServiceEvent OnConnectFromServiceEvent;
@@ -92,12 +229,9 @@ private:
 	ps_common::DeviceFovInfo PDCDeviceFovInfo = {};
 	StreamingConfig PDCStreamingConfig = {};
 
-	ps_common::Vector LeftPosition = {};
-	ps_common::Quaternion LeftRotation = {};
-	ps_common::Vector RightPosition = {};
-	ps_common::Quaternion RightRotation = {};
-	ps_common::Vector HMDPosition = {};
-	ps_common::Quaternion HMDRotation = {};
+	/** Samples are assembled on the SDK thread and published whole through the rings below */
+	FPICOXRDPDevicePoseSample DevicePoseStaging = {};
+	TPICOXRDPSampleRing<FPICOXRDPDevicePoseSample> DevicePoseRing;
 	bool bEyeTrackingDataValid = false;
 	ps_common::EyeTrackingDataPICO EyeTrackingData = {};
 
@@ -113,18 +247,10 @@ private:
 	float RightGripValue = 0.f;
 	int32 RightState = 0;
 
-	bool RightHand_is_active = false;
-	uint32 RightHand_joint_count = 0;
-	TArray<ps_common::HandJointLocation> RightHand_joint_infos;
-
-	bool LeftHand_is_active = false;
-	uint32 LeftHand_joint_count = 0;
-	TArray<ps_common::HandJointLocation> LeftHand_joint_infos;
-
-	ps_common::HandAimState LeftHandAimState = {};
-	ps_common::HandAimState RightHandAimState = {};
+	FPICOXRDPHandSample HandStaging = {};
+	TPICOXRDPSampleRing<FPICOXRDPHandSample> HandRing;
 	
-	ps_common::BodyJointLocations BodyLocations = {};
+	TPICOXRDPSampleRing<ps_common::BodyJointLocations, 4> BodyRing;
 };
 
 struct FPICOXRFrustumDP;
@@ -6,11 +6,164 @@
 #include "XRThreadUtils.h"
 #include "PXR_Log.h"
 #include "PXR_HMDModule.h"
+#include "PXR_HMDPrivateRHI.h"
+#include "HAL/IConsoleManager.h"
 
 uint32 GPICOHMDLayerDeletionFrameNumber = 0;
 const uint32 NUM_FRAMES_TO_WAIT_FOR_LAYER_DELETE = 3;
 const uint32 NUM_FRAMES_TO_WAIT_FOR_PXR_LAYER_DELETE = 7;
 
+static TAutoConsoleVariable<int32> CVarPICOLayerPoolBudgetMB(
+	TEXT("r.Mobile.PICO.LayerPoolBudgetMB"),
+	0,
+	TEXT("Memory budget in MB for released stereo layer swapchains kept for reuse, 0 disables the pool (Default 0)\n"),
+	ECVF_RenderThreadSafe);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hits"), STAT_PICOLayerPool_Hits, STATGROUP_PICOLayerPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Misses"), STAT_PICOLayerPool_Misses, STATGROUP_PICOLayerPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Evictions"), STAT_PICOLayerPool_Evictions, STATGROUP_PICOLayerPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Parked Layers"), STAT_PICOLayerPool_Parked, STATGROUP_PICOLayerPool);
+DECLARE_MEMORY_STAT(TEXT("Parked Memory"), STAT_PICOLayerPool_ParkedMemory, STATGROUP_PICOLayerPool);
+
+static uint64 GetBytesPerPixel(uint64 Format)
+{
+#if PICO_HMD_SUPPORTED_PLATFORMS_VULKAN
+	switch (Format)
+	{
+	case VK_FORMAT_R8_UNORM:
+		return 1;
+	case VK_FORMAT_R8G8_UNORM:
+	case VK_FORMAT_R5G6B5_UNORM_PACK16:
+		return 2;
+	case VK_FORMAT_R16G16B16A16_SFLOAT:
+		return 8;
+	case VK_FORMAT_R32G32B32A32_SFLOAT:
+		return 16;
+	default:
+		break;
+	}
+#endif
+	// RGBA8, BGRA8 and the packed 32 bit formats, also what the runtime creates when no format is set
+	return 4;
+}
+
+static bool IsSameLayerParam(const PxrLayerParam& A, const PxrLayerParam& B)
+{
+	return A.layerShape == B.layerShape &&
+		A.layerType == B.layerType &&
+		A.layerLayout == B.layerLayout &&
+		A.format == B.format &&
+		A.width == B.width &&
+		A.height == B.height &&
+		A.sampleCount == B.sampleCount &&
+		A.faceCount == B.faceCount &&
+		A.arraySize == B.arraySize &&
+		A.mipmapCount == B.mipmapCount &&
+		A.layerFlags == B.layerFlags;
+}
+
+FPICOPooledLayerPtr FPICOSwapChainPool::Acquire(const PxrLayerParam& CreateParam)
+{
+	check(IsInRenderingThread());
+
+	if (CVarPICOLayerPoolBudgetMB.GetValueOnRenderThread() <= 0)
+	{
+		return nullptr;
+	}
+
+	// Most recently parked first, it is the most likely to still be resident
+	for (int32 Index = ParkedLayers.Num() - 1; Index >= 0; --Index)
+	{
+		if (IsSameLayerParam(ParkedLayers[Index]->CreateParam, CreateParam))
+		{
+			FPICOPooledLayerPtr PooledLayer = ParkedLayers[Index];
+			ParkedLayers.RemoveAt(Index, 1, false);
+			Stats.ParkedMemorySize -= PooledLayer->MemorySize;
+			++Stats.Hits;
+			PublishStats();
+			return PooledLayer;
+		}
+	}
+
+	++Stats.Misses;
+	PublishStats();
+	return nullptr;
+}
+
+void FPICOSwapChainPool::Park(const FPICOPooledLayerPtr& PooledLayer)
+{
+	check(IsInRenderingThread());
+
+	const uint64 BudgetSize = (uint64)FMath::Max(CVarPICOLayerPoolBudgetMB.GetValueOnRenderThread(), 0) * 1024 * 1024;
+	if (PooledLayer->MemorySize > BudgetSize)
+	{
+		DestroyPxrLayer(PooledLayer->PxrLayerId);
+		return;
+	}
+
+	TrimToBudget(BudgetSize - PooledLayer->MemorySize);
+	ParkedLayers.Add(PooledLayer);
+	Stats.ParkedMemorySize += PooledLayer->MemorySize;
+	PublishStats();
+}
+
+void FPICOSwapChainPool::Flush()
+{
+	check(IsInRenderingThread());
+
+	if (ParkedLayers.Num() > 0 || Stats.Hits > 0)
+	{
+		PXR_LOGI(PxrUnreal, "Layer pool flushed, Parked:%d, Hits:%u, Misses:%u, Evictions:%u", ParkedLayers.Num(), Stats.Hits, Stats.Misses, Stats.Evictions);
+	}
+	TrimToBudget(0);
+	PublishStats();
+}
+
+void FPICOSwapChainPool::TrimToBudget(uint64 BudgetSize)
+{
+	int32 NumEvicted = 0;
+	while (NumEvicted < ParkedLayers.Num() && Stats.ParkedMemorySize > BudgetSize)
+	{
+		const FPICOPooledLayerPtr& PooledLayer = ParkedLayers[NumEvicted++];
+		Stats.ParkedMemorySize -= PooledLayer->MemorySize;
+		++Stats.Evictions;
+		DestroyPxrLayer(PooledLayer->PxrLayerId);
+	}
+	ParkedLayers.RemoveAt(0, NumEvicted, false);
+}
+
+void FPICOSwapChainPool::PublishStats() const
+{
+	SET_DWORD_STAT(STAT_PICOLayerPool_Hits, Stats.Hits);
+	SET_DWORD_STAT(STAT_PICOLayerPool_Misses, Stats.Misses);
+	SET_DWORD_STAT(STAT_PICOLayerPool_Evictions, Stats.Evictions);
+	SET_DWORD_STAT(STAT_PICOLayerPool_Parked, ParkedLayers.Num());
+	SET_MEMORY_STAT(STAT_PICOLayerPool_ParkedMemory, Stats.ParkedMemorySize);
+}
+
+uint64 FPICOSwapChainPool::GetMemorySize(const PxrLayerParam& CreateParam, uint32 NumImages)
+{
+	const uint64 BytesPerPixel = GetBytesPerPixel(CreateParam.format);
+	uint64 ImageSize = 0;
+	for (uint32 MipIndex = 0; MipIndex < FMath::Max(CreateParam.mipmapCount, 1u); ++MipIndex)
+	{
+		ImageSize += (uint64)FMath::Max(CreateParam.width >> MipIndex, 1u) * FMath::Max(CreateParam.height >> MipIndex, 1u) * BytesPerPixel;
+	}
+	ImageSize *= FMath::Max(CreateParam.faceCount, 1u) * FMath::Max(CreateParam.arraySize, 1u) * FMath::Max(CreateParam.sampleCount, 1u);
+	return ImageSize * NumImages;
+}
+
+void FPICOSwapChainPool::DestroyPxrLayer(uint32 PxrLayerId)
+{
+	ExecuteOnRHIThread_DoNotWait([PxrLayerId]()
+	{
+		PXR_LOGI(PxrUnreal, "Destroying pooled PxrLayerID:%d", PxrLayerId);
+#if PLATFORM_ANDROID
+		FPICOXRHMDModule::GetPluginWrapper().DestroyLayer(PxrLayerId);
+#endif
+	});
+}
+
 void FDelayDeleteLayerManager::AddLayerToDeferredDeletionQueue(const FPICOLayerPtr& ptr)
 {
 	DelayDeleteLayerEntry Entry;
@@ -24,11 +177,12 @@ void FDelayDeleteLayerManager::AddLayerToDeferredDeletionQueue(const FPICOLayerP
 	DeferredDeletionArray.Add(Entry);
 }
 
-void FDelayDeleteLayerManager::AddPxrLayerToDeferredDeletionQueue(const uint32 ID, const uint32 layerID)
+void FDelayDeleteLayerManager::AddPxrLayerToDeferredDeletionQueue(const uint32 ID, const uint32 layerID, const FPICOPooledLayerPtr& PooledLayer)
 {
 	DelayDeleteLayerEntry Entry;
 	Entry.ID = ID;
 	Entry.PxrLayerId = layerID;
+	Entry.PooledLayer = PooledLayer;
 	Entry.FrameEnqueued = GPICOHMDLayerDeletionFrameNumber;
 	Entry.EntryType = DelayDeleteLayerEntry::DelayDeleteLayerEntryType::PxrLayer;
 	DeferredDeletionArray.Add(Entry);
@@ -49,7 +203,12 @@ void FDelayDeleteLayerManager::HandleLayerDeferredDeletionQueue_RenderThread(boo
 		}
 		else if (Entry->EntryType == DelayDeleteLayerEntry::DelayDeleteLayerEntryType::PxrLayer)
 		{
-			if (bDeleteImmediately || GPICOHMDLayerDeletionFrameNumber > Entry->FrameEnqueued + NUM_FRAMES_TO_WAIT_FOR_PXR_LAYER_DELETE)
+			if (!bDeleteImmediately && Entry->PooledLayer.IsValid() && GPICOHMDLayerDeletionFrameNumber > Entry->FrameEnqueued + NUM_FRAMES_TO_WAIT_FOR_PXR_LAYER_DELETE)
+			{
+				SwapChainPool.Park(Entry->PooledLayer);
+				DeferredDeletionArray.RemoveAtSwap(Index, 1, false);
+			}
+			else if (bDeleteImmediately || GPICOHMDLayerDeletionFrameNumber > Entry->FrameEnqueued + NUM_FRAMES_TO_WAIT_FOR_PXR_LAYER_DELETE)
 			{
 				ExecuteOnRHIThread_DoNotWait([ID = Entry->ID, PxrLayerId = Entry->PxrLayerId]()
 				{
@@ -64,5 +223,10 @@ void FDelayDeleteLayerManager::HandleLayerDeferredDeletionQueue_RenderThread(boo
 
 	}
 
+	if (bDeleteImmediately)
+	{
+		SwapChainPool.Flush();
+	}
+
 	++GPICOHMDLayerDeletionFrameNumber;
 }
\ No newline at end of file
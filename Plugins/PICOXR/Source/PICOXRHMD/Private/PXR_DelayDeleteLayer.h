@@ -4,13 +4,55 @@
 
 #pragma once
 #include "PXR_StereoLayer.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("PICOLayerPool"), STATGROUP_PICOLayerPool, STATCAT_Advanced);
+
+/**
+ * Runtime layers released by stereo layers, parked once their deletion delay is over and handed out again to layers
+ * created with the same parameters. The least recently parked ones are destroyed when r.Mobile.PICO.LayerPoolBudgetMB is exceeded.
+ * Render thread only, the stats are published to the PICOLayerPool stat group ("stat PICOLayerPool").
+ */
+class FPICOSwapChainPool
+{
+public:
+	struct FStats
+	{
+		uint32 Hits = 0;
+		uint32 Misses = 0;
+		uint32 Evictions = 0;
+		uint64 ParkedMemorySize = 0;
+	};
+
+	/** Removes and returns a parked layer created with the same parameters, if any */
+	FPICOPooledLayerPtr Acquire(const PxrLayerParam& CreateParam);
+	void Park(const FPICOPooledLayerPtr& PooledLayer);
+	/** Destroys all parked layers */
+	void Flush();
+
+	const FStats& GetStats() const { return Stats; }
+	int32 GetNumParked() const { return ParkedLayers.Num(); }
+
+	/** Size of NumImages swapchain images created with CreateParam, from their format, dimensions, samples and mip chain */
+	static uint64 GetMemorySize(const PxrLayerParam& CreateParam, uint32 NumImages);
+
+private:
+	void TrimToBudget(uint64 BudgetSize);
+	void PublishStats() const;
+	static void DestroyPxrLayer(uint32 PxrLayerId);
+
+	/** Least recently parked first */
+	TArray<FPICOPooledLayerPtr> ParkedLayers;
+	FStats Stats;
+};
 
 class FDelayDeleteLayerManager
 {
 public:
 	void AddLayerToDeferredDeletionQueue(const FPICOLayerPtr& ptr);
-	void AddPxrLayerToDeferredDeletionQueue(const uint32 ID, const uint32 layerID);
+	void AddPxrLayerToDeferredDeletionQueue(const uint32 ID, const uint32 layerID, const FPICOPooledLayerPtr& PooledLayer = nullptr);
 	void HandleLayerDeferredDeletionQueue_RenderThread(bool bDeleteImmediately = false);
+	FPICOSwapChainPool& GetSwapChainPool() { return SwapChainPool; }
 
 private:
 	struct DelayDeleteLayerEntry
@@ -24,10 +66,13 @@ private:
 		FPICOLayerPtr Layer;
 		uint32 ID;
 		uint32 PxrLayerId;
+		/** Parked in the swapchain pool instead of destroyed if set */
+		FPICOPooledLayerPtr PooledLayer;
 		
 		uint32 FrameEnqueued;
 		DelayDeleteLayerEntryType EntryType;
 	};
 
 	TArray<DelayDeleteLayerEntry> DeferredDeletionArray;
+	FPICOSwapChainPool SwapChainPool;
 };
\ No newline at end of file
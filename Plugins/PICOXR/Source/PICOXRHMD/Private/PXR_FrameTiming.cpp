@@ -0,0 +1,205 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc. in the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2023, Epic Games, Inc. All rights reserved.
+
+#include "PXR_FrameTiming.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PXR_Log.h"
+#include "PXR_HMDModule.h"
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Game Thread (ms)"), STAT_PICOFrame_GameThread, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Wait Frame (ms)"), STAT_PICOFrame_WaitFrame, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Render To RHI (ms)"), STAT_PICOFrame_RenderToRHI, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Begin Frame (ms)"), STAT_PICOFrame_BeginFrame, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Submit And End Frame (ms)"), STAT_PICOFrame_Submit, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Latency (ms)"), STAT_PICOFrame_Latency, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Late Latch Delta (ms)"), STAT_PICOFrame_LateLatchDelta, STATGROUP_PICOTiming);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Display Interval (ms)"), STAT_PICOFrame_DisplayInterval, STATGROUP_PICOTiming);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Missed Vsyncs"), STAT_PICOFrame_MissedVsyncs, STATGROUP_PICOTiming);
+
+static const TCHAR* const PICOFrameStageNames[] =
+{
+	TEXT("GameFrameBegin"),
+	TEXT("WaitFrameBegin"),
+	TEXT("WaitFrameEnd"),
+	TEXT("PoseSampled"),
+	TEXT("RenderFrameBegin"),
+	TEXT("LateLatch"),
+	TEXT("RHIBeginFrameBegin"),
+	TEXT("RHIBeginFrameEnd"),
+	TEXT("RHISubmitBegin"),
+	TEXT("RHIEndFrameEnd"),
+};
+static_assert(UE_ARRAY_COUNT(PICOFrameStageNames) == (int32)EPICOFrameStage::Num, "Every frame stage needs a name");
+
+static FAutoConsoleCommand PICODumpFrameTimingsCommand(
+	TEXT("PICO.DumpFrameTimings"),
+	TEXT("Writes the timings of the latest frames to Saved/Profiling/PICO, or to the file given as argument"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const FString Filename = Args.Num() > 0 ? Args[0] : FPaths::ProfilingDir() / TEXT("PICO") / FString::Printf(TEXT("FrameTimings_%s.csv"), *FDateTime::Now().ToString());
+		if (FPICOFrameTimingRecorder::Get().WriteCsv(Filename))
+		{
+			PXR_LOGI(PxrUnreal, "Frame timings written to %s", PLATFORM_CHAR(*Filename));
+		}
+		else
+		{
+			PXR_LOGE(PxrUnreal, "Failed to write frame timings to %s", PLATFORM_CHAR(*Filename));
+		}
+	}));
+
+FPICOFrameTimingRecorder& FPICOFrameTimingRecorder::Get()
+{
+	static FPICOFrameTimingRecorder Recorder;
+	return Recorder;
+}
+
+FPICOFrameTimingRecorder::FSlot* FPICOFrameTimingRecorder::FindSlot(uint32 FrameNumber)
+{
+	FSlot& Slot = Slots[FrameNumber % Capacity];
+	return Slot.FrameNumber.load(std::memory_order_relaxed) == FrameNumber ? &Slot : nullptr;
+}
+
+void FPICOFrameTimingRecorder::BeginFrame(uint32 FrameNumber, double Time)
+{
+	FSlot& Slot = Slots[FrameNumber % Capacity];
+	Slot.bCompleted.store(false, std::memory_order_relaxed);
+	Slot.FrameNumber.store(FrameNumber, std::memory_order_relaxed);
+	for (std::atomic<double>& StageTime : Slot.StageTimes)
+	{
+		StageTime.store(0.0, std::memory_order_relaxed);
+	}
+	Slot.StageTimes[(int32)EPICOFrameStage::GameFrameBegin].store(Time, std::memory_order_relaxed);
+	Slot.PredictedDisplayTimeMs.store(0.0, std::memory_order_relaxed);
+	Slot.DisplayIntervalMs.store(0.0, std::memory_order_relaxed);
+	Slot.MissedVsyncs.store(0, std::memory_order_relaxed);
+}
+
+void FPICOFrameTimingRecorder::MarkStage(uint32 FrameNumber, EPICOFrameStage Stage, double Time)
+{
+	if (FSlot* Slot = FindSlot(FrameNumber))
+	{
+		Slot->StageTimes[(int32)Stage].store(Time, std::memory_order_relaxed);
+	}
+}
+
+void FPICOFrameTimingRecorder::SetPredictedDisplayTime(uint32 FrameNumber, double PredictedDisplayTimeMs)
+{
+	if (FSlot* Slot = FindSlot(FrameNumber))
+	{
+		Slot->PredictedDisplayTimeMs.store(PredictedDisplayTimeMs, std::memory_order_relaxed);
+	}
+}
+
+void FPICOFrameTimingRecorder::CompleteFrame(uint32 FrameNumber, double DisplayRefreshRate)
+{
+	FSlot* Slot = FindSlot(FrameNumber);
+	if (!Slot)
+	{
+		return;
+	}
+
+	const double PredictedDisplayTimeMs = Slot->PredictedDisplayTimeMs.load(std::memory_order_relaxed);
+	if (PreviousCompletedFrame + 1 == FrameNumber && PreviousPredictedDisplayTimeMs > 0.0 && PredictedDisplayTimeMs > 0.0)
+	{
+		// The runtime reports no actual display time, a frame predicted more than one refresh period after its predecessor missed vsyncs
+		const double DisplayIntervalMs = PredictedDisplayTimeMs - PreviousPredictedDisplayTimeMs;
+		Slot->DisplayIntervalMs.store(DisplayIntervalMs, std::memory_order_relaxed);
+		if (DisplayRefreshRate > 0.0)
+		{
+			const int32 Periods = FMath::RoundToInt(DisplayIntervalMs * DisplayRefreshRate / 1000.0);
+			Slot->MissedVsyncs.store(FMath::Max(Periods - 1, 0), std::memory_order_relaxed);
+		}
+	}
+	PreviousCompletedFrame = FrameNumber;
+	PreviousPredictedDisplayTimeMs = PredictedDisplayTimeMs;
+
+	Slot->bCompleted.store(true, std::memory_order_release);
+	LatestCompletedFrame.store(FrameNumber, std::memory_order_release);
+}
+
+bool FPICOFrameTimingRecorder::ReadSlot(uint32 FrameNumber, FPICOFrameTiming& OutTiming) const
+{
+	const FSlot& Slot = Slots[FrameNumber % Capacity];
+	if (Slot.FrameNumber.load(std::memory_order_relaxed) != FrameNumber || !Slot.bCompleted.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	OutTiming.FrameNumber = FrameNumber;
+	for (int32 StageIndex = 0; StageIndex < (int32)EPICOFrameStage::Num; ++StageIndex)
+	{
+		OutTiming.StageTimes[StageIndex] = Slot.StageTimes[StageIndex].load(std::memory_order_relaxed);
+	}
+	OutTiming.PredictedDisplayTimeMs = Slot.PredictedDisplayTimeMs.load(std::memory_order_relaxed);
+	OutTiming.DisplayIntervalMs = Slot.DisplayIntervalMs.load(std::memory_order_relaxed);
+	OutTiming.MissedVsyncs = Slot.MissedVsyncs.load(std::memory_order_relaxed);
+	return true;
+}
+
+int32 FPICOFrameTimingRecorder::GetCompletedFrames(TArray<FPICOFrameTiming>& OutFrames, int32 MaxFrames) const
+{
+	OutFrames.Reset();
+	const uint32 LatestFrame = LatestCompletedFrame.load(std::memory_order_acquire);
+	const uint32 NumFrames = FMath::Min<uint32>(FMath::Min<uint32>(FMath::Max(MaxFrames, 0), Capacity / 2), LatestFrame);
+
+	for (uint32 FrameNumber = LatestFrame - NumFrames + 1; FrameNumber <= LatestFrame; ++FrameNumber)
+	{
+		FPICOFrameTiming Timing;
+		if (ReadSlot(FrameNumber, Timing))
+		{
+			OutFrames.Add(Timing);
+		}
+	}
+	return OutFrames.Num();
+}
+
+void FPICOFrameTimingRecorder::UpdateStats() const
+{
+#if STATS
+	FPICOFrameTiming Timing;
+	if (!ReadSlot(LatestCompletedFrame.load(std::memory_order_acquire), Timing))
+	{
+		return;
+	}
+
+	SET_FLOAT_STAT(STAT_PICOFrame_GameThread, Timing.GetStageDeltaMs(EPICOFrameStage::GameFrameBegin, EPICOFrameStage::RenderFrameBegin));
+	SET_FLOAT_STAT(STAT_PICOFrame_WaitFrame, Timing.GetStageDeltaMs(EPICOFrameStage::WaitFrameBegin, EPICOFrameStage::WaitFrameEnd));
+	SET_FLOAT_STAT(STAT_PICOFrame_RenderToRHI, Timing.GetStageDeltaMs(EPICOFrameStage::RenderFrameBegin, EPICOFrameStage::RHIBeginFrameBegin));
+	SET_FLOAT_STAT(STAT_PICOFrame_BeginFrame, Timing.GetStageDeltaMs(EPICOFrameStage::RHIBeginFrameBegin, EPICOFrameStage::RHIBeginFrameEnd));
+	SET_FLOAT_STAT(STAT_PICOFrame_Submit, Timing.GetStageDeltaMs(EPICOFrameStage::RHISubmitBegin, EPICOFrameStage::RHIEndFrameEnd));
+	SET_FLOAT_STAT(STAT_PICOFrame_Latency, Timing.GetStageDeltaMs(EPICOFrameStage::GameFrameBegin, EPICOFrameStage::RHIEndFrameEnd));
+	SET_FLOAT_STAT(STAT_PICOFrame_LateLatchDelta, Timing.GetStageDeltaMs(EPICOFrameStage::PoseSampled, EPICOFrameStage::LateLatch));
+	SET_FLOAT_STAT(STAT_PICOFrame_DisplayInterval, Timing.DisplayIntervalMs);
+	SET_DWORD_STAT(STAT_PICOFrame_MissedVsyncs, Timing.MissedVsyncs);
+#endif
+}
+
+bool FPICOFrameTimingRecorder::WriteCsv(const FString& Filename) const
+{
+	TArray<FPICOFrameTiming> Frames;
+	GetCompletedFrames(Frames);
+
+	// Stage times are in milliseconds since the game frame began
+	FString Csv = TEXT("FrameNumber");
+	for (const TCHAR* StageName : PICOFrameStageNames)
+	{
+		Csv += FString::Printf(TEXT(",%sMs"), StageName);
+	}
+	Csv += TEXT(",PredictedDisplayTimeMs,DisplayIntervalMs,MissedVsyncs,LateLatchDeltaMs\n");
+
+	for (const FPICOFrameTiming& Timing : Frames)
+	{
+		Csv += FString::Printf(TEXT("%u"), Timing.FrameNumber);
+		for (int32 StageIndex = 0; StageIndex < (int32)EPICOFrameStage::Num; ++StageIndex)
+		{
+			Csv += FString::Printf(TEXT(",%.3f"), Timing.GetStageDeltaMs(EPICOFrameStage::GameFrameBegin, (EPICOFrameStage)StageIndex));
+		}
+		Csv += FString::Printf(TEXT(",%.3f,%.3f,%d,%.3f\n"), Timing.PredictedDisplayTimeMs, Timing.DisplayIntervalMs, Timing.MissedVsyncs,
+			Timing.GetStageDeltaMs(EPICOFrameStage::PoseSampled, EPICOFrameStage::LateLatch));
+	}
+
+	return FFileHelper::SaveStringToFile(Csv, *Filename);
+}
@@ -0,0 +1,97 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc. in the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2023, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("PICOTiming"), STATGROUP_PICOTiming, STATCAT_Advanced);
+
+/** Points of the frame loop that get a timestamp, in the order a frame passes them */
+enum class EPICOFrameStage : uint8
+{
+	GameFrameBegin,
+	WaitFrameBegin,
+	WaitFrameEnd,
+	/** Pose read on the game thread */
+	PoseSampled,
+	/** Frame handed to the render thread */
+	RenderFrameBegin,
+	/** Pose read again on the render thread */
+	LateLatch,
+	RHIBeginFrameBegin,
+	RHIBeginFrameEnd,
+	RHISubmitBegin,
+	RHIEndFrameEnd,
+	Num
+};
+
+/** Timing of one completed frame. Stage times are FPlatformTime::Seconds, 0 for stages the frame skipped */
+struct FPICOFrameTiming
+{
+	uint32 FrameNumber = 0;
+	double StageTimes[(int32)EPICOFrameStage::Num] = {};
+	double PredictedDisplayTimeMs = 0.0;
+	/** Predicted display time since the previous frame, 0 if that frame was not completed */
+	double DisplayIntervalMs = 0.0;
+	/** Refresh periods the display interval exceeds one by */
+	int32 MissedVsyncs = 0;
+
+	/** Milliseconds from stage From to stage To, 0 if the frame skipped either */
+	double GetStageDeltaMs(EPICOFrameStage From, EPICOFrameStage To) const
+	{
+		const double FromTime = StageTimes[(int32)From];
+		const double ToTime = StageTimes[(int32)To];
+		return FromTime > 0.0 && ToTime > 0.0 ? (ToTime - FromTime) * 1000.0 : 0.0;
+	}
+};
+
+/**
+ * Per frame stage timestamps of the XR frame loop, kept in a ring of the latest frames.
+ * Each stage is written by the thread that runs it without locking. A frame is readable once the RHI thread completes it,
+ * readers only look at the latest half of the ring so that the frames in flight never overwrite what they copy.
+ * Shown with "stat PICOTiming", written to a CSV file with PICO.DumpFrameTimings.
+ */
+class FPICOFrameTimingRecorder
+{
+public:
+	static constexpr uint32 Capacity = 256;
+
+	static FPICOFrameTimingRecorder& Get();
+
+	/** Starts the record of a frame, dropping whatever the slot held */
+	void BeginFrame(uint32 FrameNumber, double Time);
+	void MarkStage(uint32 FrameNumber, EPICOFrameStage Stage, double Time);
+	void SetPredictedDisplayTime(uint32 FrameNumber, double PredictedDisplayTimeMs);
+	/** Publishes the frame to readers, RHI thread */
+	void CompleteFrame(uint32 FrameNumber, double DisplayRefreshRate);
+
+	/** Copies up to MaxFrames of the latest completed frames, oldest first */
+	int32 GetCompletedFrames(TArray<FPICOFrameTiming>& OutFrames, int32 MaxFrames = Capacity / 2) const;
+	/** Sets the stats of STATGROUP_PICOTiming from the latest completed frame, game thread */
+	void UpdateStats() const;
+	bool WriteCsv(const FString& Filename) const;
+
+private:
+	struct FSlot
+	{
+		std::atomic<uint32> FrameNumber{0};
+		std::atomic<double> StageTimes[(int32)EPICOFrameStage::Num];
+		std::atomic<double> PredictedDisplayTimeMs{0.0};
+		std::atomic<double> DisplayIntervalMs{0.0};
+		std::atomic<int32> MissedVsyncs{0};
+		std::atomic<bool> bCompleted{false};
+	};
+
+	FSlot* FindSlot(uint32 FrameNumber);
+	bool ReadSlot(uint32 FrameNumber, FPICOFrameTiming& OutTiming) const;
+
+	FSlot Slots[Capacity];
+	/** Frame numbers start at 1, 0 means nothing completed yet */
+	std::atomic<uint32> LatestCompletedFrame{0};
+	/** RHI thread only */
+	uint32 PreviousCompletedFrame = 0;
+	double PreviousPredictedDisplayTimeMs = 0.0;
+};
@@ -14,6 +14,8 @@
 #include "IHeadMountedDisplayVulkanExtensions.h"
 #include "PXR_Log.h"
 #include "PXR_StereoLayer.h"
+#include "PXR_FrameTiming.h"
+#include "Algo/BinarySearch.h"
 #include "PXR_HMDFunctionLibrary.h"
 #include "GameFramework/WorldSettings.h"
 #include "Misc/EngineVersion.h"
@@ -1188,6 +1190,8 @@ void FPICOXRHMD::Shutdown()
 
 	GameSettings.Reset();
 	PXRLayerMap.Reset();
+	PXRPublishedLayers_GameThread.Reset();
+	bPXRLayerSetChanged_GameThread = true;
 }
 
 void FPICOXRHMD::PollEvent()
@@ -1694,11 +1698,14 @@ void FPICOXRHMD::DoSessionShutdown()
 					GameSettings_RHIThread.Reset();
 					GameFrame_RHIThread.Reset();
 					PXRLayers_RHIThread.Reset();
+					PXRSortedLayers_RHIThread.Reset();
+					PXRLayerSnapshotVersion_RHIThread = 0;
 				});
 
 			GameSettings_RenderThread.Reset();
 			GameFrame_GameThread.Reset();
 			PXRLayers_RenderThread.Reset();
+			PXRPublishedLayers_RenderThread.Reset();
 			PXREyeLayer_RenderThread.Reset();
 
 			DelayDeletion.HandleLayerDeferredDeletionQueue_RenderThread(true);
@@ -1707,6 +1714,9 @@ void FPICOXRHMD::DoSessionShutdown()
 	GameFrame_GameThread.Reset();
 	NextGameFrameToRender_GameThread.Reset();
 	LastGameFrameToRender_GameThread.Reset();
+	// Released snapshots must not be carried over into the next session
+	PXRPublishedLayers_GameThread.Reset();
+	bPXRLayerSetChanged_GameThread = true;
 
 	// The Editor may release VR focus in OnEndPlay
 	if (!GIsEditor)
@@ -2194,6 +2204,7 @@ uint32 FPICOXRHMD::CreateLayer(const FLayerDesc& InLayerDesc)
     check(IsInGameThread());
     uint32 LayerId = NextLayerId++;
     PXRLayerMap.Add(LayerId, MakeShareable(new FPICOXRStereoLayer(this, LayerId, InLayerDesc)));
+	bPXRLayerSetChanged_GameThread = true;
 	
 	PXR_LOGD(PxrUnreal, "Layer Create LayerId=%d", LayerId);
 	if (LayerId!=0&&!InLayerDesc.Texture.IsValid())
@@ -2213,6 +2224,7 @@ void FPICOXRHMD::DestroyLayer(uint32 LayerId)
 		(*LayerFound)->DestroyUnderlayMesh();
 	}
 	PXRLayerMap.Remove(LayerId);
+	bPXRLayerSetChanged_GameThread = true;
 }
 
 void FPICOXRHMD::SetLayerDesc(uint32 LayerId, const FLayerDesc& InLayerDesc)
@@ -2246,10 +2258,35 @@ void FPICOXRHMD::MarkTextureForUpdate(uint32 LayerId)
     if (LayerFound)
     {
         (*LayerFound)->MarkTextureForUpdate();
+        (*LayerFound)->MarkTextureChanged();
     }
 	MakeAllStereoLayerComponentsDirty();
 }
 
+bool FPICOXRHMD::SetLayerCopySettings(uint32 LayerId, const FPICOLayerCopySettings& InSettings)
+{
+	check(IsInGameThread());
+	FPICOLayerPtr* LayerFound = PXRLayerMap.Find(LayerId);
+	if (LayerFound)
+	{
+		(*LayerFound)->SetCopySettings(InSettings);
+		return true;
+	}
+	return false;
+}
+
+bool FPICOXRHMD::GetLayerCopyStats(uint32 LayerId, FPICOLayerCopyStats& OutStats) const
+{
+	check(IsInGameThread());
+	const FPICOLayerPtr* LayerFound = PXRLayerMap.Find(LayerId);
+	if (LayerFound)
+	{
+		OutStats = (*LayerFound)->GetCopyStats();
+		return true;
+	}
+	return false;
+}
+
 IStereoLayers::FLayerDesc FPICOXRHMD::GetDebugCanvasLayerDesc(FTextureRHIRef Texture)
 {
  	IStereoLayers::FLayerDesc StereoLayerDesc;
@@ -2469,6 +2506,7 @@ uint32 FPICOXRHMD::CreateMRCStereoLayer(FTextureRHIRef BackgroundRTTexture, FTex
 	PXR_LOGD(PxrUnreal, "MRC Layer Create LayerId=%d", LayerId);
 	CurrentMRCLayer= MakeShareable(new FPICOXRStereoLayer(this, LayerId, StereoLayerDesc));
 	PXRLayerMap.Add(LayerId, CurrentMRCLayer);
+	bPXRLayerSetChanged_GameThread = true;
 	PXRLayerMap[LayerId]->bMRCLayer = true;
 	return LayerId;
 }
@@ -2496,7 +2534,6 @@ void FPICOXRHMD::OnPreLoadMap(const FString& MapName)
 		PICOSplash->OnPreLoadMap(MapName);
 	}
 }
-DECLARE_STATS_GROUP(TEXT("PICOTiming"), STATGROUP_PICOTiming, STATCAT_Advanced);
 DECLARE_CYCLE_STAT(TEXT("WaitFrame"), STAT_WaitFrame, STATGROUP_PICOTiming);
 void FPICOXRHMD::WaitFrame()
 {
@@ -2510,8 +2547,12 @@ void FPICOXRHMD::WaitFrame()
 		{
 			if (bWaitFrameVersion)
 			{
+				FPICOFrameTimingRecorder& FrameTiming = FPICOFrameTimingRecorder::Get();
+				FrameTiming.MarkStage(GameFrame_GameThread->FrameNumber, EPICOFrameStage::WaitFrameBegin, FPlatformTime::Seconds());
 				FPICOXRHMDModule::GetPluginWrapper().WaitFrame();
+				FrameTiming.MarkStage(GameFrame_GameThread->FrameNumber, EPICOFrameStage::WaitFrameEnd, FPlatformTime::Seconds());
 				FPICOXRHMDModule::GetPluginWrapper().GetPredictedDisplayTime(&CurrentFramePredictedTime);
+				FrameTiming.SetPredictedDisplayTime(GameFrame_GameThread->FrameNumber, CurrentFramePredictedTime);
 				GameFrame_GameThread->Flags.bHasWaited = true;
 				GameFrame_GameThread->predictedDisplayTimeMs = CurrentFramePredictedTime;
 				PXR_LOGV(PxrUnreal, "Pxr_GetPredictedDisplayTime after wait frame %u,Time:%f", GameFrame_GameThread->FrameNumber, CurrentFramePredictedTime);
@@ -2541,6 +2582,7 @@ void FPICOXRHMD::LateUpdatePose()
 		if (!CurrentFrame->Flags.bLateUpdateOK)
 		{
 			UpdateSensorValue(GameSettings_RenderThread.Get(), CurrentFrame);
+			FPICOFrameTimingRecorder::Get().MarkStage(CurrentFrame->FrameNumber, EPICOFrameStage::LateLatch, FPlatformTime::Seconds());
 			CurrentFrame->Flags.bLateUpdateOK = true;
 			int32 SubmitViewNumber = CurrentFrame->ViewNumber;
 			ExecuteOnRHIThread_DoNotWait([this, SubmitViewNumber]()
@@ -2570,6 +2612,8 @@ void FPICOXRHMD::LateUpdatePose()
 		 {
 			 GameFrame_GameThread = MakeNewGameFrame();
 			 NextGameFrameToRender_GameThread = GameFrame_GameThread;
+			 FPICOFrameTimingRecorder::Get().UpdateStats();
+			 FPICOFrameTimingRecorder::Get().BeginFrame(GameFrame_GameThread->FrameNumber, FPlatformTime::Seconds());
 			 PXR_LOGV(PxrUnreal, "StartGameFrame %u", GameFrame_GameThread->FrameNumber);
 			 if (!PICOSplash->IsShown())
 			 {
@@ -2579,6 +2623,7 @@ void FPICOXRHMD::LateUpdatePose()
 					 WaitFrame();
 				 }
 				 UpdateSensorValue(GameSettings.Get(), NextGameFrameToRender_GameThread.Get());
+				 FPICOFrameTimingRecorder::Get().MarkStage(NextGameFrameToRender_GameThread->FrameNumber, EPICOFrameStage::PoseSampled, FPlatformTime::Seconds());
 			 }
 		 }
 	 	
@@ -2614,6 +2659,7 @@ void FPICOXRHMD::LateUpdatePose()
 	 {
 		 LastGameFrameToRender_GameThread = NextGameFrameToRender_GameThread;
 		 NextGameFrameToRender_GameThread->Flags.bSplashIsShown = PICOSplash->IsShown();
+		 FPICOFrameTimingRecorder::Get().MarkStage(NextGameFrameToRender_GameThread->FrameNumber, EPICOFrameStage::RenderFrameBegin, FPlatformTime::Seconds());
 
 		 if (NextGameFrameToRender_GameThread->ShowFlags.Rendering && !NextGameFrameToRender_GameThread->Flags.bSplashIsShown)
 		 {
@@ -2622,26 +2668,10 @@ void FPICOXRHMD::LateUpdatePose()
 		 FSettingsPtr PXRSettings = GameSettings->Clone();
 		 FPXRGameFramePtr PXRFrame = NextGameFrameToRender_GameThread->CloneMyself();
 		 PXR_LOGV(PxrUnreal, "OnRenderFrameBegin_GameThread %u has been eaten by render-thread!", NextGameFrameToRender_GameThread->FrameNumber);
-		 TArray<FPICOLayerPtr> PXRLayers;
-
-		 PXRLayers.Empty(PXRLayerMap.Num());
 
-		 for (auto Pair : PXRLayerMap)
-		 {
-			 PXRLayers.Emplace(Pair.Value->CloneMyself());
-
-			 if (Pair.Value->GetPXRLayerDesc().Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE && Pair.Value->GetPXRLayerDesc().Texture.IsValid())
-			 {
-				 Pair.Value->MarkTextureForUpdate(true);
-			 }
-			 else
-			 {
-				 Pair.Value->MarkTextureForUpdate(false);
-			 }
-		 }
-		 PXRLayers.Sort(FPICOLayerPtr_SortById());
+		 PublishLayerSnapshot_GameThread();
 
-		 ExecuteOnRenderThread_DoNotWait([this, PXRSettings, PXRFrame, PXRLayers](FRHICommandListImmediate& RHICmdList)
+		 ExecuteOnRenderThread_DoNotWait([this, PXRSettings, PXRFrame](FRHICommandListImmediate& RHICmdList)
 			 {
 				 if (PXRFrame.IsValid())
 				 {
@@ -2649,9 +2679,16 @@ void FPICOXRHMD::LateUpdatePose()
 				 	
 					 GameFrame_RenderThread = PXRFrame;
 
+					 if (PXRLayerSnapshots_RenderThread.IsDirty())
+					 {
+						 PXRLayerSnapshots_RenderThread.SwapReadBuffers();
+					 }
+					 const TArray<FPICOLayerPtr>& PXRLayers = PXRLayerSnapshots_RenderThread.Read().Layers;
+
 					 int32 PXRLayerIndex_Current = 0;
 					 int32 PXRLastLayerIndex_RenderThread = 0;
-					 TArray<FPICOLayerPtr> ValidXLayers;
+					 TArray<FPICOLayerPtr>& ValidXLayers = PXRLayersScratch_RenderThread;
+					 ValidXLayers.Reset();
 
 					 while (PXRLayerIndex_Current < PXRLayers.Num() && PXRLastLayerIndex_RenderThread < PXRLayers_RenderThread.Num())
 					 {
@@ -2670,6 +2707,14 @@ void FPICOXRHMD::LateUpdatePose()
 						 {
 							 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
 						 }
+						 else if (PXRLayers[PXRLayerIndex_Current] == PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread])
+						 {
+							 // Unchanged since the last snapshot, the layer is already initialized
+							 PXRLayers[PXRLayerIndex_Current]->RefreshTextureUpdate_RenderThread();
+							 ValidXLayers.Add(PXRLayers[PXRLayerIndex_Current]);
+							 PXRLastLayerIndex_RenderThread++;
+							 PXRLayerIndex_Current++;
+						 }
 						 else
 						 {
 							 if (PXRLayers[PXRLayerIndex_Current]->InitPXRLayer_RenderThread(GameSettings_RenderThread.Get(), RenderBridge, &DelayDeletion, RHICmdList, PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread].Get()))
@@ -2695,7 +2740,8 @@ void FPICOXRHMD::LateUpdatePose()
 						 DelayDeletion.AddLayerToDeferredDeletionQueue(PXRLayers_RenderThread[PXRLastLayerIndex_RenderThread++]);
 					 }
 
-					 PXRLayers_RenderThread = ValidXLayers;
+					 Swap(PXRLayers_RenderThread, PXRLayersScratch_RenderThread);
+					 PXRLayersScratch_RenderThread.Reset();
 
 					 DelayDeletion.HandleLayerDeferredDeletionQueue_RenderThread();
 				 }
@@ -2732,29 +2778,40 @@ void FPICOXRHMD::OnRHIFrameBegin_RenderThread()
 	 {
 		 FSettingsPtr PXRSettings = GameSettings_RenderThread->Clone();
 		 FPXRGameFramePtr PXRFrame = GameFrame_RenderThread->CloneMyself();
-		 TArray<FPICOLayerPtr> PXRLayers = PXRLayers_RenderThread;
 
-		 for (int32 XLayerIndex = 0; XLayerIndex < PXRLayers.Num(); XLayerIndex++)
-		 {
-			 PXRLayers[XLayerIndex] = PXRLayers[XLayerIndex]->CloneMyself();
-		 }
-		 ExecuteOnRHIThread_DoNotWait([this, PXRSettings, PXRFrame, PXRLayers]()
+		 PublishLayerSnapshot_RenderThread();
+
+		 ExecuteOnRHIThread_DoNotWait([this, PXRSettings, PXRFrame]()
 			 {
 #if PLATFORM_ANDROID
 				 if (PXRFrame.IsValid())
 				 {
 					 GameSettings_RHIThread = PXRSettings;
 					 GameFrame_RHIThread = PXRFrame;
-					 PXRLayers_RHIThread = PXRLayers;
+					 if (PXRLayerSnapshots_RHIThread.IsDirty())
+					 {
+						 PXRLayerSnapshots_RHIThread.SwapReadBuffers();
+					 }
+					 const FPICOLayerSnapshot& LayerSnapshot = PXRLayerSnapshots_RHIThread.Read();
+					 if (LayerSnapshot.Version != PXRLayerSnapshotVersion_RHIThread)
+					 {
+						 PXRLayerSnapshotVersion_RHIThread = LayerSnapshot.Version;
+						 PXRLayers_RHIThread = LayerSnapshot.Layers;
+						 UpdateSortedLayers_RHIThread(LayerSnapshot.Layers);
+					 }
 					 PXR_LOGV(PxrUnreal, "BeginFrame %u", GameFrame_RHIThread->FrameNumber);
 					 if (GameFrame_RHIThread->ShowFlags.Rendering && !GameFrame_RHIThread->Flags.bSplashIsShown) 
 					 {
 						 if (FPICOXRHMDModule::GetPluginWrapper().IsRunning())
 						 {
+							 FPICOFrameTimingRecorder& FrameTiming = FPICOFrameTimingRecorder::Get();
+							 FrameTiming.MarkStage(GameFrame_RHIThread->FrameNumber, EPICOFrameStage::RHIBeginFrameBegin, FPlatformTime::Seconds());
 							 FPICOXRHMDModule::GetPluginWrapper().BeginFrame();
+							 FrameTiming.MarkStage(GameFrame_RHIThread->FrameNumber, EPICOFrameStage::RHIBeginFrameEnd, FPlatformTime::Seconds());
 							 if (!bWaitFrameVersion)
 							 {
 								 FPICOXRHMDModule::GetPluginWrapper().GetPredictedDisplayTime(&CurrentFramePredictedTime);
+								 FrameTiming.SetPredictedDisplayTime(GameFrame_RHIThread->FrameNumber, CurrentFramePredictedTime);
 								 PXR_LOGV(PxrUnreal, "Pxr_GetPredictedDisplayTime after begin frame:%f", CurrentFramePredictedTime);
 							 }
 							 for (int32 LayerIndex = 0; LayerIndex < PXRLayers_RHIThread.Num(); LayerIndex++)
@@ -2783,10 +2840,11 @@ void FPICOXRHMD::OnRHIFrameBegin_RenderThread()
 			 PLATFORM_CHAR(*(GameFrame_RHIThread->Orientation.Rotator().ToString())), PLATFORM_CHAR(*(GameFrame_RHIThread->Position.ToString())));
 		 if (GameFrame_RHIThread->ShowFlags.Rendering && !GameFrame_RHIThread->Flags.bSplashIsShown)
 		 {
-			 TArray<FPICOLayerPtr> Layers = PXRLayers_RHIThread;
-			 Layers.Sort(FLayerPtr_CompareByAll());
+			 const TArray<FPICOLayerPtr>& Layers = PXRSortedLayers_RHIThread;
 			 if (FPICOXRHMDModule::GetPluginWrapper().IsRunning())
 			 {
+				 FPICOFrameTimingRecorder& FrameTiming = FPICOFrameTimingRecorder::Get();
+				 FrameTiming.MarkStage(GameFrame_RHIThread->FrameNumber, EPICOFrameStage::RHISubmitBegin, FPlatformTime::Seconds());
 				 for (int32 LayerIndex = 0; LayerIndex < Layers.Num(); LayerIndex++)
 				 {
 					 if (Layers[LayerIndex]->IsVisible())
@@ -2795,6 +2853,8 @@ void FPICOXRHMD::OnRHIFrameBegin_RenderThread()
 					 }
 				 }
 				 FPICOXRHMDModule::GetPluginWrapper().EndFrame();
+				 FrameTiming.MarkStage(GameFrame_RHIThread->FrameNumber, EPICOFrameStage::RHIEndFrameEnd, FPlatformTime::Seconds());
+				 FrameTiming.CompleteFrame(GameFrame_RHIThread->FrameNumber, DisplayRefreshRate);
 			 }
 			 else
 			 {
@@ -2806,6 +2866,155 @@ void FPICOXRHMD::OnRHIFrameBegin_RenderThread()
 	 GameFrame_RHIThread.Reset();
  }
 
+ void FPICOXRHMD::PublishLayerSnapshot_GameThread()
+ {
+	 check(IsInGameThread());
+
+	 bool bSnapshotChanged = false;
+
+	 if (bPXRLayerSetChanged_GameThread || PXRPublishedLayers_GameThread.Num() != PXRLayerMap.Num())
+	 {
+		 // Layers were added or removed, rebuild the ID ordered list and keep the clones of the surviving layers
+		 TArray<FPICOPublishedLayer> PublishedLayers;
+		 PublishedLayers.Reserve(PXRLayerMap.Num());
+		 for (const auto& Pair : PXRLayerMap)
+		 {
+			 PublishedLayers.AddDefaulted_GetRef().Source = Pair.Value;
+		 }
+		 PublishedLayers.Sort([](const FPICOPublishedLayer& A, const FPICOPublishedLayer& B) { return A.Source->GetID() < B.Source->GetID(); });
+
+		 int32 OldIndex = 0;
+		 for (FPICOPublishedLayer& Published : PublishedLayers)
+		 {
+			 while (OldIndex < PXRPublishedLayers_GameThread.Num() && PXRPublishedLayers_GameThread[OldIndex].Source->GetID() < Published.Source->GetID())
+			 {
+				 OldIndex++;
+			 }
+			 if (OldIndex < PXRPublishedLayers_GameThread.Num() && PXRPublishedLayers_GameThread[OldIndex].Source == Published.Source)
+			 {
+				 Published = MoveTemp(PXRPublishedLayers_GameThread[OldIndex++]);
+			 }
+		 }
+		 PXRPublishedLayers_GameThread = MoveTemp(PublishedLayers);
+		 bPXRLayerSetChanged_GameThread = false;
+		 bSnapshotChanged = true;
+	 }
+
+	 for (FPICOPublishedLayer& Published : PXRPublishedLayers_GameThread)
+	 {
+		 const FPICOLayerPtr& Layer = PXRLayerMap.FindChecked(Published.Source->GetID());
+		 const bool bLayerChanged = !Published.Snapshot.IsValid() || Published.Source != Layer || Published.Generation != Layer->GetGeneration();
+		 if (bLayerChanged)
+		 {
+			 Published.Source = Layer;
+			 Published.Generation = Layer->GetGeneration();
+			 Published.Snapshot = Layer->CloneMyself();
+			 bSnapshotChanged = true;
+		 }
+
+		 if (Layer->GetPXRLayerDesc().Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE && Layer->GetPXRLayerDesc().Texture.IsValid())
+		 {
+			 Layer->MarkTextureForUpdate(true);
+		 }
+		 else
+		 {
+			 Layer->MarkTextureForUpdate(false);
+		 }
+	 }
+
+	 if (bSnapshotChanged)
+	 {
+		 FPICOLayerSnapshot& Snapshot = PXRLayerSnapshots_RenderThread.GetWriteBuffer();
+		 Snapshot.Version = ++PXRLayerSnapshotVersion_GameThread;
+		 Snapshot.Layers.Reset(PXRPublishedLayers_GameThread.Num());
+		 for (const FPICOPublishedLayer& Published : PXRPublishedLayers_GameThread)
+		 {
+			 Snapshot.Layers.Add(Published.Snapshot);
+		 }
+		 PXRLayerSnapshots_RenderThread.SwapWriteBuffers();
+	 }
+ }
+
+ void FPICOXRHMD::UpdateSortedLayers_RHIThread(const TArray<FPICOLayerPtr>& Layers)
+ {
+	 PXRLayersByID_RHIThread.Reset();
+	 PXRLayersByID_RHIThread.Reserve(Layers.Num());
+	 for (const FPICOLayerPtr& Layer : Layers)
+	 {
+		 PXRLayersByID_RHIThread.Add(Layer->GetID(), Layer);
+	 }
+
+	 // Layers keep their place in the previous order unless their sort key changed, which keeps the kept ones sorted
+	 const FLayerPtr_CompareByAll Compare;
+	 PXRLayersToInsert_RHIThread.Reset();
+	 int32 NumKept = 0;
+	 for (const FPICOLayerPtr& OldLayer : PXRSortedLayers_RHIThread)
+	 {
+		 FPICOLayerPtr NewLayer;
+		 if (!PXRLayersByID_RHIThread.RemoveAndCopyValue(OldLayer->GetID(), NewLayer))
+		 {
+			 continue;
+		 }
+		 if (Compare(OldLayer, NewLayer) || Compare(NewLayer, OldLayer))
+		 {
+			 PXRLayersToInsert_RHIThread.Add(MoveTemp(NewLayer));
+		 }
+		 else
+		 {
+			 PXRSortedLayers_RHIThread[NumKept++] = MoveTemp(NewLayer);
+		 }
+	 }
+	 PXRSortedLayers_RHIThread.SetNum(NumKept, false);
+	 for (TPair<uint32, FPICOLayerPtr>& Pair : PXRLayersByID_RHIThread)
+	 {
+		 PXRLayersToInsert_RHIThread.Add(MoveTemp(Pair.Value));
+	 }
+	 PXRLayersByID_RHIThread.Reset();
+
+	 for (FPICOLayerPtr& Layer : PXRLayersToInsert_RHIThread)
+	 {
+		 const int32 InsertIndex = Algo::UpperBound(PXRSortedLayers_RHIThread, Layer, Compare);
+		 PXRSortedLayers_RHIThread.Insert(MoveTemp(Layer), InsertIndex);
+	 }
+	 PXRLayersToInsert_RHIThread.Reset();
+ }
+
+ void FPICOXRHMD::PublishLayerSnapshot_RenderThread()
+ {
+	 check(IsInRenderingThread());
+
+	 bool bSnapshotChanged = PXRPublishedLayers_RenderThread.Num() != PXRLayers_RenderThread.Num();
+	 PXRPublishedLayers_RenderThread.SetNum(PXRLayers_RenderThread.Num());
+
+	 for (int32 LayerIndex = 0; LayerIndex < PXRLayers_RenderThread.Num(); LayerIndex++)
+	 {
+		 FPICOPublishedLayer& Published = PXRPublishedLayers_RenderThread[LayerIndex];
+		 const FPICOLayerPtr& Layer = PXRLayers_RenderThread[LayerIndex];
+		 // Render thread layers live across frames and RefreshTextureUpdate_RenderThread and PXRLayersCopy_RenderThread
+		 // modify them in place. Those changes only drive the render thread's own copies, so the RHI thread clone may keep
+		 // stale copy state; anything the RHI thread submits must change the layer object or bump its generation.
+		 if (!Published.Snapshot.IsValid() || Published.Source != Layer || Published.Generation != Layer->GetGeneration())
+		 {
+			 Published.Source = Layer;
+			 Published.Generation = Layer->GetGeneration();
+			 Published.Snapshot = Layer->CloneMyself();
+			 bSnapshotChanged = true;
+		 }
+	 }
+
+	 if (bSnapshotChanged)
+	 {
+		 FPICOLayerSnapshot& Snapshot = PXRLayerSnapshots_RHIThread.GetWriteBuffer();
+		 Snapshot.Version = ++PXRLayerSnapshotVersion_RenderThread;
+		 Snapshot.Layers.Reset(PXRPublishedLayers_RenderThread.Num());
+		 for (const FPICOPublishedLayer& Published : PXRPublishedLayers_RenderThread)
+		 {
+			 Snapshot.Layers.Add(Published.Snapshot);
+		 }
+		 PXRLayerSnapshots_RHIThread.SwapWriteBuffers();
+	 }
+ }
+
  FSettingsPtr FPICOXRHMD::CreateNewSettings() const
  {
 	 FSettingsPtr Result(MakeShareable(new FGameSettings()));
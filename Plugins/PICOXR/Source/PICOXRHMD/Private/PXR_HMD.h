@@ -20,6 +20,7 @@
 #include "StereoLayerManager.h"
 #include "PXR_DelayDeleteLayer.h"
 #include "PXR_FoveatedRendering.h"
+#include "Containers/TripleBuffer.h"
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FPICOPollEventDelegate, PxrEventDataBuffer* /*EventData*/);
 
@@ -237,6 +238,9 @@ public:
 	void SetColorScaleAndOffset(FLinearColor ColorScale, FLinearColor ColorOffset, bool bApplyToAllLayers = false);
 	uint32 CreateMRCStereoLayer(FTextureRHIRef BackgroundRTTexture, FTextureRHIRef ForegroundRTTexture);
 	void DestroyMRCLayer();
+	/** How a continuously updated stereo layer copies its texture, returns false for unknown layers */
+	bool SetLayerCopySettings(uint32 LayerId, const FPICOLayerCopySettings& InSettings);
+	bool GetLayerCopyStats(uint32 LayerId, FPICOLayerCopyStats& OutStats) const;
 
 	FString GetRHIString();
 
@@ -251,6 +255,9 @@ public:
 	void OnRenderFrameEnd_RenderThread(FRDGBuilder& RDGBuilder);
 	void OnRHIFrameBegin_RenderThread();
 	void OnRHIFrameEnd_RHIThread();
+	void PublishLayerSnapshot_GameThread();
+	void PublishLayerSnapshot_RenderThread();
+	void UpdateSortedLayers_RHIThread(const TArray<FPICOLayerPtr>& Layers);
 	FSettingsPtr CreateNewSettings() const;
 	FPXRGameFramePtr MakeNewGameFrame() const;
 	void UpdateStereoRenderingParams();
@@ -267,15 +274,32 @@ public:
 	FPXRGameFramePtr LastGameFrameToRender_GameThread;
 	TMap<uint32, FPICOLayerPtr> PXRLayerMap;
 	FPICOLayerPtr CurrentMRCLayer;
+	/** Last published clone of every layer, sorted by ID */
+	TArray<FPICOPublishedLayer> PXRPublishedLayers_GameThread;
+	bool bPXRLayerSetChanged_GameThread = true;
+	uint64 PXRLayerSnapshotVersion_GameThread = 0;
+	// Game thread -> render thread layer handoff
+	TTripleBuffer<FPICOLayerSnapshot> PXRLayerSnapshots_RenderThread;
 	// Render thread
 	FSettingsPtr GameSettings_RenderThread;
 	FPXRGameFramePtr GameFrame_RenderThread;
 	TArray<FPICOLayerPtr> PXRLayers_RenderThread;
+	TArray<FPICOLayerPtr> PXRLayersScratch_RenderThread;
 	FPICOLayerPtr PXREyeLayer_RenderThread;
+	/** Last RHI clone of every render thread layer, in PXRLayers_RenderThread order */
+	TArray<FPICOPublishedLayer> PXRPublishedLayers_RenderThread;
+	uint64 PXRLayerSnapshotVersion_RenderThread = 0;
+	// Render thread -> RHI thread layer handoff
+	TTripleBuffer<FPICOLayerSnapshot> PXRLayerSnapshots_RHIThread;
 	// RHI thread
 	FSettingsPtr GameSettings_RHIThread;
 	FPXRGameFramePtr GameFrame_RHIThread;
 	TArray<FPICOLayerPtr> PXRLayers_RHIThread;
+	/** PXRLayers_RHIThread in submission order, only new layers and layers whose sort position changed are re-inserted */
+	TArray<FPICOLayerPtr> PXRSortedLayers_RHIThread;
+	TMap<uint32, FPICOLayerPtr> PXRLayersByID_RHIThread;
+	TArray<FPICOLayerPtr> PXRLayersToInsert_RHIThread;
+	uint64 PXRLayerSnapshotVersion_RHIThread = 0;
 	double CurrentFramePredictedTime = 0;
 	bool bWaitFrameVersion = false;
 	float CachedWorldToMetersScale = 100.0f;
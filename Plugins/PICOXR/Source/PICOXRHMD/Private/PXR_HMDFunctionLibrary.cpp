@@ -262,6 +262,35 @@ void UPICOXRHMDFunctionLibrary::PXR_SetColorScaleAndOffset(FLinearColor ColorSca
 #endif
 }
 
+bool UPICOXRHMDFunctionLibrary::PXR_SetLayerCopySettings(int32 LayerId, const FPICOXRLayerCopySettings& Settings)
+{
+	FPICOXRHMD* PICOXRHMDInstance = GetPICOXRHMD();
+	if (PICOXRHMDInstance == nullptr)
+	{
+		return false;
+	}
+	FPICOLayerCopySettings CopySettings;
+	CopySettings.bCopyOnlyWhenMarked = Settings.bCopyOnlyWhenMarked;
+	CopySettings.MaxCopyRate = FMath::Max(Settings.MaxCopyRate, 0.0f);
+	CopySettings.DirtyRect = FIntRect(Settings.DirtyRectMin, Settings.DirtyRectMax);
+	return PICOXRHMDInstance->SetLayerCopySettings(static_cast<uint32>(LayerId), CopySettings);
+}
+
+bool UPICOXRHMDFunctionLibrary::PXR_GetLayerCopyStats(int32 LayerId, FPICOXRLayerCopyStats& OutStats)
+{
+	const FPICOXRHMD* PICOXRHMDInstance = GetPICOXRHMD();
+	FPICOLayerCopyStats CopyStats;
+	if (PICOXRHMDInstance == nullptr || !PICOXRHMDInstance->GetLayerCopyStats(static_cast<uint32>(LayerId), CopyStats))
+	{
+		return false;
+	}
+	OutStats.NumCopies = static_cast<int32>(CopyStats.NumCopies);
+	OutStats.NumPartialCopies = static_cast<int32>(CopyStats.NumPartialCopies);
+	OutStats.NumSkippedUnchanged = static_cast<int32>(CopyStats.NumSkippedUnchanged);
+	OutStats.NumSkippedRateLimited = static_cast<int32>(CopyStats.NumSkippedRateLimited);
+	return true;
+}
+
 bool UPICOXRHMDFunctionLibrary::GetFocusState()
 {
 #if PLATFORM_ANDROID
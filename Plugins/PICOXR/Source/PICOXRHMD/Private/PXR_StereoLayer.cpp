@@ -16,6 +16,7 @@
 #include "Materials/MaterialInstanceDynamic.h"
 #include "XRThreadUtils.h"
 #include "PXR_GameFrame.h"
+#include "PXR_UnderlayMeshCache.h"
 
 FPxrLayer::FPxrLayer(uint32 ID, uint32 InPxrLayerId, FDelayDeleteLayerManager* InDelayDeletion) :
 	ID(ID),
@@ -28,14 +29,14 @@ FPxrLayer::~FPxrLayer()
 {
 	if (IsInGameThread())
 	{
-		ExecuteOnRenderThread([ID = this->ID, PxrLayerId = this->PxrLayerId, DelayDeletion = this->DelayDeletion]()
+		ExecuteOnRenderThread([ID = this->ID, PxrLayerId = this->PxrLayerId, DelayDeletion = this->DelayDeletion, PooledLayer = this->PooledLayer]()
 		{
-			DelayDeletion->AddPxrLayerToDeferredDeletionQueue(ID, PxrLayerId);
+			DelayDeletion->AddPxrLayerToDeferredDeletionQueue(ID, PxrLayerId, PooledLayer);
 		});
 	}
 	else
 	{
-		DelayDeletion->AddPxrLayerToDeferredDeletionQueue(ID, PxrLayerId);
+		DelayDeletion->AddPxrLayerToDeferredDeletionQueue(ID, PxrLayerId, PooledLayer);
 	}
 }
 
@@ -51,12 +52,17 @@ FPICOXRStereoLayer::FPICOXRStereoLayer(FPICOXRHMD* InHMDDevice, uint32 InPXRLaye
 	, bNeedsTexSrgbCreate(false)
     , HMDDevice(InHMDDevice)
 	, ID(InPXRLayerId)
+	, Generation(0)
 	, PxrLayerID(0)
     , bTextureNeedUpdate(false)
+	, TextureUpdateCount(0)
+	, CopyState(MakeShared<FPICOLayerCopyState, ESPMode::ThreadSafe>())
     , UnderlayMeshComponent(NULL)
     , UnderlayActor(NULL)
     , PxrLayer(nullptr)
 	, TrackingMode(PXR_TRACKING_MODE_POSITION_BIT)
+	, bCachedSubmitIsLayer2(false)
+	, bHasCachedSubmit(false)
 {
     PXR_LOGD(PxrUnreal, "FPICOXRStereoLayer with ID=%d", ID);
 
@@ -74,16 +80,22 @@ FPICOXRStereoLayer::FPICOXRStereoLayer(const FPICOXRStereoLayer& InPXRLayer)
 	, bNeedsTexSrgbCreate(InPXRLayer.bNeedsTexSrgbCreate)
     , HMDDevice(InPXRLayer.HMDDevice)
 	, ID(InPXRLayer.ID)
+	, Generation(InPXRLayer.Generation)
 	, PxrLayerID(InPXRLayer.PxrLayerID)
     , LayerDesc(InPXRLayer.LayerDesc)
     , SwapChain(InPXRLayer.SwapChain)
     , LeftSwapChain(InPXRLayer.LeftSwapChain)
     , FoveationSwapChain(InPXRLayer.FoveationSwapChain)
     , bTextureNeedUpdate(InPXRLayer.bTextureNeedUpdate)
+	, TextureUpdateCount(InPXRLayer.TextureUpdateCount)
+	, CopySettings(InPXRLayer.CopySettings)
+	, CopyState(InPXRLayer.CopyState)
     , UnderlayMeshComponent(InPXRLayer.UnderlayMeshComponent)
     , UnderlayActor(InPXRLayer.UnderlayActor)
     , PxrLayer(InPXRLayer.PxrLayer)
 	, TrackingMode(InPXRLayer.TrackingMode)
+	, bCachedSubmitIsLayer2(false)
+	, bHasCachedSubmit(false)
 {
 	FMemory::Memcpy(&PxrLayerCreateParam, &InPXRLayer.PxrLayerCreateParam, sizeof(PxrLayerCreateParam));
 }
@@ -105,6 +117,7 @@ void FPICOXRStereoLayer::SetPXRLayerDesc(const IStereoLayers::FLayerDesc& InDesc
 		bTextureNeedUpdate = true;
 	}
 	LayerDesc = InDesc;
+	++Generation;
 
 	ManageUnderlayComponent(bRatioChanged);
 }
@@ -137,15 +150,11 @@ void FPICOXRStereoLayer::ManageUnderlayComponent(bool bRatioChanged)
 			UnderlayMeshComponent = NewObject<UProceduralMeshComponent>(UnderlayActor, UnderlayComponentName);
 			UnderlayMeshComponent->RegisterComponent();
 
-			TArray<FVector> VerticePos;
-			TArray<int32> TriangleIndics;
-			TArray<FVector> Normals;
-			TArray<FVector2D> TexUV;
-			TArray<FLinearColor> VertexColors;
-			TArray<FProcMeshTangent> Tangents;
-
-			CreateUnderlayMesh(VerticePos, TriangleIndics, TexUV);
-			UnderlayMeshComponent->CreateMeshSection_LinearColor(0, VerticePos, TriangleIndics, Normals, TexUV, VertexColors, Tangents, false);
+			FPICOUnderlayMeshKey MeshKey;
+			if (GetUnderlayMeshKey(MeshKey))
+			{
+				FPICOUnderlayMeshCache::Get().ApplyMesh_GameThread(MeshKey, UnderlayMeshComponent);
+			}
 
 			if (HMDDevice && HMDDevice->GetContentResourceFinder())
 			{
@@ -162,152 +171,40 @@ void FPICOXRStereoLayer::ManageUnderlayComponent(bool bRatioChanged)
 	return;
 }
 
-static void AddFaceIndices(const int v0, const int v1, const int v2, const int v3, TArray<int32>& Triangles, bool inverse)
+bool FPICOXRStereoLayer::GetUnderlayMeshKey(FPICOUnderlayMeshKey& OutKey) const
 {
-	if (inverse)
-	{
-		Triangles.Add(v0);
-		Triangles.Add(v2);
-		Triangles.Add(v1);
-		Triangles.Add(v0);
-		Triangles.Add(v3);
-		Triangles.Add(v2);
-	}
-	else
-	{
-		Triangles.Add(v0);
-		Triangles.Add(v1);
-		Triangles.Add(v2);
-		Triangles.Add(v0);
-		Triangles.Add(v2);
-		Triangles.Add(v3);
-	}
-}
+	FIntPoint TexSize = LayerDesc.Texture.IsValid() ? LayerDesc.Texture->GetTexture2D()->GetSizeXY() : LayerDesc.LayerSize;
+	float AspectRatio = TexSize.X ? (float)TexSize.Y / (float)TexSize.X : 3.0f / 4.0f;
+	const bool bPreserveRatio = (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_QUAD_PRESERVE_TEX_RATIO) != 0;
 
-void FPICOXRStereoLayer::CreateUnderlayMesh(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector2D>& UV0)
-{
 	if (LayerDesc.HasShape<FQuadLayer>())
 	{
-		const float QuadScale = 0.99;
-
-		FIntPoint TexSize = LayerDesc.Texture.IsValid() ? LayerDesc.Texture->GetTexture2D()->GetSizeXY() : LayerDesc.LayerSize;
-		float AspectRatio = TexSize.X ? (float)TexSize.Y / (float)TexSize.X : 3.0f / 4.0f;
-
-		float QuadSizeX = LayerDesc.QuadSize.X;
-		float QuadSizeY = (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_QUAD_PRESERVE_TEX_RATIO) ? LayerDesc.QuadSize.X * AspectRatio : LayerDesc.QuadSize.Y;
-
-		Vertices.Init(FVector::ZeroVector, 4);
-		Vertices[0] = FVector(0.0, -QuadSizeX / 2, -QuadSizeY / 2) * QuadScale;
-		Vertices[1] = FVector(0.0, QuadSizeX / 2, -QuadSizeY / 2) * QuadScale;
-		Vertices[2] = FVector(0.0, QuadSizeX / 2, QuadSizeY / 2) * QuadScale;
-		Vertices[3] = FVector(0.0, -QuadSizeX / 2, QuadSizeY / 2) * QuadScale;
-
-		UV0.Init(FVector2D::ZeroVector, 4);
-		UV0[0] = FVector2D(1, 0);
-		UV0[1] = FVector2D(1, 1);
-		UV0[2] = FVector2D(0, 0);
-		UV0[3] = FVector2D(0, 1);
-
-		Triangles.Reserve(6);
-		AddFaceIndices(0, 1, 2, 3, Triangles, false);
+		OutKey.Shape = FPICOUnderlayMeshKey::EShape::Quad;
+		OutKey.Params[0] = LayerDesc.QuadSize.X;
+		OutKey.Params[1] = bPreserveRatio ? LayerDesc.QuadSize.X * AspectRatio : LayerDesc.QuadSize.Y;
 	}
 	else if (LayerDesc.HasShape<FCylinderLayer>())
 	{
-		float Arc, Radius, Height;
 		const FCylinderLayer& CylinderProps = LayerDesc.GetShape<FCylinderLayer>();
-		Arc = CylinderProps.OverlayArc;
-		Radius = CylinderProps.Radius;
-		Height = CylinderProps.Height;
-		const float CylinderScale = 0.99;
-
-		FIntPoint TexSize = LayerDesc.Texture.IsValid() ? LayerDesc.Texture->GetTexture2D()->GetSizeXY() : LayerDesc.LayerSize;
-		float AspectRatio = TexSize.X ? (float)TexSize.Y / (float)TexSize.X : 3.0f / 4.0f;
-
-		float CylinderHeight = (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_QUAD_PRESERVE_TEX_RATIO) ? Arc * AspectRatio : Height;
-
-		const FVector XAxis = FVector(1, 0, 0);
-		const FVector YAxis = FVector(0, 1, 0);
-		const FVector HalfHeight = FVector(0, 0, CylinderHeight / 2);
-
-		const float ArcAngle = Arc / Radius;
-		const int Sides = (int)((ArcAngle * 180) / (PI * 5));
-		Vertices.Init(FVector::ZeroVector, 2 * (Sides + 1));
-		UV0.Init(FVector2D::ZeroVector, 2 * (Sides + 1));
-		Triangles.Init(0, Sides * 6);
-
-		float CurrentAngle = -ArcAngle / 2;
-		const float AngleStep = ArcAngle / Sides;
-
-
-		for (int Side = 0; Side < Sides + 1; Side++)
-		{
-			FVector MidVertex = Radius * (FMath::Cos(CurrentAngle) * XAxis + FMath::Sin(CurrentAngle) * YAxis);
-			Vertices[2 * Side] = (MidVertex - HalfHeight) * CylinderScale;
-			Vertices[(2 * Side) + 1] = (MidVertex + HalfHeight) * CylinderScale;
-
-			UV0[2 * Side] = FVector2D(1 - (Side / (float)Sides), 0);
-			UV0[(2 * Side) + 1] = FVector2D(1 - (Side / (float)Sides), 1);
-
-			CurrentAngle += AngleStep;
-
-			if (Side < Sides)
-			{
-				Triangles[6 * Side + 0] = 2 * Side;
-				Triangles[6 * Side + 2] = 2 * Side + 1;
-				Triangles[6 * Side + 1] = 2 * (Side + 1) + 1;
-				Triangles[6 * Side + 3] = 2 * Side;
-				Triangles[6 * Side + 5] = 2 * (Side + 1) + 1;
-				Triangles[6 * Side + 4] = 2 * (Side + 1);
-			}
-		}
+		OutKey.Shape = FPICOUnderlayMeshKey::EShape::Cylinder;
+		OutKey.Params[0] = CylinderProps.Radius;
+		OutKey.Params[1] = CylinderProps.OverlayArc;
+		OutKey.Params[2] = bPreserveRatio ? CylinderProps.OverlayArc * AspectRatio : CylinderProps.Height;
 	}
 	else if (LayerDesc.HasShape<FCubemapLayer>())
 	{
-		const float CubemapScale = 1000;
-		Vertices.Init(FVector::ZeroVector, 8);
-		Vertices[0] = FVector(-1.0, -1.0, -1.0) * CubemapScale;
-		Vertices[1] = FVector(-1.0, -1.0, 1.0) * CubemapScale;
-		Vertices[2] = FVector(-1.0, 1.0, -1.0) * CubemapScale;
-		Vertices[3] = FVector(-1.0, 1.0, 1.0) * CubemapScale;
-		Vertices[4] = FVector(1.0, -1.0, -1.0) * CubemapScale;
-		Vertices[5] = FVector(1.0, -1.0, 1.0) * CubemapScale;
-		Vertices[6] = FVector(1.0, 1.0, -1.0) * CubemapScale;
-		Vertices[7] = FVector(1.0, 1.0, 1.0) * CubemapScale;
-
-		Triangles.Reserve(24);
-		AddFaceIndices(0, 1, 3, 2, Triangles, false);
-		AddFaceIndices(4, 5, 7, 6, Triangles, true);
-		AddFaceIndices(0, 1, 5, 4, Triangles, true);
-		AddFaceIndices(2, 3, 7, 6, Triangles, false);
-		AddFaceIndices(0, 2, 6, 4, Triangles, false);
-		AddFaceIndices(1, 3, 7, 5, Triangles, true);
+		OutKey.Shape = FPICOUnderlayMeshKey::EShape::Cubemap;
 	}
 	else if (LayerDesc.HasShape<FEACLayer>())
 	{
-		float Scale;
-		const FEACLayer& EACProps = LayerDesc.GetShape<FEACLayer>();
-		Scale = EACProps.Scale;
-
-		// Implements a cube mesh
-		// Cubemap Scale should be changed eventually to incorporate scale
-		Vertices.Init(FVector::ZeroVector, 8);
-		Vertices[0] = FVector(-1.0, -1.0, -1.0) * Scale;
-		Vertices[1] = FVector(-1.0, -1.0, 1.0) * Scale;
-		Vertices[2] = FVector(-1.0, 1.0, -1.0) * Scale;
-		Vertices[3] = FVector(-1.0, 1.0, 1.0) * Scale;
-		Vertices[4] = FVector(1.0, -1.0, -1.0) * Scale;
-		Vertices[5] = FVector(1.0, -1.0, 1.0) * Scale;
-		Vertices[6] = FVector(1.0, 1.0, -1.0) * Scale;
-		Vertices[7] = FVector(1.0, 1.0, 1.0) * Scale;
-
-		Triangles.Reserve(24);
-		AddFaceIndices(0, 1, 3, 2, Triangles, false);
-		AddFaceIndices(4, 5, 7, 6, Triangles, true);
-		AddFaceIndices(0, 1, 5, 4, Triangles, true);
-		AddFaceIndices(2, 3, 7, 6, Triangles, false);
-		AddFaceIndices(0, 2, 6, 4, Triangles, false);
-		AddFaceIndices(1, 3, 7, 5, Triangles, true);
+		OutKey.Shape = FPICOUnderlayMeshKey::EShape::EAC;
+		OutKey.Params[0] = LayerDesc.GetShape<FEACLayer>().Scale;
 	}
+	else
+	{
+		return false;
+	}
+	return true;
 }
 
 void FPICOXRStereoLayer::PXRLayersCopy_RenderThread(FPICOXRRenderBridge* RenderBridge, FRHICommandListImmediate& RHICmdList)
@@ -333,6 +230,30 @@ void FPICOXRStereoLayer::PXRLayersCopy_RenderThread(FPICOXRRenderBridge* RenderB
 #else
 			DstRect = SrcRect = FIntRect();
 #endif
+			bool bPartial = false;
+			if (IsCopyTracked() && !ShouldCopyTexture_RenderThread(bPartial))
+			{
+				bTextureNeedUpdate = false;
+				return;
+			}
+
+			// Flipped and mipmapped copies do not map a sub rect onto itself, they are copied whole
+			if (bPartial && !bInvertY && DstTexture->GetNumMips() == 1)
+			{
+				const FIntRect FullRect = SrcRect.IsEmpty() ? FIntRect(FIntPoint::ZeroValue, SrcTexture->GetSizeXY()) : SrcRect;
+				FIntRect DirtyRect = CopySettings.DirtyRect;
+				DirtyRect.Clip(FullRect);
+				if (DirtyRect.IsEmpty())
+				{
+					CopyState->NumSkippedUnchanged.fetch_add(1, std::memory_order_relaxed);
+					bTextureNeedUpdate = false;
+					return;
+				}
+				DstRect = SrcRect = DirtyRect;
+				CopyState->NumPartialCopies.fetch_add(1, std::memory_order_relaxed);
+			}
+			CopyState->NumCopies.fetch_add(1, std::memory_order_relaxed);
+
 			RenderBridge->TransferImage_RenderThread(RHICmdList, DstTexture, SrcTexture, DstRect, SrcRect, true, bNoAlpha, bMRCLayer, bInvertY);
 
 			// Stereo
@@ -449,7 +370,7 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(const FGameSettings* Settings
 		}
 		PxrLayerCreateParam.arraySize = 1;
 
-		if (!(LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE))
+		if (!(LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) || IsCopyTracked())
 		{
 			PxrLayerCreateParam.layerFlags |= PXR_LAYER_FLAG_STATIC_IMAGE;
 		}
@@ -478,6 +399,10 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(const FGameSettings* Settings
 		bTextureNeedUpdate |= InLayer->bTextureNeedUpdate;
 		bNeedsTexSrgbCreate = InLayer->bNeedsTexSrgbCreate;
 	}
+	else if (ID != 0 && AcquirePooledLayer_RenderThread(DelayDeletion))
+	{
+		bTextureNeedUpdate = true;
+	}
     else
 	{
 		TArray<uint64> TextureResources;
@@ -570,6 +495,18 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(const FGameSettings* Settings
 				ETextureCreateFlags	TCF = TexCreate_Foveation;
 				FoveationSwapChain = CustomPresent->CreateSwapChain_RenderThread(ID,PxrLayerID, ResourceType, FFRTextureResources, PF_R8G8, FoveationWidth, FoveationHeight, PxrLayerCreateParam.arraySize, 1, 1, Flags, TCF, 1);
 			}	
+
+			// The eye layer keeps its own swapchains
+			if (ID != 0)
+			{
+				FPICOPooledLayerPtr PooledLayer = MakeShared<FPICOPooledLayer, ESPMode::ThreadSafe>();
+				PooledLayer->PxrLayerId = PxrLayerID;
+				FMemory::Memcpy(&PooledLayer->CreateParam, &PxrLayerCreateParam, sizeof(PxrLayerCreateParam));
+				PooledLayer->SwapChain = SwapChain;
+				PooledLayer->LeftSwapChain = LeftSwapChain;
+				PooledLayer->MemorySize = FPICOSwapChainPool::GetMemorySize(PxrLayerCreateParam, TextureResources.Num() + LeftTextureResources.Num());
+				PxrLayer->SetPooledLayer(PooledLayer);
+			}
 			bTextureNeedUpdate = true;
 		}
 		else
@@ -585,6 +522,61 @@ bool FPICOXRStereoLayer::InitPXRLayer_RenderThread(const FGameSettings* Settings
     return true;
 }
 
+void FPICOXRStereoLayer::RefreshTextureUpdate_RenderThread()
+{
+	check(IsInRenderingThread());
+
+	if ((LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && LayerDesc.Texture.IsValid() && IsVisible())
+	{
+		bTextureNeedUpdate = true;
+	}
+}
+
+bool FPICOXRStereoLayer::ShouldCopyTexture_RenderThread(bool& bOutPartial)
+{
+	check(IsInRenderingThread());
+
+	FPICOLayerCopyState& State = *CopyState;
+	const double Now = FPlatformTime::Seconds();
+	bOutPartial = false;
+
+	// A new swapchain or source texture always gets a complete copy
+	const bool bTargetChanged = State.LastSwapChain.Pin() != SwapChain || State.LastTexture != LayerDesc.Texture || State.LastLeftTexture != LayerDesc.LeftTexture;
+	if (!bTargetChanged)
+	{
+		if (CopySettings.bCopyOnlyWhenMarked && State.LastTextureUpdateCount == TextureUpdateCount)
+		{
+			State.NumSkippedUnchanged.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		if (CopySettings.MaxCopyRate > 0.0f && Now - State.LastCopyTime < 1.0 / CopySettings.MaxCopyRate)
+		{
+			State.NumSkippedRateLimited.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		bOutPartial = !CopySettings.DirtyRect.IsEmpty();
+	}
+
+	State.LastSwapChain = SwapChain;
+	State.LastTexture = LayerDesc.Texture;
+	State.LastLeftTexture = LayerDesc.LeftTexture;
+	State.LastTextureUpdateCount = TextureUpdateCount;
+	State.LastCopyTime = Now;
+	return true;
+}
+
+FPICOLayerCopyStats FPICOXRStereoLayer::GetCopyStats() const
+{
+	FPICOLayerCopyStats Stats;
+	Stats.NumCopies = CopyState->NumCopies.load(std::memory_order_relaxed);
+	Stats.NumPartialCopies = CopyState->NumPartialCopies.load(std::memory_order_relaxed);
+	Stats.NumSkippedUnchanged = CopyState->NumSkippedUnchanged.load(std::memory_order_relaxed);
+	Stats.NumSkippedRateLimited = CopyState->NumSkippedRateLimited.load(std::memory_order_relaxed);
+	return Stats;
+}
+
 bool FPICOXRStereoLayer::IfCanReuseLayers(const FPICOXRStereoLayer* InLayer) const
 {
 	if (!InLayer || !InLayer->PxrLayer.IsValid())
@@ -616,6 +608,26 @@ bool FPICOXRStereoLayer::IfCanReuseLayers(const FPICOXRStereoLayer* InLayer) con
 	return true;
 }
 
+bool FPICOXRStereoLayer::AcquirePooledLayer_RenderThread(FDelayDeleteLayerManager* DelayDeletion)
+{
+	check(IsInRenderingThread());
+
+	FPICOPooledLayerPtr PooledLayer = DelayDeletion->GetSwapChainPool().Acquire(PxrLayerCreateParam);
+	if (!PooledLayer.IsValid())
+	{
+		return false;
+	}
+
+	PXR_LOGI(PxrUnreal, "Reusing pooled PxrLayerID:%d for UELayerID:%d", PooledLayer->PxrLayerId, ID);
+	PxrLayerCreateParam.layerId = PxrLayerID = PooledLayer->PxrLayerId;
+	SwapChain = PooledLayer->SwapChain;
+	LeftSwapChain = PooledLayer->LeftSwapChain;
+	FoveationSwapChain.Reset();
+	PxrLayer = MakeShareable<FPxrLayer>(new FPxrLayer(ID, PxrLayerID, DelayDeletion));
+	PxrLayer->SetPooledLayer(PooledLayer);
+	return true;
+}
+
 void FPICOXRStereoLayer::ReleaseResources_RHIThread()
 {
 	CheckInRHIThread();
@@ -669,6 +681,27 @@ void FPICOXRStereoLayer::IncrementSwapChainIndex_RHIThread(FPICOXRRenderBridge*
 	}
 }
 
+template <typename LayerType>
+int FPICOXRStereoLayer::SubmitAndCacheLayer_RHIThread(const LayerType& Layer, bool bLayer2)
+{
+	CachedSubmit.SetNumUninitialized(sizeof(LayerType), false);
+	FMemory::Memcpy(CachedSubmit.GetData(), &Layer, sizeof(LayerType));
+	bCachedSubmitIsLayer2 = bLayer2;
+	bHasCachedSubmit = true;
+	return SubmitCachedLayer_RHIThread(Layer.header.sensorFrameIndex);
+}
+
+int FPICOXRStereoLayer::SubmitCachedLayer_RHIThread(int SensorFrameIndex)
+{
+	// PxrLayerHeader2 starts with the fields of PxrLayerHeader
+	reinterpret_cast<PxrLayerHeader*>(CachedSubmit.GetData())->sensorFrameIndex = SensorFrameIndex;
+	if (bCachedSubmitIsLayer2)
+	{
+		return FPICOXRHMDModule::GetPluginWrapper().SubmitLayer2(reinterpret_cast<PxrLayerHeader2*>(CachedSubmit.GetData()));
+	}
+	return FPICOXRHMDModule::GetPluginWrapper().SubmitLayer(reinterpret_cast<PxrLayerHeader*>(CachedSubmit.GetData()));
+}
+
 const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settings, const FPXRGameFrame* Frame)
 {
 	PXR_LOGV(PxrUnreal, "Submit Layer:%u", ID);
@@ -762,6 +795,30 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 			}
 		}
 
+		FSubmitKey SubmitKey;
+		FMemory::Memzero(SubmitKey);
+		FMemory::Memcpy(SubmitKey.ColorScale, ColorScale, sizeof(ColorScale));
+		FMemory::Memcpy(SubmitKey.ColorOffset, ColorOffset, sizeof(ColorOffset));
+		SubmitKey.BaseOrientation = Settings->BaseOrientation;
+		SubmitKey.BaseOffset = Settings->BaseOffset;
+		if (LayerDesc.PositionType == IStereoLayers::WorldLocked)
+		{
+			SubmitKey.TrackingToWorldRotation = Frame->TrackingToWorld.GetRotation();
+			SubmitKey.TrackingToWorldLocation = Frame->TrackingToWorld.GetTranslation();
+		}
+		SubmitKey.WorldToMetersScale = Frame->WorldToMetersScale;
+		if (bHasCachedSubmit && FMemory::Memcmp(&SubmitKey, &CachedSubmitKey, sizeof(FSubmitKey)) == 0)
+		{
+			const int Result = SubmitCachedLayer_RHIThread(Frame->ViewNumber);
+			if (bCachedSubmitIsLayer2 && Result != (int)PxrReturnStatus::PXR_RET_SUCCESS)
+			{
+				PXR_LOGE(PxrUnreal, "Submit Layer:%d Failed!:%d", PxrLayerID, Result);
+			}
+			return;
+		}
+		CachedSubmitKey = SubmitKey;
+		bHasCachedSubmit = false;
+
 		FTransform BaseTransform = FTransform::Identity;
 		uint32 Flags = 0;
 		Flags |= bMRCLayer ? (1 << 30) : 0;
@@ -816,7 +873,7 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 			layerSubmit.size[0] = (float)(LayerDesc.QuadSize.X * Scale.x);
 			layerSubmit.size[1] = (float)(QuadSizeY * Scale.y);
 
-			FPICOXRHMDModule::GetPluginWrapper().SubmitLayer((PxrLayerHeader*)&layerSubmit);
+			SubmitAndCacheLayer_RHIThread(layerSubmit, false);
 		}
 		else if (ShapeType == (int32)PxrLayerShape::PXR_LAYER_CYLINDER)
 		{
@@ -836,7 +893,7 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 			layerSubmit.centralAngle = CylinderProps.OverlayArc / CylinderProps.Radius;
 			layerSubmit.height = CylinderHeight * Scale.x;
 			layerSubmit.radius = CylinderProps.Radius * Scale.y;
-			FPICOXRHMDModule::GetPluginWrapper().SubmitLayer((PxrLayerHeader*)&layerSubmit);
+			SubmitAndCacheLayer_RHIThread(layerSubmit, false);
 		}
 		else if (ShapeType == (int32)PxrLayerShape::PXR_LAYER_EQUIRECT)
 		{
@@ -901,7 +958,7 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 					EyeIndex, ScaleX[EyeIndex], ScaleY[EyeIndex], BiasX[EyeIndex], BiasY[EyeIndex], imagerectx[EyeIndex], imagerecty[EyeIndex], imagerectwidth[EyeIndex], imagerectheight[EyeIndex]);
 			}
 			int result;
-			result = FPICOXRHMDModule::GetPluginWrapper().SubmitLayer2((PxrLayerHeader2*)&layerSubmit);
+			result = SubmitAndCacheLayer_RHIThread(layerSubmit, true);
 			if (result != (int)PxrReturnStatus::PXR_RET_SUCCESS)
 			{
 				PXR_LOGE(PxrUnreal, "Submit Layer:%d PxrLayerEquirect Failed!:%d", PxrLayerID, result);
@@ -924,7 +981,7 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 				layerSubmit.pose[EyeIndex] = PxrLayerSubmitPose;
 			}
 			int result;
-			result = FPICOXRHMDModule::GetPluginWrapper().SubmitLayer2((PxrLayerHeader2*)&layerSubmit);
+			result = SubmitAndCacheLayer_RHIThread(layerSubmit, true);
 			if (result != (int)PxrReturnStatus::PXR_RET_SUCCESS)
 			{
 				PXR_LOGE(PxrUnreal, "Submit Layer:%d PxrLayerCube2 Failed!:%d", PxrLayerID, result);
@@ -980,7 +1037,7 @@ const void FPICOXRStereoLayer::SubmitLayer_RHIThread(const FGameSettings* Settin
 			/* End of Unique Parameters for EAC */
 
 			int result;
-			result = FPICOXRHMDModule::GetPluginWrapper().SubmitLayer2((PxrLayerHeader2*)&layerSubmit);
+			result = SubmitAndCacheLayer_RHIThread(layerSubmit, true);
 			if (result != (int)PxrReturnStatus::PXR_RET_SUCCESS)
 			{
 				PXR_LOGE(PxrUnreal, "Submit Layer:%d PxrLayerEAC Failed!:%d", PxrLayerID, result);
@@ -1019,6 +1076,7 @@ int32 FPICOXRStereoLayer::GetShapeType()
 
 void FPICOXRStereoLayer::SetEyeLayerDesc(uint32 SizeX, uint32 SizeY, uint32 ArraySize, uint32 NumMips, uint32 NumSamples, FString RHIString,bool EnableSubSampled)
 {
+	++Generation;
 	PxrLayerCreateParam.layerShape = PXR_LAYER_PROJECTION;
 	PxrLayerCreateParam.width = SizeX;
 	PxrLayerCreateParam.height = SizeY;
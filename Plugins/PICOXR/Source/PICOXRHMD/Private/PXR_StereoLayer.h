@@ -10,10 +10,25 @@
 #include "GameFramework/PlayerController.h"
 #include "PXR_PluginWrapper.h"
 #include "Components/StereoLayerComponent.h"
+#include <atomic>
 #include "PXR_StereoLayer.generated.h"
 
 class FDelayDeleteLayerManager;
 class FPXRGameFrame;
+struct FPICOUnderlayMeshKey;
+
+/** A runtime layer with its swapchains, parked in the swapchain pool until a layer with the same create parameters needs one */
+struct FPICOPooledLayer
+{
+	uint32 PxrLayerId = 0;
+	PxrLayerParam CreateParam;
+	FXRSwapChainPtr SwapChain;
+	FXRSwapChainPtr LeftSwapChain;
+	/** Estimated size of all swapchain images */
+	uint64 MemorySize = 0;
+};
+
+typedef TSharedPtr<FPICOPooledLayer, ESPMode::ThreadSafe> FPICOPooledLayerPtr;
 
 class FPxrLayer : public TSharedFromThis<FPxrLayer, ESPMode::ThreadSafe>
 {
@@ -21,15 +36,63 @@ public:
 	FPxrLayer(uint32 ID, uint32 InPxrLayerId, FDelayDeleteLayerManager* InDelayDeletion);
 	~FPxrLayer();
 
+	/** Once released, the runtime layer goes to the swapchain pool instead of being destroyed */
+	void SetPooledLayer(const FPICOPooledLayerPtr& InPooledLayer) { PooledLayer = InPooledLayer; }
+
 protected:
 	uint32 ID;
 	uint32 PxrLayerId;
 private:
 	FDelayDeleteLayerManager* DelayDeletion;
+	FPICOPooledLayerPtr PooledLayer;
 };
 
 typedef TSharedPtr<FPxrLayer, ESPMode::ThreadSafe> FPxrLayerPtr;
 
+/** How a continuously updated layer copies its texture into the swapchain, the defaults copy everything every frame */
+struct FPICOLayerCopySettings
+{
+	/** Copy only after MarkTextureForUpdate or a texture change instead of every frame */
+	bool bCopyOnlyWhenMarked = false;
+	/** Copies per second at most, 0 for no limit */
+	float MaxCopyRate = 0.0f;
+	/** Texels of the texture that change between copies, the whole texture if empty. The first copy into a swapchain is always complete */
+	FIntRect DirtyRect;
+
+	/** Tracked layers keep a single static image, so that skipped and partial copies leave valid content behind */
+	bool IsTracked() const { return bCopyOnlyWhenMarked || MaxCopyRate > 0.0f || !DirtyRect.IsEmpty(); }
+
+	bool operator==(const FPICOLayerCopySettings& Other) const
+	{
+		return bCopyOnlyWhenMarked == Other.bCopyOnlyWhenMarked && MaxCopyRate == Other.MaxCopyRate && DirtyRect == Other.DirtyRect;
+	}
+	bool operator!=(const FPICOLayerCopySettings& Other) const { return !(*this == Other); }
+};
+
+struct FPICOLayerCopyStats
+{
+	uint32 NumCopies = 0;
+	/** Copies limited to FPICOLayerCopySettings::DirtyRect, included in NumCopies */
+	uint32 NumPartialCopies = 0;
+	uint32 NumSkippedUnchanged = 0;
+	uint32 NumSkippedRateLimited = 0;
+};
+
+/** Copy bookkeeping shared by all clones of a layer. Written on the render thread, the counters are read on the game thread */
+struct FPICOLayerCopyState
+{
+	TWeakPtr<FXRSwapChain, ESPMode::ThreadSafe> LastSwapChain;
+	FTextureRHIRef LastTexture;
+	FTextureRHIRef LastLeftTexture;
+	uint32 LastTextureUpdateCount = 0;
+	double LastCopyTime = 0.0;
+
+	std::atomic<uint32> NumCopies{0};
+	std::atomic<uint32> NumPartialCopies{0};
+	std::atomic<uint32> NumSkippedUnchanged{0};
+	std::atomic<uint32> NumSkippedRateLimited{0};
+};
+
 class FPICOXRStereoLayer : public TSharedFromThis<FPICOXRStereoLayer, ESPMode::ThreadSafe>
 {
 public:
@@ -41,10 +104,12 @@ public:
 	void SetPXRLayerDesc(const IStereoLayers::FLayerDesc& InDesc);
 	const IStereoLayers::FLayerDesc& GetPXRLayerDesc() const { return LayerDesc; }
 	const uint32& GetID()const{return ID;}
+	uint32 GetGeneration() const { return Generation; }
 
 	bool IsLayerSupportDepth() { return (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH) != 0; }
 	void ManageUnderlayComponent(bool bRatioChanged);
-	void CreateUnderlayMesh(TArray<FVector>& VerticePos, TArray<int32>& TriangleIndics, TArray<FVector2D>& TexUV);
+	/** Returns false for shapes without an underlay mesh */
+	bool GetUnderlayMeshKey(FPICOUnderlayMeshKey& OutKey) const;
 
 	const FXRSwapChainPtr& GetSwapChain() const { return SwapChain; }
 	const FXRSwapChainPtr& GetLeftSwapChain() const { return LeftSwapChain; }
@@ -54,9 +119,17 @@ public:
 	int32 GetShapeType();
 	void SetEyeLayerDesc(uint32 SizeX, uint32 SizeY, uint32 ArraySize, uint32 NumMips, uint32 NumSamples, FString RHIString,bool EnableSubSampled);
     void PXRLayersCopy_RenderThread(FPICOXRRenderBridge* RenderBridge, FRHICommandListImmediate& RHICmdList);
+	/** Only read by the next snapshot of a changed layer, the render thread requests continuous updates itself */
 	void MarkTextureForUpdate(bool bUpdate = true) { bTextureNeedUpdate = bUpdate; }
+	/** Counts an explicit texture update, only tracked layers need it to reach the render thread */
+	void MarkTextureChanged() { if (IsCopyTracked()) { ++TextureUpdateCount; ++Generation; } }
+	void SetCopySettings(const FPICOLayerCopySettings& InSettings) { if (CopySettings != InSettings) { CopySettings = InSettings; ++Generation; } }
+	FPICOLayerCopyStats GetCopyStats() const;
+	void RefreshTextureUpdate_RenderThread();
 	bool InitPXRLayer_RenderThread(const FGameSettings* Settings, FPICOXRRenderBridge* CustomPresent, FDelayDeleteLayerManager* DelayDeletion, FRHICommandListImmediate& RHICmdList, const FPICOXRStereoLayer* InLayer = nullptr);
 	bool IfCanReuseLayers(const FPICOXRStereoLayer* InLayer) const;
+	/** Takes over a parked runtime layer created with the same parameters, returns false if the pool has none */
+	bool AcquirePooledLayer_RenderThread(FDelayDeleteLayerManager* DelayDeletion);
 	void ReleaseResources_RHIThread();
 	bool IsVisible() { return (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_HIDDEN) == 0; }
 	void DestroyUnderlayMesh();
@@ -64,7 +137,7 @@ public:
 	bool bSplashBlackProjectionLayer;
 	bool bMRCLayer;
 	bool bNeedsTexSrgbCreate;
-	void SetTrackingMode(PxrTrackingModeFlags mode) { TrackingMode = mode; }
+	void SetTrackingMode(PxrTrackingModeFlags mode) { if (TrackingMode != mode) { TrackingMode = mode; ++Generation; } }
 
 protected:
 	FVector GetLayerLocation() const { return LayerDesc.Transform.GetLocation(); };
@@ -72,6 +145,8 @@ protected:
 	FVector GetLayerScale() const { return LayerDesc.Transform.GetScale3D(); };
 	FPICOXRHMD* HMDDevice;
 	uint32 ID;	
+	/** Bumped on every game thread change, snapshots are only re-cloned when it moves */
+	uint32 Generation;
 	uint32 PxrLayerID;
 	static uint32 PxrLayerIDCounter;
 	IStereoLayers::FLayerDesc LayerDesc;
@@ -79,15 +154,58 @@ protected:
 	FXRSwapChainPtr LeftSwapChain;
 	FXRSwapChainPtr FoveationSwapChain;
     bool bTextureNeedUpdate;
+	uint32 TextureUpdateCount;
+	FPICOLayerCopySettings CopySettings;
+	TSharedPtr<FPICOLayerCopyState, ESPMode::ThreadSafe> CopyState;
 	UProceduralMeshComponent* UnderlayMeshComponent;
 	AActor* UnderlayActor;
 	FPxrLayerPtr PxrLayer;
 	PxrLayerParam PxrLayerCreateParam;
 	PxrTrackingModeFlags TrackingMode;
+
+	/** Per frame inputs of a submit. The layer itself is replaced rather than modified on the RHI thread, so it is not part of the key */
+	struct FSubmitKey
+	{
+		float ColorScale[4];
+		float ColorOffset[4];
+		FQuat BaseOrientation;
+		FVector BaseOffset;
+		FQuat TrackingToWorldRotation;
+		FVector TrackingToWorldLocation;
+		float WorldToMetersScale;
+	};
+	/** The last submitted layer struct, submitted again with the new sensor frame index while the key does not change */
+	FSubmitKey CachedSubmitKey;
+	TArray<uint8> CachedSubmit;
+	bool bCachedSubmitIsLayer2;
+	bool bHasCachedSubmit;
+
+	template <typename LayerType>
+	int SubmitAndCacheLayer_RHIThread(const LayerType& Layer, bool bLayer2);
+	int SubmitCachedLayer_RHIThread(int SensorFrameIndex);
+
+	bool IsCopyTracked() const { return (LayerDesc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && CopySettings.IsTracked(); }
+	/** Decides whether this frame copies the texture of a tracked layer and records the copy, bOutPartial limits it to the dirty rect */
+	bool ShouldCopyTexture_RenderThread(bool& bOutPartial);
 };
 
 typedef TSharedPtr<FPICOXRStereoLayer, ESPMode::ThreadSafe> FPICOLayerPtr;
 
+/** Layer list handed from one thread stage to the next through a triple buffer */
+struct FPICOLayerSnapshot
+{
+	uint64 Version = 0;
+	TArray<FPICOLayerPtr> Layers;
+};
+
+/** Snapshot clone of a layer, kept until its source layer or generation changes */
+struct FPICOPublishedLayer
+{
+	FPICOLayerPtr Source;
+	uint32 Generation = 0;
+	FPICOLayerPtr Snapshot;
+};
+
 struct FPICOLayerPtr_SortByPriority
 {
 	FORCEINLINE bool operator()(const FPICOLayerPtr&A,const FPICOLayerPtr&B)const
@@ -0,0 +1,189 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc. in the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2023, Epic Games, Inc. All rights reserved.
+
+#include "PXR_UnderlayMeshCache.h"
+#include "ProceduralMeshComponent.h"
+
+static void AddFaceIndices(const int v0, const int v1, const int v2, const int v3, TArray<int32>& Triangles, bool inverse)
+{
+	if (inverse)
+	{
+		Triangles.Add(v0);
+		Triangles.Add(v2);
+		Triangles.Add(v1);
+		Triangles.Add(v0);
+		Triangles.Add(v3);
+		Triangles.Add(v2);
+	}
+	else
+	{
+		Triangles.Add(v0);
+		Triangles.Add(v1);
+		Triangles.Add(v2);
+		Triangles.Add(v0);
+		Triangles.Add(v2);
+		Triangles.Add(v3);
+	}
+}
+
+static void AddCubeMesh(float Scale, TArray<FVector>& Vertices, TArray<int32>& Triangles)
+{
+	Vertices.Init(FVector::ZeroVector, 8);
+	Vertices[0] = FVector(-1.0, -1.0, -1.0) * Scale;
+	Vertices[1] = FVector(-1.0, -1.0, 1.0) * Scale;
+	Vertices[2] = FVector(-1.0, 1.0, -1.0) * Scale;
+	Vertices[3] = FVector(-1.0, 1.0, 1.0) * Scale;
+	Vertices[4] = FVector(1.0, -1.0, -1.0) * Scale;
+	Vertices[5] = FVector(1.0, -1.0, 1.0) * Scale;
+	Vertices[6] = FVector(1.0, 1.0, -1.0) * Scale;
+	Vertices[7] = FVector(1.0, 1.0, 1.0) * Scale;
+
+	Triangles.Reserve(24);
+	AddFaceIndices(0, 1, 3, 2, Triangles, false);
+	AddFaceIndices(4, 5, 7, 6, Triangles, true);
+	AddFaceIndices(0, 1, 5, 4, Triangles, true);
+	AddFaceIndices(2, 3, 7, 6, Triangles, false);
+	AddFaceIndices(0, 2, 6, 4, Triangles, false);
+	AddFaceIndices(1, 3, 7, 5, Triangles, true);
+}
+
+static void SetMeshSection(UProceduralMeshComponent* Component, const FPICOUnderlayMeshGeometry& Geometry)
+{
+	Component->CreateMeshSection_LinearColor(0, Geometry.Vertices, Geometry.Triangles, TArray<FVector>(), Geometry.UV0, TArray<FLinearColor>(), TArray<FProcMeshTangent>(), false);
+}
+
+FPICOUnderlayMeshCache& FPICOUnderlayMeshCache::Get()
+{
+	static FPICOUnderlayMeshCache Cache;
+	return Cache;
+}
+
+void FPICOUnderlayMeshCache::ApplyMesh_GameThread(const FPICOUnderlayMeshKey& Key, UProceduralMeshComponent* Component)
+{
+	check(IsInGameThread());
+
+	FEntry* Entry = Entries.Find(Key);
+	if (Entry)
+	{
+		Entry->LastUsed = ++UseCounter;
+		SetMeshSection(Component, *Entry->Geometry);
+		return;
+	}
+
+	// The meshes are a few hundred vertices at most, building them inline is cheaper than a task round trip
+	TSharedPtr<FPICOUnderlayMeshGeometry, ESPMode::ThreadSafe> Geometry = MakeShared<FPICOUnderlayMeshGeometry, ESPMode::ThreadSafe>();
+	BuildMesh(Key, *Geometry);
+	SetMeshSection(Component, *Geometry);
+
+	FEntry& NewEntry = Entries.Add(Key);
+	NewEntry.Geometry = Geometry;
+	NewEntry.LastUsed = ++UseCounter;
+	TrimEntries_GameThread();
+}
+
+void FPICOUnderlayMeshCache::TrimEntries_GameThread()
+{
+	while (Entries.Num() > MaxEntries)
+	{
+		const FPICOUnderlayMeshKey* OldestKey = nullptr;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<FPICOUnderlayMeshKey, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.LastUsed < OldestUse)
+			{
+				OldestKey = &Pair.Key;
+				OldestUse = Pair.Value.LastUsed;
+			}
+		}
+
+		if (!OldestKey)
+		{
+			return;
+		}
+		Entries.Remove(FPICOUnderlayMeshKey(*OldestKey));
+	}
+}
+
+void FPICOUnderlayMeshCache::BuildMesh(const FPICOUnderlayMeshKey& Key, FPICOUnderlayMeshGeometry& OutGeometry)
+{
+	TArray<FVector>& Vertices = OutGeometry.Vertices;
+	TArray<int32>& Triangles = OutGeometry.Triangles;
+	TArray<FVector2D>& UV0 = OutGeometry.UV0;
+
+	switch (Key.Shape)
+	{
+	case FPICOUnderlayMeshKey::EShape::Quad:
+	{
+		const float QuadScale = 0.99;
+		const float QuadSizeX = Key.Params[0];
+		const float QuadSizeY = Key.Params[1];
+
+		Vertices.Init(FVector::ZeroVector, 4);
+		Vertices[0] = FVector(0.0, -QuadSizeX / 2, -QuadSizeY / 2) * QuadScale;
+		Vertices[1] = FVector(0.0, QuadSizeX / 2, -QuadSizeY / 2) * QuadScale;
+		Vertices[2] = FVector(0.0, QuadSizeX / 2, QuadSizeY / 2) * QuadScale;
+		Vertices[3] = FVector(0.0, -QuadSizeX / 2, QuadSizeY / 2) * QuadScale;
+
+		UV0.Init(FVector2D::ZeroVector, 4);
+		UV0[0] = FVector2D(1, 0);
+		UV0[1] = FVector2D(1, 1);
+		UV0[2] = FVector2D(0, 0);
+		UV0[3] = FVector2D(0, 1);
+
+		Triangles.Reserve(6);
+		AddFaceIndices(0, 1, 2, 3, Triangles, false);
+		break;
+	}
+	case FPICOUnderlayMeshKey::EShape::Cylinder:
+	{
+		const float Radius = Key.Params[0];
+		const float Arc = Key.Params[1];
+		const float CylinderHeight = Key.Params[2];
+		const float CylinderScale = 0.99;
+
+		const FVector XAxis = FVector(1, 0, 0);
+		const FVector YAxis = FVector(0, 1, 0);
+		const FVector HalfHeight = FVector(0, 0, CylinderHeight / 2);
+
+		const float ArcAngle = Arc / Radius;
+		const int Sides = (int)((ArcAngle * 180) / (PI * 5));
+		Vertices.Init(FVector::ZeroVector, 2 * (Sides + 1));
+		UV0.Init(FVector2D::ZeroVector, 2 * (Sides + 1));
+		Triangles.Init(0, Sides * 6);
+
+		float CurrentAngle = -ArcAngle / 2;
+		const float AngleStep = ArcAngle / Sides;
+
+		for (int Side = 0; Side < Sides + 1; Side++)
+		{
+			FVector MidVertex = Radius * (FMath::Cos(CurrentAngle) * XAxis + FMath::Sin(CurrentAngle) * YAxis);
+			Vertices[2 * Side] = (MidVertex - HalfHeight) * CylinderScale;
+			Vertices[(2 * Side) + 1] = (MidVertex + HalfHeight) * CylinderScale;
+
+			UV0[2 * Side] = FVector2D(1 - (Side / (float)Sides), 0);
+			UV0[(2 * Side) + 1] = FVector2D(1 - (Side / (float)Sides), 1);
+
+			CurrentAngle += AngleStep;
+
+			if (Side < Sides)
+			{
+				Triangles[6 * Side + 0] = 2 * Side;
+				Triangles[6 * Side + 2] = 2 * Side + 1;
+				Triangles[6 * Side + 1] = 2 * (Side + 1) + 1;
+				Triangles[6 * Side + 3] = 2 * Side;
+				Triangles[6 * Side + 5] = 2 * (Side + 1) + 1;
+				Triangles[6 * Side + 4] = 2 * (Side + 1);
+			}
+		}
+		break;
+	}
+	case FPICOUnderlayMeshKey::EShape::Cubemap:
+		AddCubeMesh(1000, Vertices, Triangles);
+		break;
+	case FPICOUnderlayMeshKey::EShape::EAC:
+		// Cubemap Scale should be changed eventually to incorporate scale
+		AddCubeMesh(Key.Params[0], Vertices, Triangles);
+		break;
+	}
+}
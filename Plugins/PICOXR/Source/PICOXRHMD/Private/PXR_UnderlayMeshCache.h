@@ -0,0 +1,75 @@
+// Copyright® 2015-2023 PICO Technology Co., Ltd. All rights reserved.
+// This plugin incorporates portions of the Unreal® Engine. Unreal® is a trademark or registered trademark of Epic Games, Inc. in the United States of America and elsewhere.
+// Unreal® Engine, Copyright 1998 – 2023, Epic Games, Inc. All rights reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+class UProceduralMeshComponent;
+
+/** Shape and size of an underlay mesh, sizes already include the texture aspect ratio where the layer preserves it */
+struct FPICOUnderlayMeshKey
+{
+	enum class EShape : uint8
+	{
+		Quad,
+		Cylinder,
+		Cubemap,
+		EAC
+	};
+
+	EShape Shape = EShape::Quad;
+	/** Quad: width, height. Cylinder: radius, arc, height. EAC: scale */
+	float Params[3] = {};
+
+	bool operator==(const FPICOUnderlayMeshKey& Other) const
+	{
+		return Shape == Other.Shape && Params[0] == Other.Params[0] && Params[1] == Other.Params[1] && Params[2] == Other.Params[2];
+	}
+
+	friend uint32 GetTypeHash(const FPICOUnderlayMeshKey& Key)
+	{
+		uint32 Hash = ::GetTypeHash(static_cast<uint8>(Key.Shape));
+		for (float Param : Key.Params)
+		{
+			Hash = HashCombine(Hash, ::GetTypeHash(Param));
+		}
+		return Hash;
+	}
+};
+
+struct FPICOUnderlayMeshGeometry
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector2D> UV0;
+};
+
+typedef TSharedPtr<const FPICOUnderlayMeshGeometry, ESPMode::ThreadSafe> FPICOUnderlayMeshGeometryPtr;
+
+/** Underlay mesh geometry shared by all layers of the same shape and size, built on the game thread the first time it is used */
+class FPICOUnderlayMeshCache
+{
+public:
+	static FPICOUnderlayMeshCache& Get();
+
+	/** Gives Component the geometry for Key as section 0, building it first if it is not cached */
+	void ApplyMesh_GameThread(const FPICOUnderlayMeshKey& Key, UProceduralMeshComponent* Component);
+
+	static void BuildMesh(const FPICOUnderlayMeshKey& Key, FPICOUnderlayMeshGeometry& OutGeometry);
+
+private:
+	struct FEntry
+	{
+		FPICOUnderlayMeshGeometryPtr Geometry;
+		uint64 LastUsed = 0;
+	};
+
+	void TrimEntries_GameThread();
+
+	/** Built shapes kept beyond this are dropped, least recently used first */
+	static constexpr int32 MaxEntries = 32;
+
+	TMap<FPICOUnderlayMeshKey, FEntry> Entries;
+	uint64 UseCounter = 0;
+};
@@ -240,6 +240,48 @@ struct FPICOXREyeTrackingData
 	}
 };
 
+/** How a continuously updated stereo layer copies its texture into the swapchain, the defaults copy everything every frame */
+USTRUCT(BlueprintType)
+struct FPICOXRLayerCopySettings
+{
+	GENERATED_USTRUCT_BODY()
+
+	/** Copy only after the layer's texture is marked for update or changes, instead of every frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	bool bCopyOnlyWhenMarked = false;
+
+	/** Copies per second at most, 0 for no limit */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	float MaxCopyRate = 0.0f;
+
+	/** Texels of the texture that change between copies, the whole texture if the rect is empty */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	FIntPoint DirtyRectMin = FIntPoint::ZeroValue;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	FIntPoint DirtyRectMax = FIntPoint::ZeroValue;
+};
+
+/** Copy counters of a stereo layer since it was created */
+USTRUCT(BlueprintType)
+struct FPICOXRLayerCopyStats
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	int32 NumCopies = 0;
+
+	/** Copies limited to the dirty rect, included in NumCopies */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	int32 NumPartialCopies = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	int32 NumSkippedUnchanged = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|PXRHMD")
+	int32 NumSkippedRateLimited = 0;
+};
+
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPICOXRIPDChangedDelegate, float, Ipd);
 
 UCLASS()
@@ -490,6 +532,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
 	static void PXR_SetColorScaleAndOffset(FLinearColor ColorScale, FLinearColor ColorOffset, bool bApplyToAllLayers = false);
 
+	/**
+	* Sets how a stereo layer copies its texture into the swapchain.
+	* @param LayerId    (In) The ID returned by IStereoLayers::CreateLayer.
+	* @param Settings   (In) The copy settings.
+	* @return False if there is no such layer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
+	static bool PXR_SetLayerCopySettings(int32 LayerId, const FPICOXRLayerCopySettings& Settings);
+
+	/**
+	* Gets the copy counters of a stereo layer.
+	* @param LayerId    (In) The ID returned by IStereoLayers::CreateLayer.
+	* @param OutStats   (Out) The copy counters.
+	* @return False if there is no such layer.
+	*/
+	UFUNCTION(BlueprintCallable, Category = "PXR|PXRHMD")
+	static bool PXR_GetLayerCopyStats(int32 LayerId, FPICOXRLayerCopyStats& OutStats);
+
 	/// <summary>Gets the current focus state of the HMD.</summary>
 	/// <returns>Bool: 
     /// <ul>
@@ -82,19 +82,65 @@ void UPICOXRHandComponent::TickComponent(float DeltaTime, enum ELevelTick TickTy
 	}
 }
 
+void UPICOXRHandComponent::RefreshBoneMappings()
+{
+	BoneMappingAsset = nullptr;
+	BoneToJointIndex.Reset();
+
+	const USkinnedAsset* SkinnedAsset = GetSkinnedAsset();
+	if (!SkinnedAsset)
+	{
+		return;
+	}
+
+	const FReferenceSkeleton& RefSkeleton = SkinnedAsset->GetRefSkeleton();
+	BoneToJointIndex.Init(INDEX_NONE, RefSkeleton.GetNum());
+	for (const auto& BoneElem : BoneNameMappings)
+	{
+		const int32 BoneIndex = RefSkeleton.FindBoneIndex(BoneElem.Value);
+		if (BoneIndex != INDEX_NONE)
+		{
+			BoneToJointIndex[BoneIndex] = static_cast<int32>(BoneElem.Key);
+		}
+	}
+	BoneMappingAsset = SkinnedAsset;
+}
+
 void UPICOXRHandComponent::UpdateBonePose()
 {
 	if (bCustomHandMesh)
 	{
-		for (auto& BoneElem : BoneNameMappings)
+		const USkinnedAsset* SkinnedAsset = GetSkinnedAsset();
+		if (BoneMappingAsset.Get() != SkinnedAsset)
+		{
+			RefreshBoneMappings();
+		}
+
+		JointRotations.SetNumUninitialized(EHandJointCount, false);
+		const int32 NumBones = BoneSpaceTransforms.Num();
+		if (NumBones == BoneToJointIndex.Num() && UPICOXRInputFunctionLibrary::GetBoneRotations(SkeletonType, JointRotations))
 		{
- 			const int32 BoneIndex = GetSkinnedAsset()->GetRefSkeleton().FindBoneIndex(BoneElem.Value);
-			if (BoneIndex >= 0)
+			// Bones are ordered parents first, so one pass rebuilds component space, swaps in the tracked
+			// rotations and converts them back to local space, instead of a full pose rebuild per bone.
+			const FReferenceSkeleton& RefSkeleton = SkinnedAsset->GetRefSkeleton();
+			ComponentSpaceTransforms.SetNumUninitialized(NumBones, false);
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
 			{
-				FQuat BoneRotation = UPICOXRInputFunctionLibrary::GetBoneRotation(SkeletonType, BoneElem.Key);
-				if (!BoneRotation.IsIdentity()&&BoneRotation.IsNormalized())
+				const int32 ParentIndex = RefSkeleton.GetParentIndex(BoneIndex);
+				FTransform& ComponentSpaceTransform = ComponentSpaceTransforms[BoneIndex];
+				ComponentSpaceTransform = ParentIndex != INDEX_NONE ? BoneSpaceTransforms[BoneIndex] * ComponentSpaceTransforms[ParentIndex] : BoneSpaceTransforms[BoneIndex];
+
+				const int32 JointIndex = BoneToJointIndex[BoneIndex];
+				if (JointIndex == INDEX_NONE)
+				{
+					continue;
+				}
+
+				const FQuat& BoneRotation = JointRotations[JointIndex];
+				if (!BoneRotation.IsIdentity() && BoneRotation.IsNormalized())
 				{
-					SetBoneRotationByName(BoneElem.Value, BoneRotation.Rotator(), EBoneSpaces::ComponentSpace);
+					ComponentSpaceTransform.SetRotation(BoneRotation);
+					BoneSpaceTransforms[BoneIndex] = ParentIndex != INDEX_NONE ? ComponentSpaceTransform.GetRelativeTransform(ComponentSpaceTransforms[ParentIndex]) : ComponentSpaceTransform;
 				}
 			}
 		}
@@ -33,9 +33,21 @@ public:
  	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "CustomSkeletalMesh")
  	TMap<EPICOXRHandJoint, FName> BoneNameMappings;
 
+ 	/** Re-resolves BoneNameMappings against the skeletal mesh, call after changing the mappings at runtime */
+ 	UFUNCTION(BlueprintCallable, Category = "CustomSkeletalMesh")
+ 	void RefreshBoneMappings();
+
  private:
  	/** Whether or not a custom hand mesh is being used */
  	bool bCustomHandMesh = false;
+
+ 	/** Mesh the bone remap below was resolved against */
+ 	TWeakObjectPtr<const UObject> BoneMappingAsset;
+ 	/** Hand joint driving each bone of the mesh, INDEX_NONE for bones without a mapping */
+ 	TArray<int32> BoneToJointIndex;
+ 	/** Scratch buffers reused every tick */
+ 	TArray<FQuat> JointRotations;
+ 	TArray<FTransform> ComponentSpaceTransforms;
 	
  	void UpdateBonePose();
  	void UpdateHandTransform();
@@ -535,6 +535,22 @@ FQuat UPICOXRInputFunctionLibrary::GetBoneRotation(EPICOXRHandType SkeletonType,
     return FQuat();
 }
 
+bool UPICOXRInputFunctionLibrary::GetBoneRotations(const EPICOXRHandType DeviceHand, TArrayView<FQuat> OutRotations)
+{
+	check(OutRotations.Num() >= EHandJointCount);
+	IPXR_HandTracker* HandTracker = GetHandTracker();
+	if (!HandTracker)
+	{
+		return false;
+	}
+
+	for (int32 Joint = 0; Joint < EHandJointCount; ++Joint)
+	{
+		OutRotations[Joint] = HandTracker->GetBoneRotation(DeviceHand, static_cast<EPICOXRHandJoint>(Joint));
+	}
+	return true;
+}
+
 FVector UPICOXRInputFunctionLibrary::GetBoneLocation(EPICOXRHandType DeviceHand, EPICOXRHandJoint Key)
 {
 	IPXR_HandTracker* HandTracker=GetHandTracker();
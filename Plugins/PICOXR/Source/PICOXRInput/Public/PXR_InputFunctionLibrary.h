@@ -874,6 +874,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "PXR|PXRHandTracking")
 	static FQuat GetBoneRotation(const EPICOXRHandType DeviceHand, const EPICOXRHandJoint Key);
 
+	/** Fills OutRotations (EHandJointCount entries, indexed by EPICOXRHandJoint) from a single hand tracker lookup */
+	static bool GetBoneRotations(const EPICOXRHandType DeviceHand, TArrayView<FQuat> OutRotations);
+
     /// <summary>Returns the position of the skeletal node for the specified hand component.</summary>
     /// <param name ="DeviceHand">(In) EPICOXRHandType, specifies which hand component to identify.
     /// <ul>
@@ -35,28 +35,27 @@ UPICOAnchorComponent::UPICOAnchorComponent(const FObjectInitializer& ObjectIniti
 	: Super(ObjectInitializer)
 {
 	AnchorHandle = 0;
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.bStartWithTickEnabled = true;
-	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	UpdateRate = EPICOAnchorUpdateRate::AnchorUpdateRate_EveryFrame;
+	PoseUpdateIndex = INDEX_NONE;
+	// Poses are updated in one batch by FPICOAnchorManager
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UPICOAnchorComponent::BeginPlay()
 {
 	Super::BeginPlay();
+	FPICOAnchorManager::GetInstance()->RegisterAnchorComponent(this);
 }
 
 void UPICOAnchorComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	if (IsValid(GetOwner()) && IsValid(GetWorld()))
-	{
-		FPICOAnchorManager::GetInstance()->UpdateAnchor(this);
-	}
 }
 
 void UPICOAnchorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+	FPICOAnchorManager::GetInstance()->UnregisterAnchorComponent(this);
 
 	if (IsAnchorValid())
 	{
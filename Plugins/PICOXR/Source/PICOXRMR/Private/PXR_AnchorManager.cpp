@@ -8,6 +8,18 @@
 #include "PXR_HMDModule.h"
 #include "PXR_HMDPrivate.h"
 
+static TAutoConsoleVariable<float> CVarPICOAnchorLocationTolerance(
+	TEXT("pxr.MR.AnchorLocationTolerance"),
+	0.01f,
+	TEXT("Distance in unreal units an anchor pose has to move before its actor is updated\n"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarPICOAnchorRotationTolerance(
+	TEXT("pxr.MR.AnchorRotationTolerance"),
+	0.01f,
+	TEXT("Angle in degrees an anchor pose has to rotate before its actor is updated\n"),
+	ECVF_Default);
+
 FPICOAnchorManager::FPICOAnchorManager()
 {
 	PXR_LOGI(PxrMR, "FPICOAnchorManager Construction");
@@ -54,6 +66,12 @@ void FPICOAnchorManager::Shutdown()
 	{
 		PICOXRHMD->OnPollEventDelegate().Remove(HandleOfPollEvent);
 	}
+
+	for (auto& Pair : AnchorPoseWorlds)
+	{
+		Pair.Value.TickFunction->UnRegisterTickFunction();
+	}
+	AnchorPoseWorlds.Empty();
 }
 
 void FPICOAnchorManager::PollEvent(PxrEventDataBuffer* EventData)
@@ -714,6 +732,131 @@ bool FPICOAnchorManager::UpdateAnchor(UPICOAnchorComponent* AnchorComponent)
 	return true;
 }
 
+void FPICOAnchorManager::RegisterAnchorComponent(UPICOAnchorComponent* AnchorComponent)
+{
+	check(IsInGameThread());
+	UWorld* World = IsValid(AnchorComponent) ? AnchorComponent->GetWorld() : nullptr;
+	if (!World || AnchorComponent->PoseUpdateIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	FAnchorPoseWorld& PoseWorld = AnchorPoseWorlds.FindOrAdd(World);
+	if (!PoseWorld.TickFunction.IsValid())
+	{
+		PoseWorld.TickFunction = MakeUnique<FAnchorPoseTickFunction>();
+		PoseWorld.TickFunction->World = World;
+		PoseWorld.TickFunction->bCanEverTick = true;
+		PoseWorld.TickFunction->bTickEvenWhenPaused = false;
+		PoseWorld.TickFunction->TickGroup = TG_PostUpdateWork;
+		PoseWorld.TickFunction->RegisterTickFunction(World->PersistentLevel);
+	}
+
+	AnchorComponent->PoseUpdateIndex = PoseWorld.AnchorComponents.Add(AnchorComponent);
+}
+
+void FPICOAnchorManager::UnregisterAnchorComponent(UPICOAnchorComponent* AnchorComponent)
+{
+	check(IsInGameThread());
+	if (!AnchorComponent || AnchorComponent->PoseUpdateIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FAnchorPoseWorld* PoseWorld = AnchorPoseWorlds.Find(AnchorComponent->GetWorld());
+	const int32 Index = AnchorComponent->PoseUpdateIndex;
+	AnchorComponent->PoseUpdateIndex = INDEX_NONE;
+	if (!PoseWorld || !PoseWorld->AnchorComponents.IsValidIndex(Index) || PoseWorld->AnchorComponents[Index].Get() != AnchorComponent)
+	{
+		return;
+	}
+
+	PoseWorld->AnchorComponents.RemoveAtSwap(Index, 1, false);
+	if (PoseWorld->AnchorComponents.IsValidIndex(Index))
+	{
+		if (UPICOAnchorComponent* MovedComponent = PoseWorld->AnchorComponents[Index].Get())
+		{
+			MovedComponent->PoseUpdateIndex = Index;
+		}
+	}
+
+	if (PoseWorld->AnchorComponents.Num() == 0)
+	{
+		PoseWorld->TickFunction->UnRegisterTickFunction();
+		AnchorPoseWorlds.Remove(AnchorComponent->GetWorld());
+	}
+}
+
+void FPICOAnchorManager::FAnchorPoseTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	FPICOAnchorManager::GetInstance()->UpdateAnchorPoses(World.Get());
+}
+
+void FPICOAnchorManager::UpdateAnchorPoses(UWorld* World)
+{
+	FAnchorPoseWorld* PoseWorld = World ? AnchorPoseWorlds.Find(World) : nullptr;
+	if (!PoseWorld || !PICOXRHMD)
+	{
+		return;
+	}
+
+	const uint32 FrameIndex = PoseWorld->FrameIndex++;
+
+	// Everything but the anchor pose itself is shared by all anchors of this frame
+	PxrTrackingOrigin TrackingOrigin = PxrTrackingOrigin::PXR_EYE_LEVEL;
+	FPICOXRHMDModule::GetPluginWrapper().GetTrackingOrigin(&TrackingOrigin);
+
+	const float WorldToMetersScale = World->GetWorldSettings()->WorldToMeters;
+	const FQuat BaseOrientation = PICOXRHMD->GetBaseOrientation();
+	const FVector BaseOffset = PICOXRHMD->GetBaseOffsetInMeters();
+	const FTransform TrackingToWorld = PICOXRHMD->GetTrackingToWorldTransform();
+	const float LocationTolerance = CVarPICOAnchorLocationTolerance.GetValueOnGameThread();
+	const float RotationTolerance = FMath::DegreesToRadians(CVarPICOAnchorRotationTolerance.GetValueOnGameThread());
+
+	for (int32 Index = 0; Index < PoseWorld->AnchorComponents.Num(); Index++)
+	{
+		UPICOAnchorComponent* AnchorComponent = PoseWorld->AnchorComponents[Index].Get();
+		if (!IsValid(AnchorComponent) || !AnchorComponent->IsAnchorValid())
+		{
+			continue;
+		}
+
+		// Spread slower anchors over the frames instead of updating them all at once
+		const uint32 Interval = 1u << static_cast<uint32>(AnchorComponent->GetUpdateRate());
+		if (((FrameIndex + static_cast<uint32>(Index)) & (Interval - 1)) != 0)
+		{
+			continue;
+		}
+
+		AActor* BoundActor = AnchorComponent->GetOwner();
+		if (!IsValid(BoundActor))
+		{
+			continue;
+		}
+
+		PxrPosef AnchorPose;
+		EPICOResult Result = CastToPICOResult(FPICOXRHMDModule::GetPluginWrapper().GetAnchorPose(AnchorComponent->GetAnchorHandle().GetValue(), TrackingOrigin, &AnchorPose));
+		if (PXR_FAILURE(Result))
+		{
+			continue;
+		}
+
+		FPose UnrealPose;
+		ConvertPose_Private(AnchorPose, UnrealPose, BaseOrientation, BaseOffset, WorldToMetersScale);
+
+		const FVector Location = TrackingToWorld.TransformPosition(UnrealPose.Position);
+		const FQuat Rotation = TrackingToWorld.TransformRotation(UnrealPose.Orientation);
+
+		if (FVector::DistSquared(Location, BoundActor->GetActorLocation()) <= FMath::Square(LocationTolerance)
+			&& Rotation.AngularDistance(BoundActor->GetActorQuat()) <= RotationTolerance)
+		{
+			continue;
+		}
+
+		BoundActor->SetActorLocationAndRotation(Location, Rotation);
+	}
+}
+
 void FPICOAnchorManager::HandleCreateAnchorEntityEvent(uint64_t AsyncTaskId, EPICOResult Result, const FPICOAnchor& AnchorHandle, const FPICOAnchorUUID& AnchorUUID)
 {
 	PXR_LOGI(PxrMR, "FPICOAnchorManager::HandleCreateAnchorEntityEvent Params: AsyncTaskId[%llu], Result[%d], AnchorHandle[%llu], AnchorUUID[%s]", (uint64)AsyncTaskId, (int32)Result, (uint64)AnchorHandle.GetValue(), *AnchorUUID.ToString());
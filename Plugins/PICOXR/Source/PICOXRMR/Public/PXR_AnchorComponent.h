@@ -60,7 +60,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "PXR|MR")
 	FString GetAnchorUUIDString() const {return AnchorUUID.ToString(); }
 
+	UFUNCTION(BlueprintCallable, Category = "PXR|MR")
+	void SetUpdateRate(EPICOAnchorUpdateRate NewUpdateRate) { UpdateRate = NewUpdateRate; }
+
+	UFUNCTION(BlueprintCallable, Category = "PXR|MR")
+	EPICOAnchorUpdateRate GetUpdateRate() const { return UpdateRate; }
+
 protected:
 	FPICOAnchor AnchorHandle;
 	FPICOAnchorUUID AnchorUUID;
+
+	/** How often the anchor manager refreshes the pose of the bound actor */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "PXR|MR")
+	EPICOAnchorUpdateRate UpdateRate;
+
+private:
+	friend class FPICOAnchorManager;
+
+	/** Slot in the anchor manager's pose update list */
+	int32 PoseUpdateIndex;
 };
\ No newline at end of file
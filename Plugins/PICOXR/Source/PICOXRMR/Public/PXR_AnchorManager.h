@@ -56,6 +56,11 @@ public:
 	bool GetAnchorPose(UPICOAnchorComponent* AnchorComponent, FTransform& OutAnchorPose);
 	bool UpdateAnchor(UPICOAnchorComponent* AnchorComponent);
 
+	void RegisterAnchorComponent(UPICOAnchorComponent* AnchorComponent);
+	void UnregisterAnchorComponent(UPICOAnchorComponent* AnchorComponent);
+	/** Queries the poses of every anchor registered in World and moves the actors whose pose changed */
+	void UpdateAnchorPoses(UWorld* World);
+
 private:
 	FPICOAnchorManager();
 	~FPICOAnchorManager();
@@ -99,6 +104,24 @@ private:
 
 	EPICOResult CastToPICOResult(PxrResult Result);
 
+	struct FAnchorPoseTickFunction : public FTickFunction
+	{
+		TWeakObjectPtr<UWorld> World;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override { return TEXT("FPICOAnchorManager::UpdateAnchorPoses"); }
+	};
+
+	/** Anchors of one world, updated by a single tick function */
+	struct FAnchorPoseWorld
+	{
+		TUniquePtr<FAnchorPoseTickFunction> TickFunction;
+		TArray<TWeakObjectPtr<UPICOAnchorComponent>> AnchorComponents;
+		uint32 FrameIndex = 0;
+	};
+
+	TMap<TWeakObjectPtr<UWorld>, FAnchorPoseWorld> AnchorPoseWorlds;
+
 	struct FAnchorCreateInfo
 	{
 		uint64_t AsyncTaskId;
@@ -117,6 +117,15 @@ enum class EPICOLoadFilterType : uint8
 	LoadFilterType_SpatialSceneData = 2
 };
 
+UENUM(BlueprintType)
+enum class EPICOAnchorUpdateRate : uint8
+{
+	AnchorUpdateRate_EveryFrame			= 0,
+	AnchorUpdateRate_EverySecondFrame	= 1,
+	AnchorUpdateRate_EveryFourthFrame	= 2,
+	AnchorUpdateRate_EveryEighthFrame	= 3
+};
+
 UENUM(BlueprintType)
 enum class EPICOSpatialSceneCaptureStatus : uint8
 {
@@ -16,12 +16,19 @@ UPXR_FaceTrackingComponent::UPXR_FaceTrackingComponent()
 	: FTTargetMeshComponentName(NAME_None)
 	, InvalidFaceDataResetTime(2.0f)
 	, bUpdateFaceTracking(true)
+	, BlendShapeChangeThreshold(0.001f)
+	, BlendShapeSmoothingTime(0.0f)
 	, FTTargetMeshComponent(nullptr)
 	, IsTracking(false)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
 
+	for (bool& bValid : ValidBlendShape)
+	{
+		bValid = false;
+	}
+
 	BlendShapeNameMapping.Add(EPXRFaceBlendShape::BrowInnerUp, "browInnerUp");
 	BlendShapeNameMapping.Add(EPXRFaceBlendShape::BrowDown_R, "browDown_R");
 	BlendShapeNameMapping.Add(EPXRFaceBlendShape::BrowDown_L, "browDown_L");
@@ -168,14 +175,14 @@ void UPXR_FaceTrackingComponent::TickComponent(float DeltaTime, enum ELevelTick
 		UPICOXRMotionTrackingFunctionLibrary::GetFaceTrackingData(GetInfo, FaceData);
 		InvalidFaceDataTimer = 0.0f;
 
-		MorphTargetsManager.ResetMeshMorphTargetCurves(FTTargetMeshComponent);
-
-		for (int32 FaceBlendShapeIndex = 0; FaceBlendShapeIndex < static_cast<int32>(EPXRFaceBlendShape::COUNT); ++FaceBlendShapeIndex)
+		const int32 NumWeights = FMath::Min(FaceData.BlendShapeWeights.Num(), static_cast<int32>(EPXRFaceBlendShape::COUNT));
+		const float SmoothingAlpha = BlendShapeSmoothingTime > 0.0f ? 1.0f - FMath::Exp(-DeltaTime / BlendShapeSmoothingTime) : 1.0f;
+		for (int32 FaceBlendShapeIndex = 0; FaceBlendShapeIndex < NumWeights; ++FaceBlendShapeIndex)
 		{
 			if (ValidBlendShape[FaceBlendShapeIndex])
 			{
-				FName BlendShapeName = BlendShapeNameMapping[static_cast<EPXRFaceBlendShape>(FaceBlendShapeIndex)];
-				MorphTargetsManager.SetMeshMorphTargetValue(BlendShapeName, FaceData.BlendShapeWeights[FaceBlendShapeIndex]);
+				const float PreviousWeight = MorphTargetsManager.GetMorphTargetSlotWeight(FaceBlendShapeIndex);
+				MorphTargetsManager.SetMorphTargetSlotWeight(FaceBlendShapeIndex, FMath::Lerp(PreviousWeight, FaceData.BlendShapeWeights[FaceBlendShapeIndex], SmoothingAlpha));
 			}
 		}
 	}
@@ -184,14 +191,14 @@ void UPXR_FaceTrackingComponent::TickComponent(float DeltaTime, enum ELevelTick
 		InvalidFaceDataTimer += DeltaTime;
 		if (InvalidFaceDataTimer >= InvalidFaceDataResetTime)
 		{
-			MorphTargetsManager.ResetMeshMorphTargetCurves(FTTargetMeshComponent);
+			MorphTargetsManager.ResetMorphTargetSlotWeights();
 			static const UEnum* Enum = StaticEnum<EPXRFaceTrackingMode>();
 			check(Enum);
 			PXR_LOGW(PxrUnreal, "Face tracker is not tracking.Mode:%s,State code:%s", *Enum->GetNameStringByValue(int64(TrackingState.TrackingStateCode)));
 		}
 	}
 
-	MorphTargetsManager.UpdateMeshMorphTargets(FTTargetMeshComponent);
+	MorphTargetsManager.ApplyMorphTargetSlotWeights(FTTargetMeshComponent, BlendShapeChangeThreshold);
 }
 
 void UPXR_FaceTrackingComponent::SetBlendShapeValue(EPXRFaceBlendShape BlendShape, float Value)
@@ -208,8 +215,7 @@ void UPXR_FaceTrackingComponent::SetBlendShapeValue(EPXRFaceBlendShape BlendShap
 		return;
 	}
 
-	FName BlendShapeName = BlendShapeNameMapping[BlendShape];
-	MorphTargetsManager.SetMeshMorphTargetValue(BlendShapeName, Value);
+	MorphTargetsManager.SetMorphTargetSlotWeight(static_cast<int32>(BlendShape), Value);
 }
 
 float UPXR_FaceTrackingComponent::GetBlendShapeValue(EPXRFaceBlendShape BlendShape) const
@@ -220,19 +226,18 @@ float UPXR_FaceTrackingComponent::GetBlendShapeValue(EPXRFaceBlendShape BlendSha
 		return 0.0f;
 	}
 
-	FName BlendShapeName = BlendShapeNameMapping[BlendShape];
-	if (BlendShapeName == NAME_None)
+	if (!ValidBlendShape[static_cast<int32>(BlendShape)])
 	{
 		PXR_LOGW(PxrUnreal, "Cannot request BlendShape value for an BlendShape with an invalid associated morph target name. BlendShape name: %s", *StaticEnum<EPXRFaceBlendShape>()->GetValueAsString(BlendShape));
 		return 0.0f;
 	}
 
-	return MorphTargetsManager.GetMeshMorphTargetValue(BlendShapeName);
+	return MorphTargetsManager.GetMorphTargetSlotWeight(static_cast<int32>(BlendShape));
 }
 
 void UPXR_FaceTrackingComponent::ClearBlendShapeValues()
 {
-	MorphTargetsManager.EmptyMorphTargets();
+	MorphTargetsManager.ResetMorphTargetSlotWeights();
 }
 
 bool UPXR_FaceTrackingComponent::InitializeFaceTracking()
@@ -245,13 +250,23 @@ bool UPXR_FaceTrackingComponent::InitializeFaceTracking()
 		return false;
 	}
 
-	if (FTTargetMeshComponent && FTTargetMeshComponent->GetSkinnedAsset())
+	// Blend shapes index the morph target slots directly
+	TArray<FName, TInlineAllocator<static_cast<int32>(EPXRFaceBlendShape::COUNT)>> SlotNames;
+	SlotNames.Init(NAME_None, static_cast<int32>(EPXRFaceBlendShape::COUNT));
+	for (const auto& it : BlendShapeNameMapping)
 	{
-		const TMap<FName, int32>& MorphTargetIndexMap = Cast<USkeletalMesh>(FTTargetMeshComponent->GetSkinnedAsset())->GetMorphTargetIndexMap();
+		if (it.Key < EPXRFaceBlendShape::COUNT)
+		{
+			SlotNames[static_cast<int32>(it.Key)] = it.Value;
+		}
+	}
+	MorphTargetsManager.SetMorphTargetSlots(SlotNames);
 
-		for (const auto& it : BlendShapeNameMapping)
+	if (MorphTargetsManager.BindMorphTargetSlots(FTTargetMeshComponent))
+	{
+		for (int32 FaceBlendShapeIndex = 0; FaceBlendShapeIndex < static_cast<int32>(EPXRFaceBlendShape::COUNT); ++FaceBlendShapeIndex)
 		{
-			ValidBlendShape[static_cast<int32>(it.Key)] = MorphTargetIndexMap.Contains(it.Value);
+			ValidBlendShape[FaceBlendShapeIndex] = MorphTargetsManager.IsMorphTargetSlotBound(FaceBlendShapeIndex);
 		}
 
 		return true;
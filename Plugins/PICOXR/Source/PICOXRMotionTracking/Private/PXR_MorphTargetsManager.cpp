@@ -5,6 +5,8 @@
 #include "PXR_MorphTargetsManager.h"
 
 #include "AnimationRuntime.h"
+#include "Animation/MorphTarget.h"
+#include "Engine/SkeletalMesh.h"
 
 void FPXRMorphTargetsManager::ResetMeshMorphTargetCurves(USkinnedMeshComponent* TargetMeshComponent)
 {
@@ -77,3 +79,114 @@ void FPXRMorphTargetsManager::EmptyMorphTargets()
 {
 	MeshMorphTargetCurves.Empty();
 }
+
+void FPXRMorphTargetsManager::SetMorphTargetSlots(TArrayView<const FName> InSlotNames)
+{
+	SlotNames = TArray<FName>(InSlotNames);
+	SlotWeights.Init(0.0f, SlotNames.Num());
+	AppliedSlotWeights.Init(0.0f, SlotNames.Num());
+	SlotMorphTargets.Init(nullptr, SlotNames.Num());
+	SlotMorphTargetIndices.Init(INDEX_NONE, SlotNames.Num());
+	BoundAsset = nullptr;
+}
+
+bool FPXRMorphTargetsManager::BindMorphTargetSlots(USkinnedMeshComponent* TargetMeshComponent)
+{
+	const USkeletalMesh* SkeletalMesh = TargetMeshComponent ? Cast<USkeletalMesh>(TargetMeshComponent->GetSkinnedAsset()) : nullptr;
+	BoundAsset = SkeletalMesh;
+	NumActiveSlots = 0;
+	if (!SkeletalMesh)
+	{
+		SlotMorphTargets.Init(nullptr, SlotNames.Num());
+		SlotMorphTargetIndices.Init(INDEX_NONE, SlotNames.Num());
+		return false;
+	}
+
+	for (int32 Slot = 0; Slot < SlotNames.Num(); ++Slot)
+	{
+		int32 MorphTargetIndex = INDEX_NONE;
+		SlotMorphTargets[Slot] = SlotNames[Slot] != NAME_None ? SkeletalMesh->FindMorphTargetAndIndex(SlotNames[Slot], MorphTargetIndex) : nullptr;
+		SlotMorphTargetIndices[Slot] = SlotMorphTargets[Slot] ? MorphTargetIndex : INDEX_NONE;
+	}
+
+	// Force the next apply to rebuild the component's morph target state
+	AppliedSlotWeights.Init(0.0f, SlotNames.Num());
+	bRebuildActiveMorphTargets = true;
+	return true;
+}
+
+void FPXRMorphTargetsManager::ResetMorphTargetSlotWeights()
+{
+	if (SlotWeights.Num() > 0)
+	{
+		FMemory::Memzero(SlotWeights.GetData(), SlotWeights.Num() * sizeof(float));
+	}
+}
+
+void FPXRMorphTargetsManager::ApplyMorphTargetSlotWeights(USkinnedMeshComponent* TargetMeshComponent, float ChangeThreshold)
+{
+	if (!TargetMeshComponent || !TargetMeshComponent->GetSkinnedAsset())
+	{
+		return;
+	}
+
+	if (BoundAsset.Get() != TargetMeshComponent->GetSkinnedAsset())
+	{
+		BindMorphTargetSlots(TargetMeshComponent);
+	}
+
+	const int32 NumMorphTargets = TargetMeshComponent->GetSkinnedAsset()->GetMorphTargets().Num();
+
+	// Only a change in which morph targets are active needs the component's active map rebuilt,
+	// otherwise weights are written in place through the cached indices
+	bool bActiveSetChanged = bRebuildActiveMorphTargets
+		|| TargetMeshComponent->MorphTargetWeights.Num() != NumMorphTargets
+		|| TargetMeshComponent->ActiveMorphTargets.Num() != NumActiveSlots;
+	bool bWeightsChanged = false;
+	for (int32 Slot = 0; Slot < SlotWeights.Num(); ++Slot)
+	{
+		if (SlotMorphTargets[Slot] && FMath::Abs(SlotWeights[Slot] - AppliedSlotWeights[Slot]) > ChangeThreshold)
+		{
+			const bool bWasActive = FPlatformMath::Abs(AppliedSlotWeights[Slot]) > ZERO_ANIMWEIGHT_THRESH;
+			const bool bIsActive = FPlatformMath::Abs(SlotWeights[Slot]) > ZERO_ANIMWEIGHT_THRESH;
+			bActiveSetChanged |= bWasActive != bIsActive;
+			AppliedSlotWeights[Slot] = SlotWeights[Slot];
+			bWeightsChanged = true;
+		}
+	}
+
+	if (bActiveSetChanged)
+	{
+		TargetMeshComponent->ActiveMorphTargets.Reset();
+		TargetMeshComponent->MorphTargetWeights.SetNum(NumMorphTargets);
+		if (NumMorphTargets > 0)
+		{
+			FMemory::Memzero(TargetMeshComponent->MorphTargetWeights.GetData(), NumMorphTargets * sizeof(float));
+		}
+
+		bRebuildActiveMorphTargets = false;
+		NumActiveSlots = 0;
+		for (int32 Slot = 0; Slot < SlotWeights.Num(); ++Slot)
+		{
+			const int32 MorphTargetIndex = SlotMorphTargetIndices[Slot];
+			if (MorphTargetIndex != INDEX_NONE && FPlatformMath::Abs(AppliedSlotWeights[Slot]) > ZERO_ANIMWEIGHT_THRESH
+				&& !TargetMeshComponent->ActiveMorphTargets.Contains(SlotMorphTargets[Slot]))
+			{
+				TargetMeshComponent->ActiveMorphTargets.Add(SlotMorphTargets[Slot], MorphTargetIndex);
+				TargetMeshComponent->MorphTargetWeights[MorphTargetIndex] = AppliedSlotWeights[Slot];
+				++NumActiveSlots;
+			}
+		}
+	}
+	else if (bWeightsChanged)
+	{
+		for (int32 Slot = 0; Slot < SlotWeights.Num(); ++Slot)
+		{
+			const int32 MorphTargetIndex = SlotMorphTargetIndices[Slot];
+			if (MorphTargetIndex != INDEX_NONE && FPlatformMath::Abs(AppliedSlotWeights[Slot]) > ZERO_ANIMWEIGHT_THRESH)
+			{
+				TargetMeshComponent->MorphTargetWeights[MorphTargetIndex] = AppliedSlotWeights[Slot];
+			}
+		}
+	}
+}
@@ -42,6 +42,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|FaceTracking")
 	bool bUpdateFaceTracking;
 
+	/** Blend shape weights that moved less than this since they were last applied are not pushed to the mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|FaceTracking", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float BlendShapeChangeThreshold;
+
+	/** Time constant in seconds of the exponential smoothing applied to tracked weights, 0 disables smoothing */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PXR|FaceTracking", meta = (ClampMin = "0.0"))
+	float BlendShapeSmoothingTime;
+
 private:
 	bool InitializeFaceTracking();
 
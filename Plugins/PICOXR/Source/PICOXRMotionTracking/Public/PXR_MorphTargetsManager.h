@@ -6,6 +6,8 @@
 
 #include "Components/SkinnedMeshComponent.h"
 
+class UMorphTarget;
+
 struct PICOXRMOTIONTRACKING_API FPXRMorphTargetsManager
 {
 public:
@@ -15,4 +17,33 @@ public:
 	float GetMeshMorphTargetValue(FName MorphTargetName) const;
 	void EmptyMorphTargets();
 	TMap<FName, float> MeshMorphTargetCurves;
+
+	/**
+	 * Dense alternative to the curve map above: each slot names one morph target, and the slot to
+	 * morph target index table is resolved once per mesh so per frame updates do no name lookups.
+	 */
+	void SetMorphTargetSlots(TArrayView<const FName> SlotNames);
+	/**
+	 * Returns false if the component has no skeletal mesh. Slots whose morph target does not exist on
+	 * the mesh still bind, to nothing, and are reported by IsMorphTargetSlotBound.
+	 */
+	bool BindMorphTargetSlots(USkinnedMeshComponent* TargetMeshComponent);
+	bool IsMorphTargetSlotBound(int32 Slot) const { return SlotMorphTargets.IsValidIndex(Slot) && SlotMorphTargets[Slot] != nullptr; }
+	void SetMorphTargetSlotWeight(int32 Slot, float Value) { if (SlotWeights.IsValidIndex(Slot)) { SlotWeights[Slot] = Value; } }
+	float GetMorphTargetSlotWeight(int32 Slot) const { return SlotWeights.IsValidIndex(Slot) ? SlotWeights[Slot] : 0.0f; }
+	void ResetMorphTargetSlotWeights();
+	/** Pushes slot weights that moved by more than ChangeThreshold to the mesh component */
+	void ApplyMorphTargetSlotWeights(USkinnedMeshComponent* TargetMeshComponent, float ChangeThreshold);
+
+private:
+	TArray<FName> SlotNames;
+	TArray<float> SlotWeights;
+	/** Last weights written to the mesh component, compared against SlotWeights with the change threshold */
+	TArray<float> AppliedSlotWeights;
+	TArray<const UMorphTarget*> SlotMorphTargets;
+	TArray<int32> SlotMorphTargetIndices;
+	TWeakObjectPtr<const USkinnedAsset> BoundAsset;
+	/** Number of morph targets this manager last registered as active on the component */
+	int32 NumActiveSlots = 0;
+	bool bRebuildActiveMorphTargets = true;
 };
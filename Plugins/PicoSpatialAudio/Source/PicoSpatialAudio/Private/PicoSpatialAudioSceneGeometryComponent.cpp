@@ -4,6 +4,8 @@
 #include "PicoSpatialAudioSceneGeometryComponent.h"
 
 #include "PxrAudioSpatializerContextSingleton.h"
+#include "Async/ParallelFor.h"
+#include "StaticMeshResources.h"
 
 // Sets default values for this component's properties
 UPicoSpatialAudioSceneGeometryComponent::UPicoSpatialAudioSceneGeometryComponent()
@@ -129,7 +131,8 @@ int32 UPicoSpatialAudioSceneGeometryComponent::SubmitToContext()
 	//	2.1 count gathered vertices and indices
 	BatchStaticMeshes(GatheredStaticMeshes, GatheredStaticMeshTransforms, GetOwner()->GetTransform(),
 	                  BatchedMeshVerticesBuffer,
-	                  BatchedMeshIndicesBuffer);
+	                  BatchedMeshIndicesBuffer,
+	                  BatchedMeshRanges);
 
 	//	3. Submit batched UStaticMeshes to engine
 	if (BatchedMeshVerticesBuffer.Num() > 0 && BatchedMeshIndicesBuffer.Num() > 0)
@@ -208,9 +211,11 @@ void UPicoSpatialAudioSceneGeometryComponent::BakeMesh()
 
 	//	2. Batch UStaticMesh into one vertices and indices buffer;
 	//	2.1 count gathered vertices and indices
+	TArray<FPicoSpatialAudioBatchedMeshRange> BakedMeshRanges;
 	BatchStaticMeshes(GatheredStaticMeshes, GatheredStaticMeshTransforms, GetOwner()->GetTransform(),
 	                  BatchedBakedMeshVerticesBuffer,
-	                  BatchedBakedMeshIndicesBuffer);
+	                  BatchedBakedMeshIndicesBuffer,
+	                  BakedMeshRanges);
 
 	UE_LOG(LogPicoSpatialAudio, Display, TEXT("Baked meshes of %d triangles for %s"),
 	       BatchedBakedMeshIndicesBuffer.Num() / 3, *GetOwner()->GetName());
@@ -370,68 +375,118 @@ void UPicoSpatialAudioSceneGeometryComponent::BatchStaticMeshes(const TArray<USt
                                                                 InGatheredStaticMeshTransforms,
                                                                 const FTransform& RootTransform,
                                                                 TArray<float>& OutBatchedMeshVerticesBuffer,
-                                                                TArray<int32>& OutBatchedMeshIndicesBuffer)
+                                                                TArray<int32>& OutBatchedMeshIndicesBuffer,
+                                                                TArray<FPicoSpatialAudioBatchedMeshRange>&
+                                                                InOutBatchedMeshRanges)
 {
-	size_t VerticesCount = 0;
-	size_t IndicesCount = 0;
-	for (const auto& StaticMesh : InGatheredStaticMeshes)
+	//	Vertices handled by one task, so a single huge mesh is still spread over several workers
+	constexpr int32 VerticesPerTask = 16 * 1024;
+
+	struct FBatchTask
 	{
-#if ENGINE_MAJOR_VERSION < 5
-		const auto& MeshLODResources = StaticMesh->RenderData->LODResources[0];
-#else
-		const auto& MeshLODResources = StaticMesh->GetRenderData()->LODResources[0];
-#endif
-		VerticesCount += MeshLODResources.VertexBuffers.PositionVertexBuffer.GetNumVertices();
-		IndicesCount += MeshLODResources.IndexBuffer.GetNumIndices();
-	}
-	OutBatchedMeshVerticesBuffer.SetNum(VerticesCount * 3, true);
-	OutBatchedMeshIndicesBuffer.SetNum(IndicesCount, true);
-
-	float* OutVertex = OutBatchedMeshVerticesBuffer.GetData();
-	TArray<uint32> TempIndicesBuffer;
-	uint32 BatchedIndicesOffset = 0;
-	uint32 BatchedIndicesStart = 0;
-	for (size_t MeshIdx = 0; MeshIdx < InGatheredStaticMeshes.Num(); ++MeshIdx)
+		int32 MeshIdx;
+		int32 VertexBegin;
+		int32 VertexEnd;
+		int32 IndexBegin;
+		int32 IndexEnd;
+	};
+
+	//	1. Resolve LOD0 of every mesh on this thread, the tasks only read the CPU copies of its buffers
+	const int32 MeshNum = InGatheredStaticMeshes.Num();
+	TArray<const FStaticMeshLODResources*, TInlineAllocator<16>> MeshLODResources;
+	MeshLODResources.SetNumUninitialized(MeshNum);
+	bool bSameMeshes = InOutBatchedMeshRanges.Num() == MeshNum;
+	for (int32 MeshIdx = 0; MeshIdx < MeshNum; ++MeshIdx)
 	{
-		//	Take alias of specific input static mesh && it's actor's transform 
 		const auto& StaticMesh = InGatheredStaticMeshes[MeshIdx];
-		const auto& Transform = InGatheredStaticMeshTransforms[MeshIdx];
-		const auto RelativeTransformToRoot = Transform.GetRelativeTransform(RootTransform);
 #if ENGINE_MAJOR_VERSION < 5
-		const auto& MeshLODResources = StaticMesh->RenderData->LODResources[0];
+		MeshLODResources[MeshIdx] = &StaticMesh->RenderData->LODResources[0];
 #else
-		const auto& MeshLODResources = StaticMesh->GetRenderData()->LODResources[0];
+		MeshLODResources[MeshIdx] = &StaticMesh->GetRenderData()->LODResources[0];
 #endif
+		if (bSameMeshes)
+		{
+			const auto& Range = InOutBatchedMeshRanges[MeshIdx];
+			bSameMeshes = Range.StaticMesh == StaticMesh &&
+				Range.VertexCount == static_cast<int32>(MeshLODResources[MeshIdx]->VertexBuffers.PositionVertexBuffer.GetNumVertices()) &&
+				Range.IndexCount == MeshLODResources[MeshIdx]->IndexBuffer.GetNumIndices();
+		}
+	}
 
-		//	Write vertices data into OutBatchedMeshVerticesBuffer
-		const auto& VertexBuffer = MeshLODResources.VertexBuffers.PositionVertexBuffer;
-		const uint32 VertexCount = VertexBuffer.GetNumVertices();
-		for (uint32 VertexIdx = 0; VertexIdx < VertexCount; ++VertexIdx)
+	//	2. Lay the meshes out in the batched buffers, unless the previous layout still holds the same meshes
+	if (!bSameMeshes)
+	{
+		InOutBatchedMeshRanges.SetNum(MeshNum);
+		int32 VerticesCount = 0;
+		int32 IndicesCount = 0;
+		for (int32 MeshIdx = 0; MeshIdx < MeshNum; ++MeshIdx)
+		{
+			auto& Range = InOutBatchedMeshRanges[MeshIdx];
+			Range.StaticMesh = InGatheredStaticMeshes[MeshIdx];
+			Range.VertexStart = VerticesCount;
+			Range.VertexCount = MeshLODResources[MeshIdx]->VertexBuffers.PositionVertexBuffer.GetNumVertices();
+			Range.IndexStart = IndicesCount;
+			Range.IndexCount = MeshLODResources[MeshIdx]->IndexBuffer.GetNumIndices();
+			VerticesCount += Range.VertexCount;
+			IndicesCount += Range.IndexCount;
+		}
+		OutBatchedMeshVerticesBuffer.SetNumUninitialized(VerticesCount * 3, true);
+		OutBatchedMeshIndicesBuffer.SetNumUninitialized(IndicesCount, true);
+	}
+
+	//	3. Split the meshes that need (re)batching into tasks. Indices only depend on the layout, so a kept layout
+	//	only transforms the vertices of sub-meshes that moved relative to the root.
+	TArray<FBatchTask> Tasks;
+	for (int32 MeshIdx = 0; MeshIdx < MeshNum; ++MeshIdx)
+	{
+		auto& Range = InOutBatchedMeshRanges[MeshIdx];
+		const FTransform RelativeTransformToRoot = InGatheredStaticMeshTransforms[MeshIdx].GetRelativeTransform(RootTransform);
+		if (bSameMeshes && Range.RelativeTransformToRoot.Equals(RelativeTransformToRoot))
+			continue;
+		Range.RelativeTransformToRoot = RelativeTransformToRoot;
+
+		const int32 IndexCount = bSameMeshes ? 0 : Range.IndexCount;
+		const int32 TaskNum = FMath::Max(1, FMath::DivideAndRoundUp(Range.VertexCount, VerticesPerTask));
+		for (int32 TaskIdx = 0; TaskIdx < TaskNum; ++TaskIdx)
+		{
+			FBatchTask& Task = Tasks.AddDefaulted_GetRef();
+			Task.MeshIdx = MeshIdx;
+			Task.VertexBegin = static_cast<int64>(Range.VertexCount) * TaskIdx / TaskNum;
+			Task.VertexEnd = static_cast<int64>(Range.VertexCount) * (TaskIdx + 1) / TaskNum;
+			Task.IndexBegin = static_cast<int64>(IndexCount) * TaskIdx / TaskNum;
+			Task.IndexEnd = static_cast<int64>(IndexCount) * (TaskIdx + 1) / TaskNum;
+		}
+	}
+
+	//	4. Transform vertices and rebase indices into the batched buffers
+	float* OutVertices = OutBatchedMeshVerticesBuffer.GetData();
+	int32* OutIndices = OutBatchedMeshIndicesBuffer.GetData();
+	ParallelFor(Tasks.Num(), [&](int32 TaskIdx)
+	{
+		const FBatchTask& Task = Tasks[TaskIdx];
+		const auto& Range = InOutBatchedMeshRanges[Task.MeshIdx];
+		const auto& LODResources = *MeshLODResources[Task.MeshIdx];
+
+		const auto& VertexBuffer = LODResources.VertexBuffers.PositionVertexBuffer;
+		float* OutVertex = OutVertices + (Range.VertexStart + Task.VertexBegin) * 3;
+		for (int32 VertexIdx = Task.VertexBegin; VertexIdx < Task.VertexEnd; ++VertexIdx)
 		{
-#if ENGINE_MAJOR_VERSION < 5
-			Pxr_Audio::Spatializer::ConvertToPicoSpatialAudioCoordinates(
-				RelativeTransformToRoot.TransformPosition(VertexBuffer.VertexPosition(VertexIdx)),
-				OutVertex);
-#else
 			const auto& Temp = VertexBuffer.VertexPosition(VertexIdx);
-			UE::Math::TVector<double> Position(Temp.X, Temp.Y, Temp.Z);
+			const FVector Position(Temp.X, Temp.Y, Temp.Z);
 			Pxr_Audio::Spatializer::ConvertToPicoSpatialAudioCoordinates(
-				RelativeTransformToRoot.TransformPosition(Position),
+				Range.RelativeTransformToRoot.TransformPosition(Position),
 				OutVertex);
-#endif
-			
 			OutVertex += 3;
 		}
 
-		//	Write indices data into OutBatchedMeshIndicesBuffer
-		MeshLODResources.IndexBuffer.GetCopy(TempIndicesBuffer);
-		for (size_t TempIndexIdx = 0; TempIndexIdx < TempIndicesBuffer.Num(); ++TempIndexIdx)
+		if (Task.IndexBegin < Task.IndexEnd)
 		{
-			OutBatchedMeshIndicesBuffer[BatchedIndicesOffset + TempIndexIdx] = TempIndicesBuffer[TempIndexIdx] +
-				BatchedIndicesStart;
+			const FIndexArrayView Indices = LODResources.IndexBuffer.GetArrayView();
+			int32* OutIndex = OutIndices + Range.IndexStart;
+			for (int32 IndexIdx = Task.IndexBegin; IndexIdx < Task.IndexEnd; ++IndexIdx)
+			{
+				OutIndex[IndexIdx] = static_cast<int32>(Indices[IndexIdx]) + Range.VertexStart;
+			}
 		}
-
-		BatchedIndicesOffset += TempIndicesBuffer.Num();
-		BatchedIndicesStart += VertexCount;
-	}
+	});
 }
@@ -117,6 +117,160 @@ namespace Pxr_Audio
 			return FMath::Pow(10.0f, DB / 20.0f);
 		}
 
+		namespace
+		{
+			/** Transposes four frames of four channels into four vectors of one channel each */
+			FORCEINLINE void TransposeFrames4x4(const VectorRegister& Frame0, const VectorRegister& Frame1,
+			                                    const VectorRegister& Frame2, const VectorRegister& Frame3,
+			                                    VectorRegister Channels[4])
+			{
+				const VectorRegister Lo01 = VectorShuffle(Frame0, Frame1, 0, 1, 0, 1);
+				const VectorRegister Hi01 = VectorShuffle(Frame0, Frame1, 2, 3, 2, 3);
+				const VectorRegister Lo23 = VectorShuffle(Frame2, Frame3, 0, 1, 0, 1);
+				const VectorRegister Hi23 = VectorShuffle(Frame2, Frame3, 2, 3, 2, 3);
+				Channels[0] = VectorShuffle(Lo01, Lo23, 0, 2, 0, 2);
+				Channels[1] = VectorShuffle(Lo01, Lo23, 1, 3, 1, 3);
+				Channels[2] = VectorShuffle(Hi01, Hi23, 0, 2, 0, 2);
+				Channels[3] = VectorShuffle(Hi01, Hi23, 1, 3, 1, 3);
+			}
+
+			FORCEINLINE VectorRegister SumChannels(const VectorRegister* Channels, int32 NumChannels)
+			{
+				// Same summation order as the scalar path so the results are identical
+				VectorRegister Sum = Channels[0];
+				for (int32 Channel = 1; Channel < NumChannels; ++Channel)
+				{
+					Sum = VectorAdd(Sum, Channels[Channel]);
+				}
+				return Sum;
+			}
+
+			void DownmixInterleavedToMonoScalar(float* InOutBuffer, int32 StartFrame, int32 NumFrames,
+			                                    int32 NumChannels)
+			{
+				const float NumChannelsFloat = static_cast<float>(NumChannels);
+				for (int32 Frame = StartFrame; Frame < NumFrames; ++Frame)
+				{
+					const float* FrameHead = InOutBuffer + Frame * NumChannels;
+					float Sum = FrameHead[0];
+					for (int32 Channel = 1; Channel < NumChannels; ++Channel)
+					{
+						Sum += FrameHead[Channel];
+					}
+					InOutBuffer[Frame] = Sum / NumChannelsFloat;
+				}
+			}
+		}
+
+		void DownmixInterleavedToMono(float* InOutBuffer, const int32 NumFrames, const int32 NumChannels)
+		{
+			if (NumChannels <= 1 || NumFrames <= 0)
+			{
+				return;
+			}
+
+			// Every block is fully loaded before its mono result is stored, and the store never reaches past
+			// the samples already consumed, so the downmix can run in place.
+			const VectorRegister Divisor = VectorSetFloat1(static_cast<float>(NumChannels));
+			const int32 NumVectorFrames = NumFrames & ~3;
+			int32 Frame = 0;
+			VectorRegister Channels[8];
+
+			switch (NumChannels)
+			{
+			case 2:
+				for (; Frame < NumVectorFrames; Frame += 4)
+				{
+					const float* Src = InOutBuffer + Frame * 2;
+					const VectorRegister V0 = VectorLoad(Src);
+					const VectorRegister V1 = VectorLoad(Src + 4);
+					Channels[0] = VectorShuffle(V0, V1, 0, 2, 0, 2);
+					Channels[1] = VectorShuffle(V0, V1, 1, 3, 1, 3);
+					VectorStore(VectorDivide(SumChannels(Channels, 2), Divisor), InOutBuffer + Frame);
+				}
+				break;
+			case 4:
+				for (; Frame < NumVectorFrames; Frame += 4)
+				{
+					const float* Src = InOutBuffer + Frame * 4;
+					TransposeFrames4x4(VectorLoad(Src), VectorLoad(Src + 4), VectorLoad(Src + 8), VectorLoad(Src + 12),
+					                   Channels);
+					VectorStore(VectorDivide(SumChannels(Channels, 4), Divisor), InOutBuffer + Frame);
+				}
+				break;
+			case 6:
+				for (; Frame < NumVectorFrames; Frame += 4)
+				{
+					// Four 6-channel frames span six vectors: channels 0-3 of each frame are regrouped into
+					// whole vectors, channels 4-5 are paired up separately.
+					const float* Src = InOutBuffer + Frame * 6;
+					const VectorRegister V0 = VectorLoad(Src);
+					const VectorRegister V1 = VectorLoad(Src + 4);
+					const VectorRegister V2 = VectorLoad(Src + 8);
+					const VectorRegister V3 = VectorLoad(Src + 12);
+					const VectorRegister V4 = VectorLoad(Src + 16);
+					const VectorRegister V5 = VectorLoad(Src + 20);
+					TransposeFrames4x4(V0, VectorShuffle(V1, V2, 2, 3, 0, 1), V3, VectorShuffle(V4, V5, 2, 3, 0, 1),
+					                   Channels);
+					const VectorRegister Tail01 = VectorShuffle(V1, V2, 0, 1, 2, 3);
+					const VectorRegister Tail23 = VectorShuffle(V4, V5, 0, 1, 2, 3);
+					Channels[4] = VectorShuffle(Tail01, Tail23, 0, 2, 0, 2);
+					Channels[5] = VectorShuffle(Tail01, Tail23, 1, 3, 1, 3);
+					VectorStore(VectorDivide(SumChannels(Channels, 6), Divisor), InOutBuffer + Frame);
+				}
+				break;
+			case 8:
+				for (; Frame < NumVectorFrames; Frame += 4)
+				{
+					const float* Src = InOutBuffer + Frame * 8;
+					TransposeFrames4x4(VectorLoad(Src), VectorLoad(Src + 8), VectorLoad(Src + 16), VectorLoad(Src + 24),
+					                   Channels);
+					TransposeFrames4x4(VectorLoad(Src + 4), VectorLoad(Src + 12), VectorLoad(Src + 20),
+					                   VectorLoad(Src + 28), Channels + 4);
+					VectorStore(VectorDivide(SumChannels(Channels, 8), Divisor), InOutBuffer + Frame);
+				}
+				break;
+			default:
+				break;
+			}
+
+			DownmixInterleavedToMonoScalar(InOutBuffer, Frame, NumFrames, NumChannels);
+		}
+
+		void DownmixStereoToMono(const float* StereoBuffer, float* MonoBuffer, const int32 NumFrames)
+		{
+			const VectorRegister Half = VectorSetFloat1(0.5f);
+			const int32 NumVectorFrames = NumFrames & ~3;
+			int32 Frame = 0;
+			for (; Frame < NumVectorFrames; Frame += 4)
+			{
+				const VectorRegister V0 = VectorLoad(StereoBuffer + Frame * 2);
+				const VectorRegister V1 = VectorLoad(StereoBuffer + Frame * 2 + 4);
+				const VectorRegister Sum = VectorAdd(VectorShuffle(V0, V1, 0, 2, 0, 2), VectorShuffle(V0, V1, 1, 3, 1, 3));
+				VectorStore(VectorMultiply(Half, Sum), MonoBuffer + Frame);
+			}
+			for (; Frame < NumFrames; ++Frame)
+			{
+				MonoBuffer[Frame] = 0.5f * (StereoBuffer[Frame * 2] + StereoBuffer[Frame * 2 + 1]);
+			}
+		}
+
+		void CopyStereoToInterleaved(const float* StereoBuffer, float* OutBuffer,
+		                             const int32 NumFrames, const int32 NumChannels)
+		{
+			if (NumChannels == 2)
+			{
+				FMemory::Memcpy(OutBuffer, StereoBuffer, NumFrames * 2 * sizeof(float));
+				return;
+			}
+
+			// Only the first two channels of each frame are written, the rest of the submix frame is left as is
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				FMemory::Memcpy(OutBuffer + Frame * NumChannels, StereoBuffer + Frame * 2, 2 * sizeof(float));
+			}
+		}
+
 		int32 ChannelCount2AmbisonicOrder(int32 InNumChannel)
 		{
 			return FMath::RoundToInt(FMath::Sqrt(static_cast<float>(InNumChannel))) - 1;
@@ -27,6 +27,18 @@ namespace Pxr_Audio
 
 		float DB2Mag(float DB);
 
+		/**
+		 * Averages the channels of an interleaved buffer into mono, in place. The mono result occupies the first
+		 * NumFrames samples. 2/4/6/8 channel layouts are vectorized and match the scalar channel-order sum bit for bit.
+		 */
+		void DownmixInterleavedToMono(float* InOutBuffer, int32 NumFrames, int32 NumChannels);
+
+		/** Writes 0.5 * (L + R) of an interleaved stereo buffer into MonoBuffer */
+		void DownmixStereoToMono(const float* StereoBuffer, float* MonoBuffer, int32 NumFrames);
+
+		/** Copies an interleaved stereo buffer into the first two channels of a NumChannels interleaved buffer */
+		void CopyStereoToInterleaved(const float* StereoBuffer, float* OutBuffer, int32 NumFrames, int32 NumChannels);
+
 		int32 ChannelCount2AmbisonicOrder(int32 InNumChannel);
 
 		inline void ZeroOutAudioBuffer(Audio::AlignedFloatBuffer& buffer)
@@ -123,19 +123,10 @@ namespace Pxr_Audio
 			}
 			else if (OutData.NumChannels > 2) //	Fill output to the first 2 channels
 			{
-				TemporaryStereoBuffer.Reset();
-				TemporaryStereoBuffer.AddZeroed(2 * InData.NumFrames);
-
-				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(TemporaryStereoBuffer.GetData(),
-				                                                               OutData.AudioBuffer->Num() / 2, false);
-				float* OutputBufferPtr = OutData.AudioBuffer->GetData();
-				for (int32 i = 0; i < InData.NumFrames; ++i)
-				{
-					const int32 SubmixFrameHead = i * OutData.NumChannels;
-					const int32 StereoBufferFrameHead = i * 2;
-					OutputBufferPtr[SubmixFrameHead] = TemporaryStereoBuffer[StereoBufferFrameHead];
-					OutputBufferPtr[SubmixFrameHead + 1] = TemporaryStereoBuffer[StereoBufferFrameHead + 1];
-				}
+				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(
+					PrepareTemporaryStereoBuffer(InData.NumFrames), InData.NumFrames, false);
+				CopyStereoToInterleaved(TemporaryStereoBuffer.GetData(), OutData.AudioBuffer->GetData(),
+				                        InData.NumFrames, OutData.NumChannels);
 			}
 			else if (OutData.NumChannels == 1)
 			{
@@ -144,20 +135,24 @@ namespace Pxr_Audio
 					       "Reverb is connected to 1-channel output, down-mixing binaural audio (sound quality is degraded)"
 				       ));
 
-				// FillInterleavedOutputBuffer (below) can fail if the graph does not have any sources to process, so the temp buffer must be zeroed
-				TemporaryStereoBuffer.Reset();
-				TemporaryStereoBuffer.AddZeroed(2 * InData.NumFrames);
+				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(
+					PrepareTemporaryStereoBuffer(InData.NumFrames), InData.NumFrames, false);
+				DownmixStereoToMono(TemporaryStereoBuffer.GetData(), OutData.AudioBuffer->GetData(), InData.NumFrames);
+			}
+		}
 
-				FContextSingleton::GetInstance()->GetInterleavedBinauralBuffer(TemporaryStereoBuffer.GetData(),
-				                                                               OutData.AudioBuffer->Num() / 2, false);
-				float* OutputBufferPtr = OutData.AudioBuffer->GetData();
-				for (int32 i = 0; i < InData.NumFrames; ++i)
-				{
-					const int32 StereoBufferFrameHead = i * 2;
-					OutputBufferPtr[i] = 0.5f * (TemporaryStereoBuffer[StereoBufferFrameHead] +
-						TemporaryStereoBuffer[StereoBufferFrameHead + 1]);
-				}
+		float* FReverb::PrepareTemporaryStereoBuffer(const int32 NumFrames)
+		{
+			// The buffer only ever grows, so steady-state callbacks do not allocate
+			const int32 NumSamples = 2 * NumFrames;
+			if (TemporaryStereoBuffer.Num() < NumSamples)
+			{
+				TemporaryStereoBuffer.SetNumUninitialized(NumSamples);
 			}
+
+			// GetInterleavedBinauralBuffer can fail if the graph does not have any sources to process, so the temp buffer must be zeroed
+			FMemory::Memzero(TemporaryStereoBuffer.GetData(), NumSamples * sizeof(float));
+			return TemporaryStereoBuffer.GetData();
 		}
 
 		void FReverb::InitSubmixEffect()
@@ -38,6 +38,9 @@ namespace Pxr_Audio
 			UPxrAudioSpatializerReverbPluginPreset* ReverbPreset;
 
 			void InitSubmixEffect();
+
+			/** Returns TemporaryStereoBuffer zeroed for NumFrames stereo frames, reallocating only when it grows */
+			float* PrepareTemporaryStereoBuffer(int32 NumFrames);
 		};
 	}
 }
@@ -84,6 +84,8 @@ namespace Pxr_Audio
 				return;
 			}
 
+			InternalSourceProperty.SourceGainDb = SourceSetting->SourceGainDb;
+			InternalSourceProperty.ReflectionGainDb = SourceSetting->ReflectionGainDb;
 			InternalSourceProperty.Config.source_gain = DB2Mag(SourceSetting->SourceGainDb);
 			InternalSourceProperty.Config.reflection_gain = DB2Mag(SourceSetting->ReflectionGainDb);
 			InternalSourceProperty.Config.radius = SourceSetting->VolumetricSize;
@@ -167,20 +169,28 @@ namespace Pxr_Audio
 				InternalSourceProperty.Config.up);
 			InternalSourceProperty.PropertyMask |= PASP_SourceProperty_Position | PASP_SourceProperty_Orientation;
 
-			// Set sound source gain.
-			const float NewSourceGainAmplitude = DB2Mag(SourceSetting->SourceGainDb);
-			if (!FMath::IsNearlyEqual(InternalSourceProperty.Config.source_gain, NewSourceGainAmplitude))
+			// Set sound source gain. The dB to amplitude conversion only runs when the setting changes.
+			if (InternalSourceProperty.SourceGainDb != SourceSetting->SourceGainDb)
 			{
-				InternalSourceProperty.Config.source_gain = NewSourceGainAmplitude;
-				InternalSourceProperty.PropertyMask |= PASP_SourceProperty_SourceGain;
+				InternalSourceProperty.SourceGainDb = SourceSetting->SourceGainDb;
+				const float NewSourceGainAmplitude = DB2Mag(SourceSetting->SourceGainDb);
+				if (!FMath::IsNearlyEqual(InternalSourceProperty.Config.source_gain, NewSourceGainAmplitude))
+				{
+					InternalSourceProperty.Config.source_gain = NewSourceGainAmplitude;
+					InternalSourceProperty.PropertyMask |= PASP_SourceProperty_SourceGain;
+				}
 			}
 
 			// Set sound source reflection gain.
-			const float NewSourceReflectionGainAmplitude = DB2Mag(SourceSetting->ReflectionGainDb);
-			if (!FMath::IsNearlyEqual(InternalSourceProperty.Config.reflection_gain, NewSourceReflectionGainAmplitude))
+			if (InternalSourceProperty.ReflectionGainDb != SourceSetting->ReflectionGainDb)
 			{
-				InternalSourceProperty.Config.reflection_gain = NewSourceReflectionGainAmplitude;
-				InternalSourceProperty.PropertyMask |= PASP_SourceProperty_ReflectionGain;
+				InternalSourceProperty.ReflectionGainDb = SourceSetting->ReflectionGainDb;
+				const float NewSourceReflectionGainAmplitude = DB2Mag(SourceSetting->ReflectionGainDb);
+				if (!FMath::IsNearlyEqual(InternalSourceProperty.Config.reflection_gain, NewSourceReflectionGainAmplitude))
+				{
+					InternalSourceProperty.Config.reflection_gain = NewSourceReflectionGainAmplitude;
+					InternalSourceProperty.PropertyMask |= PASP_SourceProperty_ReflectionGain;
+				}
 			}
 
 			// Set source volumetric size (radius).
@@ -240,17 +250,9 @@ namespace Pxr_Audio
 			//	Force input data to mono, in-places
 			if (InputData.NumChannels > 1)
 			{
-				float* InputBuffer = InputData.AudioBuffer->GetData();
-				size_t BufferWriteIdx = 0;
-				for (size_t Frame = 0; Frame < InputData.AudioBuffer->Num(); Frame += InputData.NumChannels)
-				{
-					InputBuffer[BufferWriteIdx] = InputBuffer[Frame];
-					for (size_t Channel = 1; Channel < InputData.NumChannels; ++Channel)
-					{
-						InputBuffer[BufferWriteIdx] += InputBuffer[Frame + Channel];
-					}
-					InputBuffer[BufferWriteIdx++] /= static_cast<float>(InputData.NumChannels);
-				}
+				DownmixInterleavedToMono(InputData.AudioBuffer->GetData(),
+				                         InputData.AudioBuffer->Num() / InputData.NumChannels,
+				                         InputData.NumChannels);
 			}
 
 			// Add source buffer to process.
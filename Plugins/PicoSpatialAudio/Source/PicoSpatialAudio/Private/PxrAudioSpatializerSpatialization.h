@@ -32,10 +32,16 @@ namespace Pxr_Audio
 				//	Source settings
 				PxrAudioSpatializer_SourceConfig Config;
 				unsigned int PropertyMask = 0;
+
+				//	Gains in dB that Config's amplitudes were last converted from
+				float SourceGainDb = 0.0f;
+				float ReflectionGainDb = 0.0f;
 				
 				FInternalSourceProperties()
 				{
 					const auto* DefaultSourceSettings = FPicoSpatialAudioModule::GetDefaultSourceSettings();
+					SourceGainDb = DefaultSourceSettings->SourceGainDb;
+					ReflectionGainDb = DefaultSourceSettings->ReflectionGainDb;
 					Config.source_gain = DB2Mag(DefaultSourceSettings->SourceGainDb);
 					Config.reflection_gain = DB2Mag(DefaultSourceSettings->ReflectionGainDb);
 					Config.radius = DefaultSourceSettings->VolumetricSize;
@@ -9,6 +9,17 @@
 #include "PxrAudioSpatializerCommonUtils.h"
 #include "PicoSpatialAudioSceneGeometryComponent.generated.h"
 
+//	Where one gathered static mesh landed in the batched vertices and indices buffers
+struct FPicoSpatialAudioBatchedMeshRange
+{
+	const UStaticMesh* StaticMesh = nullptr;
+	FTransform RelativeTransformToRoot;
+	int32 VertexStart = 0;
+	int32 VertexCount = 0;
+	int32 IndexStart = 0;
+	int32 IndexCount = 0;
+};
+
 UCLASS(ClassGroup=(Audio), HideCategories = (Transform, Activation, Collision, Cooking),
 	meta=(BlueprintSpawnableComponent))
 class PICOSPATIALAUDIO_API UPicoSpatialAudioSceneGeometryComponent : public USceneComponent
@@ -56,6 +67,8 @@ private:
 	TArray<FTransform> GatheredStaticMeshTransforms;
 	TArray<float> BatchedMeshVerticesBuffer;
 	TArray<int32> BatchedMeshIndicesBuffer;
+	//	Sub-mesh ranges of BatchedMeshVerticesBuffer, lets a re-submit of the same meshes skip batching
+	TArray<FPicoSpatialAudioBatchedMeshRange> BatchedMeshRanges;
 
 	UPROPERTY(VisibleAnywhere, Category = "Mesh Baking Utilities")
 	TArray<float> BatchedBakedMeshVerticesBuffer;
@@ -76,9 +89,15 @@ private:
 	                                                   TArray<FTransform>& OutGatheredStaticMeshTransforms,
 	                                                   bool InIncludeChildrenComponent,
 	                                                   bool InAllowCPUAccess);
+	/**
+	 * Batches the gathered meshes into one vertices and indices buffer, spreading the work over the task graph.
+	 * If InOutBatchedMeshRanges already describes the same meshes, the buffers are kept and only the sub-meshes
+	 * whose transform relative to the root changed are transformed again.
+	 */
 	static void BatchStaticMeshes(const TArray<UStaticMesh*>& InGatheredStaticMeshes,
 	                              const TArray<FTransform>& InGatheredStaticMeshTransforms,
 	                              const FTransform& RootTransform,
 	                              TArray<float>& OutBatchedMeshVerticesBuffer,
-	                              TArray<int32>& OutBatchedMeshIndicesBuffer);
+	                              TArray<int32>& OutBatchedMeshIndicesBuffer,
+	                              TArray<FPicoSpatialAudioBatchedMeshRange>& InOutBatchedMeshRanges);
 };